@@ -562,6 +562,12 @@ VariantBuffer * var::getBuffer() const noexcept
 	else return nullptr;
 }
 
+int var::getArrayReferenceCount() const noexcept
+{
+	if (isArray() && value.objectValue != nullptr) return value.objectValue->getReferenceCount();
+	else return 0;
+}
+
 //==============================================================================
 void var::swapWith (var& other) noexcept
 {
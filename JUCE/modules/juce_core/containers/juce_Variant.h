@@ -143,6 +143,9 @@ public:
 
 	VariantBuffer *getBuffer() const noexcept;
 
+	/** Returns the number of vars that share the storage of this array (or 0 if this is not an array). */
+	int getArrayReferenceCount() const noexcept;
+
     //==============================================================================
     bool isVoid() const noexcept;
     bool isUndefined() const noexcept;
@@ -565,16 +565,16 @@ CompileExporter::ErrorCodes CompileExporter::exportInternal(TargetTypes type, Bu
 		{
 			if (IS_SETTING_TRUE(HiseSettings::Project::EmbedAudioFiles))
 			{
-				writeValueTreeToTemporaryFile(exportReferencedAudioFiles(), directoryPath, "impulses");
-				writeValueTreeToTemporaryFile(exportReferencedImageFiles(), directoryPath, "images");
+				ResourceArchive::writeArchive(exportReferencedAudioFiles(), File(directoryPath).getChildFile("impulses"));
+				ResourceArchive::writeArchive(exportReferencedImageFiles(), File(directoryPath).getChildFile("images"));
 			}
 			else
 			{
 				File appFolder = ProjectHandler::Frontend::getAppDataDirectory(chainToExport).getChildFile("AudioResources.dat");
-				PresetHandler::writeValueTreeAsFile(exportReferencedAudioFiles(), appFolder.getFullPathName());
+				ResourceArchive::writeArchive(exportReferencedAudioFiles(), appFolder);
 
 				File imageFolder = ProjectHandler::Frontend::getAppDataDirectory(chainToExport).getChildFile("ImageResources.dat");
-				PresetHandler::writeValueTreeAsFile(exportReferencedImageFiles(), imageFolder.getFullPathName());
+				ResourceArchive::writeArchive(exportReferencedImageFiles(), imageFolder);
 			}
 		}
 
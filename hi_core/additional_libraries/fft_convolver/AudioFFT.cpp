@@ -43,12 +43,12 @@
 #elif defined (AUDIOFFT_FFTW3)
   #define AUDIOFFT_FFTW3_USED
   #include <fftw3.h>
-#else
-  #if !defined(AUDIOFFT_OOURA)
-    #define AUDIOFFT_OOURA
-  #endif
+#elif defined (AUDIOFFT_OOURA)
   #define AUDIOFFT_OOURA_USED
   #include <vector>
+#else
+  #define AUDIOFFT_HISE_USED
+  #include <vector>
 #endif
 
 
@@ -783,6 +783,103 @@ namespace audiofft
   // ================================================================
 
 
+#ifdef AUDIOFFT_HISE_USED
+#if !USE_IPP
+
+  /**
+   * @internal
+   * @class HiseFFTImpl
+   * @brief FFT implementation that uses the portable SIMD FFT of HISE
+   */
+  class HiseFFTImpl : public detail::AudioFFTImpl
+  {
+  public:
+    HiseFFTImpl() :
+      detail::AudioFFTImpl(),
+      _size(0),
+      _buffer()
+    {
+    }
+
+    HiseFFTImpl(const HiseFFTImpl&) = delete;
+    HiseFFTImpl& operator=(const HiseFFTImpl&) = delete;
+
+    virtual void init(size_t size) override
+    {
+      if (size == 0)
+      {
+        // init(0) is used to reset the FFT, and HiseFFT can't be created with this size
+        _fft = nullptr;
+        _buffer.clear();
+        _size = 0;
+        return;
+      }
+
+      if (_size != size)
+      {
+        _fft = new hise::HiseFFT(static_cast<int>(size));
+        _buffer.resize(size);
+        _size = size;
+      }
+    }
+
+    virtual void fft(const float* data, float* re, float* im) override
+    {
+      _fft->realFFT(data, _buffer.data());
+
+      // Convert the packed spectrum into split-complex
+      const size_t size2 = _size / 2;
+
+      re[0] = _buffer[0];
+      im[0] = 0.0f;
+      re[size2] = _buffer[1];
+      im[size2] = 0.0f;
+
+      for (size_t i = 1; i < size2; ++i)
+      {
+        re[i] = _buffer[2 * i];
+        im[i] = _buffer[2 * i + 1];
+      }
+    }
+
+    virtual void ifft(float* data, const float* re, const float* im) override
+    {
+      const size_t size2 = _size / 2;
+
+      _buffer[0] = re[0];
+      _buffer[1] = re[size2];
+
+      for (size_t i = 1; i < size2; ++i)
+      {
+        _buffer[2 * i] = re[i];
+        _buffer[2 * i + 1] = im[i];
+      }
+
+      _fft->realFFTInverse(_buffer.data(), data);
+
+      detail::ScaleBuffer(data, data, 1.0f / static_cast<float>(_size), _size);
+    }
+
+  private:
+    size_t _size;
+    juce::ScopedPointer<hise::HiseFFT> _fft;
+    std::vector<float> _buffer;
+  };
+
+
+  /**
+   * @internal
+   * @brief Concrete FFT implementation
+   */
+  typedef HiseFFTImpl AudioFFTImplementation;
+
+#endif
+#endif // AUDIOFFT_HISE_USED
+
+
+  // ================================================================
+
+
 #ifdef AUDIOFFT_APPLE_ACCELERATE_USED
 
 
@@ -126,6 +126,16 @@ Use the Intel Performance Primitives Library for the convolution reverb.
 #define USE_VDSP_FFT 0
 #endif
 
+/** Config: HISE_GAPLESS_PRESET_LOADING
+
+If set to 1, user presets are loaded on the sample loading thread without killing all voices. The control values are applied
+while the audio is playing, the MIDI automation and modulated parameters are swapped at the next block boundary.
+Voices are only killed if a sampler needs to load a different sample map.
+*/
+#ifndef HISE_GAPLESS_PRESET_LOADING
+#define HISE_GAPLESS_PRESET_LOADING 1
+#endif
+
 /** Config: FRONTEND_IS_PLUGIN
 
 If set to 1, the compiled plugin will be a effect (stereo in / out). */
@@ -191,6 +201,15 @@ If this is set to 1, the application will crash instantly if there is a drop out
 #define ENABLE_SCRIPTING_BREAKPOINTS 0
 #endif
 
+/** Config: HISE_USE_SCRIPT_BYTECODE
+
+If enabled, the script callbacks and inline functions are compiled to bytecode for a register based VM after parsing.
+Everything the compiler doesn't support will still be evaluated by the parsed tree.
+*/
+#ifndef HISE_USE_SCRIPT_BYTECODE
+#define HISE_USE_SCRIPT_BYTECODE 1
+#endif
+
 /** Config: ENABLE_ALL_PEAK_METERS
 
 Set this to 0 to deactivate peak collection for any other processor than the main synth chain
@@ -239,6 +258,32 @@ Set this to 0 to deactivate the CPU peak meter.
 #define ENABLE_APPLE_SANDBOX 0
 #endif
 
+/** Config: HISE_NUM_AUDIO_WORKER_THREADS
+
+The number of additional threads that can be used by the audio thread to render voices or child synths in parallel.
+It will be limited to the number of CPU cores minus one. Set this to 0 to disable parallel rendering.
+*/
+#ifndef HISE_NUM_AUDIO_WORKER_THREADS
+#if JUCE_IOS
+#define HISE_NUM_AUDIO_WORKER_THREADS 0
+#else
+#define HISE_NUM_AUDIO_WORKER_THREADS 3
+#endif
+#endif
+
+/** Config: HISE_RESOURCE_ARCHIVE_IMAGE_CACHE_MB
+
+The amount of memory in MB that can be used for decoded images of the embedded image archive.
+Images that exceed this limit will be freed (if they are not used anymore) and decoded again when needed.
+*/
+#ifndef HISE_RESOURCE_ARCHIVE_IMAGE_CACHE_MB
+#if JUCE_IOS
+#define HISE_RESOURCE_ARCHIVE_IMAGE_CACHE_MB 32
+#else
+#define HISE_RESOURCE_ARCHIVE_IMAGE_CACHE_MB 128
+#endif
+#endif
+
 /** Config: USE_HARD_CLIPPER
 
 Set this to 1 to enable hard clipping of the output (brickwall everything over 1.0)
@@ -286,7 +286,11 @@ struct DebugLogger::Failure : public DebugLogger::Message
 
 		errorMessage << getLocationString();
 
-		if (extraValue != 0.0)
+		if (type == FailureType::ScriptAllocation)
+		{
+			errorMessage << "- Line: **" << String((int)extraValue) << "**  " << nl;
+		}
+		else if (extraValue != 0.0)
 		{
 			errorMessage << "- AdditionalInfo: **" << String(extraValue, 3) << "**  " << nl;
 		}
@@ -345,6 +349,28 @@ void DebugLogger::addStreamingFailure(double voiceUptime)
 	addFailure(f);
 }
 
+void DebugLogger::addEventBufferOverflow(const Processor* p, int numDroppedEvents)
+{
+	if (!isLogging())
+		return;
+
+	const Location l = p == nullptr ? Location::MainRenderCallback : Location::SynthRendering;
+
+	Failure f = Failure(messageIndex++, callbackIndex, l, FailureType::EventBufferOverflow, p, getCurrentTimeStamp(), (double)numDroppedEvents);
+
+	addFailure(f);
+}
+
+void DebugLogger::addScriptAllocation(const Processor* p, Location l, const Identifier& callbackName, int lineNumber)
+{
+	if (!isLogging())
+		return;
+
+	Failure f = Failure(messageIndex++, callbackIndex, l, FailureType::ScriptAllocation, p, getCurrentTimeStamp(), (double)lineNumber, callbackName);
+
+	addFailure(f);
+}
+
 void DebugLogger::logEvents(const HiseEventBuffer& masterBuffer)
 {
 	if (isLogging())
@@ -904,6 +930,8 @@ String DebugLogger::getNameForFailure(FailureType f)
 		RETURN_CASE_STRING_FAILURE(SampleLoadingError);
 		RETURN_CASE_STRING_FAILURE(StreamingFailure);
 		RETURN_CASE_STRING_FAILURE(SoftBypassFailure);
+		RETURN_CASE_STRING_FAILURE(EventBufferOverflow);
+		RETURN_CASE_STRING_FAILURE(ScriptAllocation);
         RETURN_CASE_STRING_FAILURE(numFailureTypes);
 	}
 
@@ -70,6 +70,8 @@ public:
 		SampleLoadingError,
 		StreamingFailure,
 		SoftBypassFailure,
+		EventBufferOverflow, //< events were dropped because a HiseEventBuffer was full
+		ScriptAllocation, //< a script callback allocated on the audio thread
 		numFailureTypes
 	};
 
@@ -179,6 +181,12 @@ public:
 
 	void addStreamingFailure(double voiceUptime);
 
+	/** Logs the events that were dropped by a full HiseEventBuffer. Pass nullptr for the master event buffer. */
+	void addEventBufferOverflow(const Processor* p, int numDroppedEvents);
+
+	/** Logs the line of the first allocation in a script callback that was executed on the audio thread. */
+	void addScriptAllocation(const Processor* p, Location l, const Identifier& callbackName, int lineNumber);
+
 	void logEvents(const HiseEventBuffer& masterBuffer);
 
 	void logMessage(const String& errorMessage);
@@ -59,6 +59,10 @@ String ImagePool::getFileNameForId(Identifier identifier) const
 	if (index != -1)
 		return loadedImages[index].fileName;
 
+	auto archiveIndex = getArchiveIndex(identifier);
+	if (archiveIndex != -1)
+		return archive->getEntry(archiveIndex).fileName;
+
 	return String();
 }
 
@@ -191,6 +195,14 @@ Image ImagePool::loadFileIntoPool(const String& fileName)
 		return loadedImages[existingIndex].data;
 	}
 
+	const int archiveIndex = getArchiveIndex(idForFileName);
+
+	if (archiveIndex != -1)
+	{
+		// Don't add it to the loaded images so that the archive can free it if it's not used anymore
+		return archive->getImage(archiveIndex);
+	}
+
 	ImageEntry ne;
 	ne.id = idForFileName;
 	ne.fileName = fileName;
@@ -312,6 +324,22 @@ void SharedPoolBase::restoreFromValueTree(const ValueTree &v)
 #endif
 }
 
+void SharedPoolBase::setResourceArchive(ResourceArchive* newArchive)
+{
+	if (archive.get() == newArchive)
+		return;
+
+	ResourceArchive::releaseArchive(archive);
+	archive = newArchive;
+
+	notifyTable();
+}
+
+int SharedPoolBase::getArchiveIndex(const Identifier& id) const
+{
+	return archive != nullptr ? archive->indexOf(id) : -1;
+}
+
 ProjectHandler& SharedPoolBase::getProjectHandler()
 {
 	return GET_PROJECT_HANDLER(mc->getMainSynthChain());
@@ -351,6 +379,10 @@ String AudioSampleBufferPool::getFileNameForId(Identifier identifier) const
 	if (index != -1)
 		return loadedSamples[index].fileName;
 
+	auto archiveIndex = getArchiveIndex(identifier);
+	if (archiveIndex != -1)
+		return archive->getEntry(archiveIndex).fileName;
+
 	return String();
 }
 
@@ -424,6 +456,18 @@ AudioSampleBuffer AudioSampleBufferPool::loadFileIntoPool(const String& fileName
 	be.id = idForFileName;
 	be.fileName = fileName;
 
+	const int archiveIndex = getArchiveIndex(idForFileName);
+
+	if (archiveIndex != -1)
+	{
+		be.fileName = archive->getEntry(archiveIndex).fileName;
+
+		loadFromStream(be, archive->createInputStream(archiveIndex));
+		loadedSamples.add(be);
+
+		return be.data;
+	}
+
 	File f = getFileFromFileNameString(fileName);
 
 	if(f.existsAsFile())
@@ -69,7 +69,10 @@ public:
 	{};
 
 
-	virtual ~SharedPoolBase() {};
+	virtual ~SharedPoolBase() 
+	{
+		ResourceArchive::releaseArchive(archive);
+	};
 
 	virtual Identifier getFileTypeName() const = 0;
 
@@ -99,8 +102,20 @@ public:
 
 	const ProjectHandler& getProjectHandler() const;
 
+	/** Sets an archive that contains the files of this pool. 
+	*
+	*	Files that are not loaded yet will be decoded from the archive when they are requested for the first time. 
+	*	The entries of the archive will not show up in the list of loaded files until they are used.
+	*/
+	void setResourceArchive(ResourceArchive* newArchive);
+
+	ResourceArchive* getResourceArchive() const { return archive.get(); }
+
 protected:
 
+	/** Returns the index of the archive entry for the given id or -1 if there is no archive. */
+	int getArchiveIndex(const Identifier& id) const;
+
 	template <class DataType> struct PoolEntry
 	{
 		PoolEntry() :
@@ -138,6 +153,8 @@ protected:
 
 	MainController* mc;
 
+	ResourceArchive::Ptr archive;
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedPoolBase)
 };
 
@@ -96,6 +96,25 @@ void GlobalScriptCompileBroadcaster::updateCallstackSettingForExistingScriptProc
 	}
 }
 
+bool GlobalScriptCompileBroadcaster::isAudioThreadSafeModeEnabled() const noexcept
+{
+	return (bool)dynamic_cast<const GlobalSettingManager*>(this)->getSettingsObject().getSetting(HiseSettings::Scripting::EnableAudioThreadSafeMode);
+}
+
+void GlobalScriptCompileBroadcaster::updateAudioThreadSafeModeForExistingScriptProcessors()
+{
+	auto shouldBeEnabled = isAudioThreadSafeModeEnabled();
+
+	ModulatorSynthChain *mainChain = dynamic_cast<MainController*>(this)->getMainSynthChain();
+
+	Processor::Iterator<JavascriptProcessor> iter(mainChain);
+
+	while (auto jp = iter.getNextProcessor())
+	{
+		jp->setAudioThreadSafeMode(shouldBeEnabled);
+	}
+}
+
 void GlobalScriptCompileBroadcaster::fillExternalFileList(Array<File> &files, StringArray &processors)
 {
 	ModulatorSynthChain *mainChain = dynamic_cast<MainController*>(this)->getMainSynthChain();
@@ -160,6 +160,9 @@ public:
 	bool isCallStackEnabled() const noexcept;;
 	void updateCallstackSettingForExistingScriptProcessors();
 
+	bool isAudioThreadSafeModeEnabled() const noexcept;
+	void updateAudioThreadSafeModeForExistingScriptProcessors();
+
 
 	void fillExternalFileList(Array<File> &files, StringArray &processors);
 
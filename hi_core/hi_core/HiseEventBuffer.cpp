@@ -150,8 +150,18 @@ uint16 HiseEvent::getStartOffset() const noexcept
 
 HiseEventBuffer::HiseEventBuffer()
 {
-	numUsed = HISE_EVENT_BUFFER_SIZE;
-	clear();
+	buffer.calloc(HISE_EVENT_BUFFER_SIZE);
+	capacity = HISE_EVENT_BUFFER_SIZE;
+}
+
+void HiseEventBuffer::ensureCapacity(int numEventsToHold)
+{
+	if (numEventsToHold <= capacity)
+		return;
+
+	buffer.realloc(numEventsToHold);
+	HiseEvent::clear(buffer + capacity, numEventsToHold - capacity);
+	capacity = numEventsToHold;
 }
 
 void HiseEventBuffer::clear()
@@ -166,36 +176,37 @@ void HiseEventBuffer::clear()
 
 void HiseEventBuffer::addEvent(const HiseEvent& hiseEvent)
 {
-	if (numUsed >= HISE_EVENT_BUFFER_SIZE)
+	if (numUsed >= capacity)
 	{
 		// Buffer full..
-		jassertfalse;
+		numDroppedEvents++;
 		return;
 	}
 
-	if (numUsed == 0)
+	const uint16 messageTimestamp = hiseEvent.getTimeStamp();
+
+	// Most events are added in order, so this skips the search
+	if (numUsed == 0 || buffer[numUsed - 1].getTimeStamp() <= messageTimestamp)
 	{
-		insertEventAtPosition(hiseEvent, 0);
+		insertEventAtPosition(hiseEvent, numUsed);
 		return;
 	}
 
-	jassert(numUsed < HISE_EVENT_BUFFER_SIZE);
+	// Binary search for the first event with a bigger timestamp (so that events with the same timestamp keep their order)
+	int lower = 0;
+	int upper = numUsed - 1;
 
-    const int numToLookFor = jmin<int>(numUsed, HISE_EVENT_BUFFER_SIZE);
-    
-	for (int i = 0; i < numToLookFor; i++)
+	while (lower < upper)
 	{
-		const int timestampInBuffer = buffer[i].getTimeStamp();
-		const int messageTimestamp = hiseEvent.getTimeStamp();
+		const int middle = (lower + upper) / 2;
 
-		if (timestampInBuffer > messageTimestamp)
-		{
-			insertEventAtPosition(hiseEvent, i);
-			return;
-		}
+		if (buffer[middle].getTimeStamp() > messageTimestamp)
+			upper = middle;
+		else
+			lower = middle + 1;
 	}
 
-	insertEventAtPosition(hiseEvent, numUsed);
+	insertEventAtPosition(hiseEvent, lower);
 }
 
 void HiseEventBuffer::addEvent(const MidiMessage& midiMessage, int sampleNumber)
@@ -219,25 +230,22 @@ void HiseEventBuffer::addEvents(const MidiBuffer& otherBuffer)
 
 	while (it.getNextEvent(m, samplePos))
 	{
-		jassert(index < HISE_EVENT_BUFFER_SIZE);
-
 		HiseEvent e(m);
 
 		if (e.isEmpty()) continue;
 
+		if (index >= capacity)
+		{
+			// Buffer full..
+			numDroppedEvents++;
+			continue;
+		}
+
 		e.swapWith(buffer[index]);
 
 		buffer[index].setTimeStamp((uint16)samplePos);
 
 		numUsed++;
-
-		if (numUsed >= HISE_EVENT_BUFFER_SIZE)
-		{
-			// Buffer full..
-			jassertfalse;
-			return;
-		}
-
 		index++;
 	}
 }
@@ -255,7 +263,7 @@ void HiseEventBuffer::addEvents(const HiseEventBuffer &otherBuffer)
 
 HiseEvent HiseEventBuffer::getEvent(int index) const
 {
-	if (index >= 0 && index < HISE_EVENT_BUFFER_SIZE)
+	if (index >= 0 && index < capacity)
 	{
 		return buffer[index];
 	}
@@ -334,13 +342,13 @@ void HiseEventBuffer::moveEventsAbove(HiseEventBuffer& targetBuffer, int lowestT
 
 void HiseEventBuffer::copyFrom(const HiseEventBuffer& otherBuffer)
 {
-    const int eventsToCopy = jmin<int>(otherBuffer.numUsed, HISE_EVENT_BUFFER_SIZE);
+    const int eventsToCopy = jmin<int>(otherBuffer.numUsed, capacity);
     
 	memcpy(buffer, otherBuffer.buffer, sizeof(HiseEvent) * eventsToCopy);
 
-	jassert(otherBuffer.numUsed < HISE_EVENT_BUFFER_SIZE);
+	numDroppedEvents += otherBuffer.numUsed - eventsToCopy;
 
-	numUsed = otherBuffer.numUsed;
+	numUsed = eventsToCopy;
 }
 
 
@@ -358,7 +366,7 @@ bool HiseEventBuffer::Iterator::getNextEvent(HiseEvent& b, int &samplePosition,
 		  (skipIgnoredEvents && buffer->buffer[index].isIgnored())))
 	{
 		index++;
-		jassert(index < HISE_EVENT_BUFFER_SIZE);
+		jassert(index <= buffer->numUsed);
 	}
 		
 	if (index < buffer->numUsed)
@@ -389,7 +397,7 @@ const HiseEvent* HiseEventBuffer::Iterator::getNextConstEventPointer(bool skipIg
 		  (skipIgnoredEvents && buffer->buffer[index].isIgnored())))
 	{
 		index++;
-		jassert(index < HISE_EVENT_BUFFER_SIZE);
+		jassert(index <= buffer->numUsed);
 	}
 
 	if (index < buffer->numUsed)
@@ -405,34 +413,113 @@ const HiseEvent* HiseEventBuffer::Iterator::getNextConstEventPointer(bool skipIg
 
 void HiseEventBuffer::insertEventAtPosition(const HiseEvent& e, int positionInBuffer)
 {
-	if (numUsed == 0)
+	jassert(numUsed < capacity);
+	jassert(positionInBuffer <= numUsed);
+
+	if (numUsed > positionInBuffer)
+		memmove(buffer + positionInBuffer + 1, buffer + positionInBuffer, sizeof(HiseEvent) * (numUsed - positionInBuffer));
+
+	buffer[positionInBuffer] = HiseEvent(e);
+	numUsed++;
+}
+
+HiseEventInbox::HiseEventInbox(int size):
+	mask((uint32)nextPowerOfTwo(jmax<int>(2, size)) - 1),
+	writePosition(0),
+	numDroppedEvents(0)
+{
+	cells.calloc(mask + 1);
+
+	for (uint32 i = 0; i <= mask; i++)
+		cells[i].sequence.store(i);
+}
+
+bool HiseEventInbox::push(const HiseEvent& e) noexcept
+{
+	Cell* cell;
+	uint32 position = writePosition.load(std::memory_order_relaxed);
+
+	for (;;)
 	{
-		buffer[0] = HiseEvent(e);
+		cell = cells + (position & mask);
 
-		numUsed = 1;
+		const uint32 sequence = cell->sequence.load(std::memory_order_acquire);
+		const int32 difference = (int32)sequence - (int32)position;
 
-		return;
+		if (difference == 0)
+		{
+			// The cell is free, try to claim it
+			if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (difference < 0)
+		{
+			// The reader didn't free this cell yet
+			numDroppedEvents++;
+			return false;
+		}
+		else
+		{
+			// Another writer was faster
+			position = writePosition.load(std::memory_order_relaxed);
+		}
 	}
 
-	if (numUsed > positionInBuffer)
+	cell->event = e;
+	cell->sequence.store(position + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool HiseEventInbox::pop(HiseEvent& e) noexcept
+{
+	Cell* cell = cells + (readPosition & mask);
+
+	const uint32 sequence = cell->sequence.load(std::memory_order_acquire);
+
+	if ((int32)sequence - (int32)(readPosition + 1) < 0)
+		return false;
+
+	e = cell->event;
+
+	cell->sequence.store(readPosition + mask + 1, std::memory_order_release);
+	readPosition++;
+
+	return true;
+}
+
+int HiseEventInbox::popAllInto(HiseEventBuffer& destination, int numSamples) noexcept
+{
+	int numPopped = 0;
+	HiseEvent e;
+
+	while (pop(e))
 	{
-		for (int i = jmin<int>(numUsed-1, HISE_EVENT_BUFFER_SIZE-2); i >= positionInBuffer; i--)
-		{
-			jassert(i + 1 < HISE_EVENT_BUFFER_SIZE);
+		e.setTimeStamp((uint16)jlimit<int>(0, jmax<int>(0, numSamples - 1), e.getTimeStamp()));
+		destination.addEvent(e);
 
-			buffer[i + 1] = buffer[i];
-		}
+		numPopped++;
+	}
+
+	return numPopped;
+}
+
+int HiseEventInbox::popAllInto(HiseEventBuffer& destination, HiseEventBuffer& futureEvents, int numSamples) noexcept
+{
+	int numPopped = 0;
+	HiseEvent e;
+
+	while (pop(e))
+	{
+		if ((int)e.getTimeStamp() > numSamples)
+			futureEvents.addEvent(e);
+		else
+			destination.addEvent(e);
+
+		numPopped++;
 	}
 
-    if(positionInBuffer < HISE_EVENT_BUFFER_SIZE)
-    {
-        buffer[positionInBuffer] = HiseEvent(e);
-        numUsed++;
-    }
-    else
-    {
-        jassertfalse;
-    }
+	return numPopped;
 }
 
 } // namespace hise
\ No newline at end of file
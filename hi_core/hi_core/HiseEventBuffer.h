@@ -332,7 +332,10 @@ private:
 	
 };
 
+/** The default capacity of a HiseEventBuffer. The buffers that receive the MIDI input are resized to the block size in prepareToPlay(). */
+#ifndef HISE_EVENT_BUFFER_SIZE
 #define HISE_EVENT_BUFFER_SIZE 256
+#endif
 
 class HiseEventBuffer
 {
@@ -443,6 +446,20 @@ public:
 
 	HiseEventBuffer();
 
+	/** Makes sure that the buffer can hold the given amount of events.
+	*
+	*	This allocates, so call it in prepareToPlay(). The events in the buffer will be kept. If the buffer is full, addEvent()
+	*	drops the event and increases the counter that you can query with getNumDroppedEvents().
+	*/
+	void ensureCapacity(int numEventsToHold);
+
+	int getCapacity() const noexcept { return capacity; }
+
+	/** Returns the number of events that were dropped because the buffer was full. */
+	int getNumDroppedEvents() const noexcept { return numDroppedEvents; }
+
+	void resetDroppedEventCounter() noexcept { numDroppedEvents = 0; }
+
 	bool operator==(const HiseEventBuffer& other)
 	{
 		if (other.getNumUsed() != numUsed) return false;
@@ -534,11 +551,69 @@ private:
 
 	void insertEventAtPosition(const HiseEvent& e, int positionInBuffer);
 
-	HiseEvent buffer[HISE_EVENT_BUFFER_SIZE];
+	HeapBlock<HiseEvent> buffer;
 
+	int capacity = 0;
 	int numUsed = 0;
+	int numDroppedEvents = 0;
 
-	
+	JUCE_DECLARE_NON_COPYABLE(HiseEventBuffer)
+};
+
+
+/** A lock free queue that allows multiple threads to send events to the audio thread.
+*
+*	Use this if you want to add events from the UI, a script or a timer thread. The audio thread moves the events
+*	into its HiseEventBuffer at the start of the block, so the event buffers are never touched by another thread.
+*/
+class HiseEventInbox
+{
+public:
+
+	/** Creates an inbox. The size will be rounded up to the next power of two. */
+	HiseEventInbox(int size = HISE_EVENT_BUFFER_SIZE);
+
+	/** Adds an event. This can be called from any thread and returns false if the inbox is full. 
+	*
+	*	The timestamp of the event is relative to the start of the next block.
+	*/
+	bool push(const HiseEvent& e) noexcept;
+
+	/** Moves all pending events into the buffer and returns the number of moved events.
+	*
+	*	The timestamps are limited to the given block size. Only call this from the audio thread.
+	*/
+	int popAllInto(HiseEventBuffer& destination, int numSamples) noexcept;
+
+	/** Moves all pending events into the buffers and returns the number of moved events.
+	*
+	*	Events with a timestamp after the given block size are added to futureEvents with their original timestamp. 
+	*	Only call this from the audio thread.
+	*/
+	int popAllInto(HiseEventBuffer& destination, HiseEventBuffer& futureEvents, int numSamples) noexcept;
+
+	/** Returns the number of events that were dropped since the last call and resets the counter. */
+	int getAndResetNumDroppedEvents() noexcept { return numDroppedEvents.exchange(0); }
+
+private:
+
+	bool pop(HiseEvent& e) noexcept;
+
+	struct Cell
+	{
+		std::atomic<uint32> sequence;
+		HiseEvent event;
+	};
+
+	HeapBlock<Cell> cells;
+	uint32 mask;
+
+	std::atomic<uint32> writePosition;
+	uint32 readPosition = 0;
+
+	std::atomic<int> numDroppedEvents;
+
+	JUCE_DECLARE_NON_COPYABLE(HiseEventInbox)
 };
 
 
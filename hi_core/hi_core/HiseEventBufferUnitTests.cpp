@@ -64,6 +64,9 @@ public:
 		testEventHandler();
 		testEventBufferStack();
 		testStartOffset();
+		testCapacityAndOverflow();
+		testSortedInsertion();
+		testEventInbox();
 	}
 
 private:
@@ -763,6 +766,159 @@ private:
 
 	}
 
+	void testCapacityAndOverflow()
+	{
+		beginTest("Testing HiseEventBuffer capacity");
+
+		HiseEventBuffer b;
+
+		expectEquals<int>(b.getCapacity(), HISE_EVENT_BUFFER_SIZE, "Default capacity");
+
+		for (int i = 0; i < HISE_EVENT_BUFFER_SIZE + 10; i++)
+			b.addEvent(HiseEvent(HiseEvent::Type::Controller, 1, (uint8)(i % 128), 1));
+
+		expectEquals<int>(b.getNumUsed(), HISE_EVENT_BUFFER_SIZE, "Full buffer");
+		expectEquals<int>(b.getNumDroppedEvents(), 10, "Dropped events");
+
+		b.ensureCapacity(HISE_EVENT_BUFFER_SIZE * 4);
+
+		expectEquals<int>(b.getNumUsed(), HISE_EVENT_BUFFER_SIZE, "Events are kept after resizing");
+		expectEquals<int>(b.getEvent(5).getControllerValue(), 5, "Event content after resizing");
+
+		b.resetDroppedEventCounter();
+
+		for (int i = 0; i < HISE_EVENT_BUFFER_SIZE; i++)
+			b.addEvent(HiseEvent(HiseEvent::Type::Controller, 1, 1, 1));
+
+		expectEquals<int>(b.getNumUsed(), HISE_EVENT_BUFFER_SIZE * 2, "Resized buffer");
+		expectEquals<int>(b.getNumDroppedEvents(), 0, "No dropped events after resizing");
+
+		HiseEventBuffer small;
+		small.copyFrom(b);
+
+		expectEquals<int>(small.getNumUsed(), HISE_EVENT_BUFFER_SIZE, "Copy into a smaller buffer");
+		expectEquals<int>(small.getNumDroppedEvents(), HISE_EVENT_BUFFER_SIZE, "Dropped events when copying");
+	}
+
+	void testSortedInsertion()
+	{
+		beginTest("Testing sorted insertion");
+
+		HiseEventBuffer b;
+
+		for (int i = 0; i < HISE_EVENT_BUFFER_SIZE; i++)
+		{
+			HiseEvent e(HiseEvent::Type::Controller, 1, (uint8)(i % 128), 1);
+			e.setTimeStamp((uint16)r.nextInt(32));
+			e.setStartOffset((uint16)i);
+			b.addEvent(e);
+		}
+
+		HiseEventBuffer::Iterator iter(b);
+
+		const HiseEvent* last = nullptr;
+
+		while (const HiseEvent* e = iter.getNextConstEventPointer())
+		{
+			if (last != nullptr)
+			{
+				expect(last->getTimeStamp() <= e->getTimeStamp(), "Sorted timestamps");
+
+				if (last->getTimeStamp() == e->getTimeStamp())
+					expect(last->getStartOffset() < e->getStartOffset(), "Events with the same timestamp keep their order");
+			}
+
+			last = e;
+		}
+	}
+
+	void testEventInbox()
+	{
+		beginTest("Testing the event inbox");
+
+		HiseEventInbox inbox(64);
+
+		const int numThreads = 4;
+		const int numEventsPerThread = 8;
+
+		struct Producer : public Thread
+		{
+			Producer(HiseEventInbox& inbox_, int index_) :
+				Thread("Producer"),
+				inbox(inbox_),
+				index(index_)
+			{};
+
+			void run() override
+			{
+				for (int i = 0; i < numEventsPerThread; i++)
+				{
+					HiseEvent e(HiseEvent::Type::NoteOn, (uint8)(index * numEventsPerThread + i), 64, 1);
+					e.setTimeStamp((uint16)(i * 16));
+
+					inbox.push(e);
+				}
+			}
+
+			HiseEventInbox& inbox;
+			const int index;
+		};
+
+		OwnedArray<Producer> producers;
+
+		for (int i = 0; i < numThreads; i++)
+			producers.add(new Producer(inbox, i));
+
+		for (auto p : producers)
+			p->startThread();
+
+		for (auto p : producers)
+			p->waitForThreadToExit(1000);
+
+		HiseEventBuffer b;
+
+		const int numPopped = inbox.popAllInto(b, 64);
+
+		expectEquals<int>(numPopped, numThreads * numEventsPerThread, "All events arrived");
+		expectEquals<int>(inbox.getAndResetNumDroppedEvents(), 0, "No dropped events");
+
+		BigInteger receivedNumbers;
+
+		HiseEventBuffer::Iterator iter(b);
+
+		while (const HiseEvent* e = iter.getNextConstEventPointer())
+		{
+			expect(e->getTimeStamp() < 64, "Timestamp is limited to the block size");
+			receivedNumbers.setBit(e->getNoteNumber());
+		}
+
+		expectEquals<int>(receivedNumbers.countNumberOfSetBits(), numThreads * numEventsPerThread, "Every event arrived once");
+
+		for (int i = 0; i < 100; i++)
+			inbox.push(HiseEvent(HiseEvent::Type::NoteOn, 1, 1, 1));
+
+		expectEquals<int>(inbox.getAndResetNumDroppedEvents(), 100 - 64, "Dropped events in a full inbox");
+
+		b.clear();
+
+		expectEquals<int>(inbox.popAllInto(b, 512), 64, "Events in a full inbox");
+		expectEquals<int>(inbox.popAllInto(b, 512), 0, "Empty inbox");
+
+		HiseEvent lateEvent(HiseEvent::Type::NoteOn, 2, 1, 1);
+		lateEvent.setTimeStamp(300);
+
+		inbox.push(HiseEvent(HiseEvent::Type::NoteOn, 1, 1, 1));
+		inbox.push(lateEvent);
+
+		HiseEventBuffer futureEvents;
+		b.clear();
+
+		expectEquals<int>(inbox.popAllInto(b, futureEvents, 256), 2, "Events with future timestamps");
+		expectEquals<int>(b.getNumUsed(), 1, "Event in this block");
+		expectEquals<int>(futureEvents.getNumUsed(), 1, "Event in a future block");
+		expectEquals<int>(futureEvents.getEvent(0).getTimeStamp(), 300, "The future timestamp is kept");
+	}
+
 
 };
 
@@ -0,0 +1,612 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise { using namespace juce;
+
+namespace FFTSimd
+{
+#if JUCE_USE_SSE_INTRINSICS
+
+#define HISE_FFT_USE_SIMD 1
+
+	typedef __m128 Vec;
+
+	static forcedinline Vec load(const float* p) noexcept { return _mm_loadu_ps(p); }
+	static forcedinline void store(float* p, Vec v) noexcept { _mm_storeu_ps(p, v); }
+	static forcedinline Vec set1(float v) noexcept { return _mm_set1_ps(v); }
+	static forcedinline Vec add(Vec a, Vec b) noexcept { return _mm_add_ps(a, b); }
+	static forcedinline Vec sub(Vec a, Vec b) noexcept { return _mm_sub_ps(a, b); }
+	static forcedinline Vec mul(Vec a, Vec b) noexcept { return _mm_mul_ps(a, b); }
+
+	static forcedinline void transpose(Vec& r0, Vec& r1, Vec& r2, Vec& r3) noexcept
+	{
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	}
+
+	static String getInstructionSetName() { return "SSE2"; }
+
+#elif JUCE_USE_ARM_NEON
+
+#define HISE_FFT_USE_SIMD 1
+
+	typedef float32x4_t Vec;
+
+	static forcedinline Vec load(const float* p) noexcept { return vld1q_f32(p); }
+	static forcedinline void store(float* p, Vec v) noexcept { vst1q_f32(p, v); }
+	static forcedinline Vec set1(float v) noexcept { return vdupq_n_f32(v); }
+	static forcedinline Vec add(Vec a, Vec b) noexcept { return vaddq_f32(a, b); }
+	static forcedinline Vec sub(Vec a, Vec b) noexcept { return vsubq_f32(a, b); }
+	static forcedinline Vec mul(Vec a, Vec b) noexcept { return vmulq_f32(a, b); }
+
+	static forcedinline void transpose(Vec& r0, Vec& r1, Vec& r2, Vec& r3) noexcept
+	{
+		const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+		const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+
+		r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+		r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+		r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	}
+
+	static String getInstructionSetName() { return "NEON"; }
+
+#else
+
+#define HISE_FFT_USE_SIMD 0
+
+	static String getInstructionSetName() { return "Scalar"; }
+
+#endif
+}
+
+/** A complex FFT on split data (separate arrays for the real and imaginary parts).
+*
+*	It uses the Stockham autosort algorithm, so there is no bit reversal pass, but it needs a second buffer
+*	to ping pong between the stages. Every stage is a radix-4 butterfly, if the order is odd, the last stage
+*	is a radix-2 butterfly.
+*/
+class HiseFFT::ComplexEngine
+{
+public:
+
+	ComplexEngine(int n_) :
+		n(n_)
+	{
+		int numTwiddles = 0;
+
+		for (int length = n, stride = 1; length >= 4; length /= 4, stride *= 4)
+		{
+			stages.add({ length, stride, numTwiddles });
+			numTwiddles += 6 * (length / 4);
+		}
+
+		twiddles.calloc(jmax<int>(1, numTwiddles));
+
+		for (const auto& s : stages)
+		{
+			const int m = s.length / 4;
+			float* w = twiddles + s.twiddleOffset;
+
+			for (int p = 0; p < m; p++)
+			{
+				for (int k = 1; k < 4; k++)
+				{
+					const double phase = -2.0 * double_Pi * (double)(k * p) / (double)s.length;
+
+					w[(2 * k - 2) * m + p] = (float)std::cos(phase);
+					w[(2 * k - 1) * m + p] = (float)std::sin(phase);
+				}
+			}
+		}
+
+		needsRadix2Stage = !isPowerOfFour(n);
+	}
+
+	/** Transforms the data in re / im and returns true if the result ended up in the work buffers. */
+	bool forward(float* re, float* im, float* workRe, float* workIm) const noexcept
+	{
+		float* xr = re;
+		float* xi = im;
+		float* yr = workRe;
+		float* yi = workIm;
+
+		for (const auto& s : stages)
+		{
+			radix4Stage(xr, xi, yr, yi, s.length, s.stride, twiddles + s.twiddleOffset);
+
+			std::swap(xr, yr);
+			std::swap(xi, yi);
+		}
+
+		if (needsRadix2Stage)
+		{
+			radix2Stage(xr, xi, yr, yi, n / 2);
+
+			std::swap(xr, yr);
+			std::swap(xi, yi);
+		}
+
+		return xr == workRe;
+	}
+
+private:
+
+	static bool isPowerOfFour(int x) noexcept
+	{
+		while (x > 1)
+			x /= 4;
+
+		return x == 1;
+	}
+
+	static forcedinline void butterfly(const float* xr, const float* xi, float* yr, float* yi, int in0, int in1, int in2, int in3, int out0, int out1, int out2, int out3,
+		float w1r, float w1i, float w2r, float w2i, float w3r, float w3i) noexcept
+	{
+		const float apcR = xr[in0] + xr[in2];
+		const float apcI = xi[in0] + xi[in2];
+		const float amcR = xr[in0] - xr[in2];
+		const float amcI = xi[in0] - xi[in2];
+		const float bpdR = xr[in1] + xr[in3];
+		const float bpdI = xi[in1] + xi[in3];
+		const float bmdR = xr[in1] - xr[in3];
+		const float bmdI = xi[in1] - xi[in3];
+
+		const float t1r = amcR + bmdI;
+		const float t1i = amcI - bmdR;
+		const float t2r = apcR - bpdR;
+		const float t2i = apcI - bpdI;
+		const float t3r = amcR - bmdI;
+		const float t3i = amcI + bmdR;
+
+		yr[out0] = apcR + bpdR;
+		yi[out0] = apcI + bpdI;
+		yr[out1] = t1r * w1r - t1i * w1i;
+		yi[out1] = t1r * w1i + t1i * w1r;
+		yr[out2] = t2r * w2r - t2i * w2i;
+		yi[out2] = t2r * w2i + t2i * w2r;
+		yr[out3] = t3r * w3r - t3i * w3i;
+		yi[out3] = t3r * w3i + t3i * w3r;
+	}
+
+#if HISE_FFT_USE_SIMD
+
+	/** The vectorised butterfly. It calculates the outputs in y0 - y3 (they are not stored). */
+	static forcedinline void butterfly(FFTSimd::Vec aR, FFTSimd::Vec aI, FFTSimd::Vec bR, FFTSimd::Vec bI, FFTSimd::Vec cR, FFTSimd::Vec cI, FFTSimd::Vec dR, FFTSimd::Vec dI,
+		FFTSimd::Vec w1r, FFTSimd::Vec w1i, FFTSimd::Vec w2r, FFTSimd::Vec w2i, FFTSimd::Vec w3r, FFTSimd::Vec w3i,
+		FFTSimd::Vec* yR, FFTSimd::Vec* yI) noexcept
+	{
+		using namespace FFTSimd;
+
+		const Vec apcR = add(aR, cR);
+		const Vec apcI = add(aI, cI);
+		const Vec amcR = sub(aR, cR);
+		const Vec amcI = sub(aI, cI);
+		const Vec bpdR = add(bR, dR);
+		const Vec bpdI = add(bI, dI);
+		const Vec bmdR = sub(bR, dR);
+		const Vec bmdI = sub(bI, dI);
+
+		const Vec t1r = add(amcR, bmdI);
+		const Vec t1i = sub(amcI, bmdR);
+		const Vec t2r = sub(apcR, bpdR);
+		const Vec t2i = sub(apcI, bpdI);
+		const Vec t3r = sub(amcR, bmdI);
+		const Vec t3i = add(amcI, bmdR);
+
+		yR[0] = add(apcR, bpdR);
+		yI[0] = add(apcI, bpdI);
+		yR[1] = sub(mul(t1r, w1r), mul(t1i, w1i));
+		yI[1] = add(mul(t1r, w1i), mul(t1i, w1r));
+		yR[2] = sub(mul(t2r, w2r), mul(t2i, w2i));
+		yI[2] = add(mul(t2r, w2i), mul(t2i, w2r));
+		yR[3] = sub(mul(t3r, w3r), mul(t3i, w3i));
+		yI[3] = add(mul(t3r, w3i), mul(t3i, w3r));
+	}
+
+#endif
+
+	static void radix4Stage(const float* xr, const float* xi, float* yr, float* yi, int length, int s, const float* w) noexcept
+	{
+		const int m = length / 4;
+
+		const float* w1r = w;
+		const float* w1i = w + m;
+		const float* w2r = w + 2 * m;
+		const float* w2i = w + 3 * m;
+		const float* w3r = w + 4 * m;
+		const float* w3i = w + 5 * m;
+
+#if HISE_FFT_USE_SIMD
+		using namespace FFTSimd;
+
+		if (s >= 4)
+		{
+			// The stride is a multiple of four, so the inner loop can be vectorised without shuffling
+			for (int p = 0; p < m; p++)
+			{
+				const Vec vw1r = set1(w1r[p]);
+				const Vec vw1i = set1(w1i[p]);
+				const Vec vw2r = set1(w2r[p]);
+				const Vec vw2i = set1(w2i[p]);
+				const Vec vw3r = set1(w3r[p]);
+				const Vec vw3i = set1(w3i[p]);
+
+				const int in0 = s * p;
+				const int in1 = s * (p + m);
+				const int in2 = s * (p + 2 * m);
+				const int in3 = s * (p + 3 * m);
+				const int out0 = s * (4 * p);
+
+				for (int q = 0; q < s; q += 4)
+				{
+					Vec yR[4], yI[4];
+
+					butterfly(load(xr + in0 + q), load(xi + in0 + q), load(xr + in1 + q), load(xi + in1 + q),
+							  load(xr + in2 + q), load(xi + in2 + q), load(xr + in3 + q), load(xi + in3 + q),
+							  vw1r, vw1i, vw2r, vw2i, vw3r, vw3i, yR, yI);
+
+					for (int k = 0; k < 4; k++)
+					{
+						store(yr + out0 + k * s + q, yR[k]);
+						store(yi + out0 + k * s + q, yI[k]);
+					}
+				}
+			}
+
+			return;
+		}
+
+		if (s == 1 && m >= 4)
+		{
+			// The first stage is vectorised over four butterflies, the outputs are transposed
+			// because the four results of one butterfly are stored next to each other
+			for (int p = 0; p < m; p += 4)
+			{
+				Vec yR[4], yI[4];
+
+				butterfly(load(xr + p), load(xi + p), load(xr + p + m), load(xi + p + m),
+						  load(xr + p + 2 * m), load(xi + p + 2 * m), load(xr + p + 3 * m), load(xi + p + 3 * m),
+						  load(w1r + p), load(w1i + p), load(w2r + p), load(w2i + p), load(w3r + p), load(w3i + p), yR, yI);
+
+				transpose(yR[0], yR[1], yR[2], yR[3]);
+				transpose(yI[0], yI[1], yI[2], yI[3]);
+
+				for (int k = 0; k < 4; k++)
+				{
+					store(yr + 4 * (p + k), yR[k]);
+					store(yi + 4 * (p + k), yI[k]);
+				}
+			}
+
+			return;
+		}
+#endif
+
+		for (int p = 0; p < m; p++)
+		{
+			for (int q = 0; q < s; q++)
+			{
+				butterfly(xr, xi, yr, yi,
+						  q + s * p, q + s * (p + m), q + s * (p + 2 * m), q + s * (p + 3 * m),
+						  q + s * (4 * p), q + s * (4 * p + 1), q + s * (4 * p + 2), q + s * (4 * p + 3),
+						  w1r[p], w1i[p], w2r[p], w2i[p], w3r[p], w3i[p]);
+			}
+		}
+	}
+
+	static void radix2Stage(const float* xr, const float* xi, float* yr, float* yi, int s) noexcept
+	{
+		int q = 0;
+
+#if HISE_FFT_USE_SIMD
+		using namespace FFTSimd;
+
+		for (; q + 4 <= s; q += 4)
+		{
+			const Vec aR = load(xr + q);
+			const Vec aI = load(xi + q);
+			const Vec bR = load(xr + q + s);
+			const Vec bI = load(xi + q + s);
+
+			store(yr + q, add(aR, bR));
+			store(yi + q, add(aI, bI));
+			store(yr + q + s, sub(aR, bR));
+			store(yi + q + s, sub(aI, bI));
+		}
+#endif
+
+		for (; q < s; q++)
+		{
+			const float aR = xr[q];
+			const float aI = xi[q];
+			const float bR = xr[q + s];
+			const float bI = xi[q + s];
+
+			yr[q] = aR + bR;
+			yi[q] = aI + bI;
+			yr[q + s] = aR - bR;
+			yi[q + s] = aI - bI;
+		}
+	}
+
+	struct Stage
+	{
+		int length;
+		int stride;
+		int twiddleOffset;
+	};
+
+	const int n;
+	bool needsRadix2Stage;
+
+	Array<Stage> stages;
+	HeapBlock<float> twiddles;
+
+	JUCE_DECLARE_NON_COPYABLE(ComplexEngine)
+};
+
+HiseFFT::HiseFFT(int size_) :
+	size(size_)
+{
+	jassert(isPowerOfTwo(size) && size >= 4);
+
+#if USE_IPP
+	const int order = roundToInt(std::log2((double)size));
+
+	if (order < IPP_FFT_MAX_POWER_OF_TWO)
+	{
+		ippRealFFT = new IppFFT(IppFFT::DataType::RealFloat, order + 1);
+		ippComplexFFT = new IppFFT(IppFFT::DataType::ComplexFloat, order + 1);
+		return;
+	}
+#endif
+
+	const int h = size / 2;
+
+	halfSizeEngine = new ComplexEngine(h);
+	fullSizeEngine = new ComplexEngine(size);
+
+	realTwiddles.malloc(2 * h);
+
+	for (int k = 0; k < h; k++)
+	{
+		const double phase = 2.0 * double_Pi * (double)k / (double)size;
+
+		realTwiddles[2 * k] = (float)(-std::sin(phase));
+		realTwiddles[2 * k + 1] = (float)(-std::cos(phase));
+	}
+
+	workBuffer.malloc(4 * size);
+}
+
+HiseFFT::~HiseFFT()
+{
+	halfSizeEngine = nullptr;
+	fullSizeEngine = nullptr;
+}
+
+HiseFFT::Backend HiseFFT::getBackend() const noexcept
+{
+#if USE_IPP
+	if (ippRealFFT != nullptr)
+		return Backend::IPP;
+#endif
+
+	return Backend::Portable;
+}
+
+String HiseFFT::getBackendName() const
+{
+	if (getBackend() == Backend::IPP)
+		return "IPP";
+
+	return "Portable (" + FFTSimd::getInstructionSetName() + ")";
+}
+
+void HiseFFT::realFFT(const float* in, float* out) const noexcept
+{
+#if USE_IPP
+	if (ippRealFFT != nullptr)
+	{
+		if (in != out)
+			FloatVectorOperations::copy(out, in, size);
+
+		ippRealFFT->realFFTInplace(out, size);
+		return;
+	}
+#endif
+
+	// The real signal is treated as complex signal with half the size (even samples are the real parts)
+	const int h = size / 2;
+
+	float* re = workBuffer;
+	float* im = workBuffer + h;
+
+	for (int k = 0; k < h; k++)
+	{
+		re[k] = in[2 * k];
+		im[k] = in[2 * k + 1];
+	}
+
+	if (halfSizeEngine->forward(re, im, workBuffer + 2 * h, workBuffer + 3 * h))
+	{
+		re = workBuffer + 2 * h;
+		im = workBuffer + 3 * h;
+	}
+
+	out[0] = re[0] + im[0];
+	out[1] = re[0] - im[0];
+
+	for (int k = 1; k < h; k++)
+	{
+		const float zkR = re[k];
+		const float zkI = im[k];
+		const float zcR = re[h - k];
+		const float zcI = -im[h - k];
+
+		const float eR = 0.5f * (zkR + zcR);
+		const float eI = 0.5f * (zkI + zcI);
+		const float oR = 0.5f * (zkR - zcR);
+		const float oI = 0.5f * (zkI - zcI);
+
+		const float tR = realTwiddles[2 * k];
+		const float tI = realTwiddles[2 * k + 1];
+
+		out[2 * k] = eR + (tR * oR - tI * oI);
+		out[2 * k + 1] = eI + (tR * oI + tI * oR);
+	}
+}
+
+void HiseFFT::realFFTInverse(const float* in, float* out) const noexcept
+{
+#if USE_IPP
+	if (ippRealFFT != nullptr)
+	{
+		if (in != out)
+			FloatVectorOperations::copy(out, in, size);
+
+		ippRealFFT->realFFTInverseInplace(out, size);
+		return;
+	}
+#endif
+
+	const int h = size / 2;
+
+	float* re = workBuffer;
+	float* im = workBuffer + h;
+
+	for (int k = 0; k < h; k++)
+	{
+		const float xkR = in[2 * k];
+		const float xkI = k == 0 ? 0.0f : in[2 * k + 1];
+		const float xcR = k == 0 ? in[1] : in[2 * (h - k)];
+		const float xcI = k == 0 ? 0.0f : -in[2 * (h - k) + 1];
+
+		const float eR = xkR + xcR;
+		const float eI = xkI + xcI;
+		const float dR = xkR - xcR;
+		const float dI = xkI - xcI;
+
+		const float tR = realTwiddles[2 * k];
+		const float tI = realTwiddles[2 * k + 1];
+
+		// The inverse transform is calculated as conj(fft(conj(x)))
+		re[k] = eR + tR * dR + tI * dI;
+		im[k] = -(eI + tR * dI - tI * dR);
+	}
+
+	if (halfSizeEngine->forward(re, im, workBuffer + 2 * h, workBuffer + 3 * h))
+	{
+		re = workBuffer + 2 * h;
+		im = workBuffer + 3 * h;
+	}
+
+	for (int k = 0; k < h; k++)
+	{
+		out[2 * k] = re[k];
+		out[2 * k + 1] = -im[k];
+	}
+}
+
+void HiseFFT::complexFFT(const float* in, float* out) const noexcept
+{
+#if USE_IPP
+	if (ippComplexFFT != nullptr)
+	{
+		if (in != out)
+			FloatVectorOperations::copy(out, in, 2 * size);
+
+		ippComplexFFT->complexFFTInplace(out, size);
+		return;
+	}
+#endif
+
+	float* re = workBuffer;
+	float* im = workBuffer + size;
+
+	for (int k = 0; k < size; k++)
+	{
+		re[k] = in[2 * k];
+		im[k] = in[2 * k + 1];
+	}
+
+	if (fullSizeEngine->forward(re, im, workBuffer + 2 * size, workBuffer + 3 * size))
+	{
+		re = workBuffer + 2 * size;
+		im = workBuffer + 3 * size;
+	}
+
+	for (int k = 0; k < size; k++)
+	{
+		out[2 * k] = re[k];
+		out[2 * k + 1] = im[k];
+	}
+}
+
+void HiseFFT::complexFFTInverse(const float* in, float* out) const noexcept
+{
+#if USE_IPP
+	if (ippComplexFFT != nullptr)
+	{
+		if (in != out)
+			FloatVectorOperations::copy(out, in, 2 * size);
+
+		ippComplexFFT->complexFFTInverseInplace(out, size);
+		return;
+	}
+#endif
+
+	float* re = workBuffer;
+	float* im = workBuffer + size;
+
+	for (int k = 0; k < size; k++)
+	{
+		re[k] = in[2 * k];
+		im[k] = -in[2 * k + 1];
+	}
+
+	if (fullSizeEngine->forward(re, im, workBuffer + 2 * size, workBuffer + 3 * size))
+	{
+		re = workBuffer + 2 * size;
+		im = workBuffer + 3 * size;
+	}
+
+	for (int k = 0; k < size; k++)
+	{
+		out[2 * k] = re[k];
+		out[2 * k + 1] = -im[k];
+	}
+}
+
+} // namespace hise
@@ -0,0 +1,131 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#ifndef HISEFFT_H_INCLUDED
+#define HISEFFT_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** A FFT for power of two sizes that is fast on every platform.
+*
+*	This is the FFT that should be used throughout HISE. If USE_IPP is enabled, it forwards the transforms to IppFFT,
+*	otherwise it uses a portable radix-4 Stockham algorithm which is vectorised with SSE2 or NEON.
+*
+*	Create one object per FFT size (the constructor allocates the twiddle tables and the work buffer) and then call the
+*	transforms. Because of the work buffer, one object must not be used by multiple threads at the same time.
+*
+*	The transforms are not scaled, so you have to multiply the result of an inverse transform with 1 / size.
+*
+*		HiseFFT fft(1024);
+*		fft.realFFTInplace(data);
+*/
+class HiseFFT
+{
+public:
+
+	enum class Backend
+	{
+		Portable = 0,
+		IPP,
+		numBackends
+	};
+
+	/** Creates a FFT object for the given size. The size must be a power of two and at least 4. */
+	explicit HiseFFT(int size);
+
+	~HiseFFT();
+
+	int getSize() const noexcept { return size; }
+
+	/** Returns the backend that is used for this object. */
+	Backend getBackend() const noexcept;
+
+	/** Returns a description of the backend and the instruction set that is used for this object (eg. for benchmarks). */
+	String getBackendName() const;
+
+	// ==================================================================================================================================== real FFTs
+
+	/** Real forward FFT.
+	*
+	*	Input: in[] = re[0],re[1],..,re[size-1].
+	*	Output: out[] = re[0],*re[size/2]*,re[1],im[1],..,re[size/2-1],im[size/2-1] (the same format as IppFFT).
+	*
+	*	in and out can be the same array.
+	*/
+	void realFFT(const float* in, float* out) const noexcept;
+
+	/** Real forward FFT that overwrites the input with the spectrum. */
+	void realFFTInplace(float* data) const noexcept { realFFT(data, data); }
+
+	/** Real inverse FFT. The input must have the format that is created by realFFT(). */
+	void realFFTInverse(const float* in, float* out) const noexcept;
+
+	void realFFTInverseInplace(float* data) const noexcept { realFFTInverse(data, data); }
+
+	// ==================================================================================================================================== complex FFTs
+
+	/** Complex forward FFT of size interleaved complex values (re, im, re, im...). in and out can be the same array. */
+	void complexFFT(const float* in, float* out) const noexcept;
+
+	void complexFFTInplace(float* data) const noexcept { complexFFT(data, data); }
+
+	/** Complex inverse FFT of size interleaved complex values. */
+	void complexFFTInverse(const float* in, float* out) const noexcept;
+
+	void complexFFTInverseInplace(float* data) const noexcept { complexFFTInverse(data, data); }
+
+private:
+
+	class ComplexEngine;
+
+	const int size;
+
+	ScopedPointer<ComplexEngine> halfSizeEngine;
+	ScopedPointer<ComplexEngine> fullSizeEngine;
+
+	/** -i * e^(-2*pi*i*k/size) for the split of the real FFT into a half size complex FFT. */
+	HeapBlock<float> realTwiddles;
+
+	mutable HeapBlock<float> workBuffer;
+
+#if USE_IPP
+	ScopedPointer<IppFFT> ippRealFFT;
+	ScopedPointer<IppFFT> ippComplexFFT;
+#endif
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HiseFFT)
+};
+
+} // namespace hise
+
+#endif  // HISEFFT_H_INCLUDED
@@ -0,0 +1,222 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class HiseFFTUnitTest : public UnitTest
+{
+public:
+
+	HiseFFTUnitTest() :
+		UnitTest("Testing the HISE FFT")
+	{
+
+	}
+
+	void runTest() override
+	{
+		for (int size = 4; size <= 4096; size *= 2)
+		{
+			testRealFFT(size);
+			testComplexFFT(size);
+		}
+
+		testPerformance();
+	}
+
+private:
+
+	/** Compares the result against a naive DFT. The error is relative to the biggest magnitude. */
+	void testRealFFT(int size)
+	{
+		beginTest("Testing real FFT with size " + String(size));
+
+		HiseFFT fft(size);
+
+		HeapBlock<float> input(size);
+		HeapBlock<float> spectrum(size);
+		HeapBlock<float> output(size);
+
+		for (int i = 0; i < size; i++)
+			input[i] = r.nextFloat() * 2.0f - 1.0f;
+
+		fft.realFFT(input, spectrum);
+
+		double maxError = 0.0;
+		double maxMagnitude = 0.0;
+
+		for (int k = 0; k <= size / 2; k++)
+		{
+			const auto expected = calculateDFTBin(input, nullptr, size, k);
+
+			std::complex<double> actual;
+
+			if (k == 0)				actual = std::complex<double>(spectrum[0], 0.0);
+			else if (k == size / 2) actual = std::complex<double>(spectrum[1], 0.0);
+			else					actual = std::complex<double>(spectrum[2 * k], spectrum[2 * k + 1]);
+
+			maxError = jmax(maxError, std::abs(expected - actual));
+			maxMagnitude = jmax(maxMagnitude, std::abs(expected));
+		}
+
+		expect(maxError / maxMagnitude < 1e-5, "Real FFT error: " + String(maxError / maxMagnitude));
+
+		fft.realFFTInverse(spectrum, output);
+
+		FloatVectorOperations::multiply(output, 1.0f / (float)size, size);
+
+		for (int i = 0; i < size; i++)
+		{
+			if (std::abs(output[i] - input[i]) > 1e-5f)
+			{
+				expect(false, "Inverse real FFT mismatch at " + String(i));
+				break;
+			}
+		}
+	}
+
+	void testComplexFFT(int size)
+	{
+		beginTest("Testing complex FFT with size " + String(size));
+
+		HiseFFT fft(size);
+
+		HeapBlock<float> input(2 * size);
+		HeapBlock<float> spectrum(2 * size);
+		HeapBlock<float> re(size);
+		HeapBlock<float> im(size);
+
+		for (int i = 0; i < size; i++)
+		{
+			re[i] = r.nextFloat() * 2.0f - 1.0f;
+			im[i] = r.nextFloat() * 2.0f - 1.0f;
+
+			input[2 * i] = re[i];
+			input[2 * i + 1] = im[i];
+		}
+
+		fft.complexFFT(input, spectrum);
+
+		double maxError = 0.0;
+		double maxMagnitude = 0.0;
+
+		for (int k = 0; k < size; k++)
+		{
+			const auto expected = calculateDFTBin(re, im, size, k);
+			const std::complex<double> actual(spectrum[2 * k], spectrum[2 * k + 1]);
+
+			maxError = jmax(maxError, std::abs(expected - actual));
+			maxMagnitude = jmax(maxMagnitude, std::abs(expected));
+		}
+
+		expect(maxError / maxMagnitude < 1e-5, "Complex FFT error: " + String(maxError / maxMagnitude));
+
+		fft.complexFFTInverseInplace(spectrum);
+
+		FloatVectorOperations::multiply(spectrum, 1.0f / (float)size, 2 * size);
+
+		for (int i = 0; i < 2 * size; i++)
+		{
+			if (std::abs(spectrum[i] - input[i]) > 1e-5f)
+			{
+				expect(false, "Inverse complex FFT mismatch at " + String(i));
+				break;
+			}
+		}
+	}
+
+	/** Benchmarks the real forward FFT against the JUCE FFT. */
+	void testPerformance()
+	{
+		beginTest("Benchmarking the real FFT");
+
+		for (int order = 6; order <= 16; order += 2)
+		{
+			const int size = 1 << order;
+			const int numRuns = jmax<int>(10, (1 << 22) / size);
+
+			HiseFFT fft(size);
+			dsp::FFT juceFFT(order);
+
+			HeapBlock<float> data(2 * size, true);
+
+			for (int i = 0; i < size; i++)
+				data[i] = r.nextFloat() * 2.0f - 1.0f;
+
+			double start = Time::getMillisecondCounterHiRes();
+
+			for (int i = 0; i < numRuns; i++)
+				fft.realFFTInplace(data);
+
+			const double hiseTime = (Time::getMillisecondCounterHiRes() - start) / (double)numRuns;
+
+			start = Time::getMillisecondCounterHiRes();
+
+			for (int i = 0; i < numRuns; i++)
+				juceFFT.performRealOnlyForwardTransform(data, true);
+
+			const double juceTime = (Time::getMillisecondCounterHiRes() - start) / (double)numRuns;
+
+			logMessage("Size " + String(size) + ": " + fft.getBackendName() + ": " + String(hiseTime * 1000.0, 2) + " us, JUCE: " + String(juceTime * 1000.0, 2) + " us");
+		}
+	}
+
+	static std::complex<double> calculateDFTBin(const float* re, const float* im, int size, int k)
+	{
+		std::complex<double> sum;
+
+		for (int i = 0; i < size; i++)
+		{
+			const std::complex<double> x(re[i], im != nullptr ? im[i] : 0.0f);
+			sum += x * std::polar(1.0, -2.0 * double_Pi * (double)((int64)k * i % size) / (double)size);
+		}
+
+		return sum;
+	}
+
+	Random r;
+};
+
+static HiseFFTUnitTest hiseFFTUnitTest;
+
+} // namespace hise
+
+#endif
@@ -105,6 +105,7 @@ Array<juce::Identifier> HiseSettings::Scripting::getAllIds()
 	Array<Identifier> ids;
 
 	ids.add(EnableCallstack);
+	ids.add(EnableAudioThreadSafeMode);
 	ids.add(GlobalScriptPath);
 	ids.add(CompileTimeout);
 	ids.add(CodeFontSize);
@@ -307,6 +308,12 @@ struct SettingDescription
 		D("Double clicking on the line in the console jumps to each location.");
 		P_();
 
+		P(HiseSettings::Scripting::EnableAudioThreadSafeMode);
+		D("Runs the MIDI callbacks and the synchronous timer callback of script processors in an allocation free mode.");
+		D("Object and array literals reuse their storage between calls and every remaining allocation on the audio thread is reported to the console with its line number.  ");
+		D("If the debug mode is enabled, the first allocation of each callback will also be written to the debug log.");
+		P_();
+
 		P(HiseSettings::Scripting::CompileTimeout);
 		D("Sets the timeout for the compilation of a script in **seconds**. Whenever the compilation takes longer, it will abort and show a error message.");
 		D("This prevents hanging if you accidentally create endless loops like this:");
@@ -446,6 +453,7 @@ juce::StringArray HiseSettings::Data::getOptionsFor(const Identifier& id)
 	if (id == Project::EmbedAudioFiles ||
 		id == Compiler::UseIPP ||
 		id == Scripting::EnableCallstack ||
+		id == Scripting::EnableAudioThreadSafeMode ||
 		id == Other::EnableAutosave ||
 		id == Scripting::EnableDebugMode)
 		return { "Yes", "No" };
@@ -590,6 +598,7 @@ var HiseSettings::Data::getDefaultSetting(const Identifier& id)
 	else if (id == Other::AutosaveInterval)			return 5;
 	else if (id == Scripting::CodeFontSize)			return 17.0;
 	else if (id == Scripting::EnableCallstack)		return "No";
+	else if (id == Scripting::EnableAudioThreadSafeMode) return "No";
 	else if (id == Scripting::CompileTimeout)		return 5.0;
 	else if (id == Compiler::VisualStudioVersion)	return "Visual Studio 2017";
 	else if (id == Compiler::UseIPP)				return "Yes";
@@ -720,6 +729,9 @@ void HiseSettings::Data::settingWasChanged(const Identifier& id, const var& newV
 	if (id == Scripting::EnableCallstack)
 		mc->updateCallstackSettingForExistingScriptProcessors();
 
+	else if (id == Scripting::EnableAudioThreadSafeMode)
+		mc->updateAudioThreadSafeModeForExistingScriptProcessors();
+
 	else if (id == Scripting::CodeFontSize)
 		mc->getFontSizeChangeBroadcaster().sendChangeMessage();
 
@@ -103,6 +103,7 @@ Array<Identifier> getAllIds();
 namespace Scripting
 {
 DECLARE_ID(EnableCallstack);
+DECLARE_ID(EnableAudioThreadSafeMode);
 DECLARE_ID(GlobalScriptPath);
 DECLARE_ID(CompileTimeout);
 DECLARE_ID(CodeFontSize);
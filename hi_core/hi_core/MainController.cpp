@@ -63,8 +63,10 @@ MainController::MainController():
 	userPresetHandler(this),
 	codeHandler(this),
 	processorChangeHandler(this),
+	keyboardState(eventInbox),
 	killStateHandler(this),
 	debugLogger(this),
+	realtimeWorkerPool(jlimit<int>(0, jmax<int>(0, SystemStats::getNumCpus() - 1), HISE_NUM_AUDIO_WORKER_THREADS)),
 	//presetLoadRampFlag(OldUserPresetHandler::Active),
 	suspendIndex(0),
 	controlUndoManager(new UndoManager())
@@ -88,11 +90,19 @@ MainController::MainController():
     
 #if HI_RUN_UNIT_TESTS
 
-	UnitTestRunner runner;
+	// Some tests create their own MainController (UnitTestAudioProcessor), so this must not run the tests again.
+	static bool unitTestsAreRunning = false;
 
-	runner.setAssertOnFailure(false);
+	if (!unitTestsAreRunning)
+	{
+		ScopedValueSetter<bool> svs(unitTestsAreRunning, true);
+
+		UnitTestRunner runner;
 
-	runner.runAllTests();
+		runner.setAssertOnFailure(false);
+
+		runner.runAllTests();
+	}
 
 	
 
@@ -596,16 +606,25 @@ void MainController::processBlockCommon(AudioSampleBuffer &buffer, MidiBuffer &m
 		prepareToPlay(sampleRate, buffer.getNumSamples());
 	}
 
+	userPresetHandler.commitPendingPreset();
+
 #if !FRONTEND_IS_PLUGIN
     
-	keyboardState.processNextMidiBuffer(midiMessages, 0, buffer.getNumSamples(), true);
+	keyboardState.updateFromMidiInput(midiMessages);
 
+	getMacroManager().getMidiControlAutomationHandler()->handleParameterData(midiMessages); // TODO_BUFFER: Move this after the next line...
 
+	masterEventBuffer.addEvents(midiMessages);
 
+	eventInbox.popAllInto(masterEventBuffer, buffer.getNumSamples());
 
-	getMacroManager().getMidiControlAutomationHandler()->handleParameterData(midiMessages); // TODO_BUFFER: Move this after the next line...
+	const int numDroppedEvents = masterEventBuffer.getNumDroppedEvents() + eventInbox.getAndResetNumDroppedEvents();
 
-	masterEventBuffer.addEvents(midiMessages);
+	if (numDroppedEvents != 0)
+	{
+		getDebugLogger().addEventBufferOverflow(nullptr, numDroppedEvents);
+		masterEventBuffer.resetDroppedEventCounter();
+	}
 
 	killStateHandler.handleKillState();
 
@@ -798,6 +817,8 @@ void MainController::prepareToPlay(double sampleRate_, int samplesPerBlock)
     
 	bufferSize = samplesPerBlock;
 	sampleRate = sampleRate_;
+
+	masterEventBuffer.ensureCapacity(samplesPerBlock);
  
 	// Prevent high buffer sizes from blowing up the 350MB limitation...
 	if (HiseDeviceSimulator::isAUv3())
@@ -834,6 +855,9 @@ void MainController::prepareToPlay(double sampleRate_, int samplesPerBlock)
 
     getMainSynthChain()->prepareToPlay(sampleRate, bufferSize.get());
 
+	// The deadlines depend on the audio buffer size, so the old statistics don't apply anymore
+	getSampleManager().getGlobalSampleThreadPool()->resetDeadlineStatistics();
+
 	getMainSynthChain()->setIsOnAir(true);
 }
 
@@ -1129,6 +1153,7 @@ MainController::SampleManager::~SampleManager()
 	const bool ok = samplerLoaderThreadPool->stopThread(2000);
 	
 	samplerLoaderThreadPool = nullptr;
+	preloadThreadPool = nullptr;
 }
 
 void MainController::SampleManager::setShouldSkipPreloading(bool skip)
@@ -1143,7 +1168,7 @@ void MainController::SampleManager::preloadEverything()
 
 	skipPreloading = false;
 	
-	jassert(mc->getKillStateHandler().voicesAreKilled());
+	// Samplers with a pending sample load kill their own voices, so this works with gapless preset loading too
 
 	Processor::Iterator<ModulatorSampler> it(mc->getMainSynthChain());
 
@@ -103,6 +103,13 @@ public:
 		/** returns a pointer to the thread pool that streams the samples from disk. */
 		SampleThreadPool *getGlobalSampleThreadPool() { return samplerLoaderThreadPool; }
 
+		/** returns the thread pool that preloads the samples in parallel. 
+		*
+		*	This will return nullptr if HISE_NUM_PRELOAD_THREADS is zero or the HDD mode is enabled (where parallel
+		*	reading would slow things down).
+		*/
+		ThreadPool* getPreloadThreadPool() { return hddMode ? nullptr : preloadThreadPool.get(); }
+
 		/** returns a pointer to the global sample pool */
 		ModulatorSamplerSoundPool *getModulatorSamplerSoundPool() const { return globalSamplerSoundPool; }
 
@@ -217,6 +224,7 @@ public:
 		ScopedPointer<ImagePool> globalImagePool;
 		ScopedPointer<ModulatorSamplerSoundPool> globalSamplerSoundPool;
 		ScopedPointer<SampleThreadPool> samplerLoaderThreadPool;
+		ScopedPointer<ThreadPool> preloadThreadPool;
 
 		bool hddMode = false;
 		bool skipPreloading = false;
@@ -355,9 +363,47 @@ public:
 			WeakReference<Listener>::Master masterReference;
 		};
 
-		UserPresetHandler(MainController* mc_) :
-			mc(mc_)
-		{};
+		/** Swaps the prepared state of a user preset at the next block boundary.
+		*
+		*	The loading thread does all the expensive work before it calls commitAndWait() with a function that only swaps
+		*	the prepared state. The audio thread calls this function at the start of the next block, so the MIDI automation
+		*	and the modulated parameters change at once. The output is not faded or muted.
+		*/
+		class PresetCommitter
+		{
+		public:
+
+			enum State
+			{
+				Idle = 0,
+				Pending,
+				Committing
+			};
+
+			PresetCommitter();
+
+			/** Waits until the audio thread has called the swap function.
+			*
+			*	If there is no audio callback, the function is called on this thread after the timeout.
+			*/
+			void commitAndWait(const std::function<void()>& swapFunction, int timeoutMs=500);
+
+			/** Call this at the start of the audio callback. */
+			void commitIfPending();
+
+			State getState() const { return (State)state.load(); }
+
+		private:
+
+			std::atomic<int> state;
+			std::function<void()> pendingSwapFunction;
+			WaitableEvent committed;
+
+			JUCE_DECLARE_NON_COPYABLE(PresetCommitter);
+		};
+
+		UserPresetHandler(MainController* mc_);
+		~UserPresetHandler();
 
 		void incPreset(bool next, bool stayInSameDirectory);
 		void loadUserPreset(const ValueTree& v);
@@ -372,11 +418,58 @@ public:
 		void addListener(Listener* listener);
 		void removeListener(Listener* listener);
 
+		/** Swaps the state of a prepared user preset. This is called at the start of the audio callback. */
+		void commitPendingPreset() { committer.commitIfPending(); }
+
 	private:
 
+		/** The state of a user preset that is created before it is swapped in. */
+		struct PreparedPreset;
+
+		/** Loads the most recent preset on the sample loading thread without killing the voices. */
+		class PresetLoadingJob : public SampleThreadPool::Job
+		{
+		public:
+
+			PresetLoadingJob(UserPresetHandler& parent_) :
+				Job("User Preset Loading"),
+				parent(parent_)
+			{};
+
+			JobStatus runJob() override;
+
+			UserPresetHandler& parent;
+
+		private:
+
+			void loadPreset(const ValueTree& v);
+		};
+
+		/** Restores the controls, preloads the samples and creates the rest of the state while the audio is still playing.
+		*
+		*	The control values are applied immediately like any other control change because their callbacks can't be
+		*	executed on the audio thread. Only the MIDI automation and the modulated parameters are swapped at the block boundary.
+		*/
+		void prepareUserPreset(const ValueTree& v, PreparedPreset& p);
+
+		/** Swaps the prepared state. This must not allocate because it is called on the audio thread. */
+		void swapUserPreset(PreparedPreset& p);
+
+		void sendPresetChangeMessage();
+
 		void loadUserPresetInternal(const ValueTree& v);
 		void saveUserPresetInternal(const String& name=String());
 
+		PresetLoadingJob loadingJob;
+
+		SpinLock pendingPresetLock;
+		ValueTree pendingPreset;
+
+		// Set while the loading job is queued or running, guarded by the pendingPresetLock
+		bool loadingJobIsPending = false;
+
+		PresetCommitter committer;
+
 		Array<WeakReference<Listener>> listeners;
 
 		File currentlyLoadedFile;
@@ -782,6 +875,10 @@ public:
 
 	DebugLogger& getDebugLogger() { return debugLogger; }
 	const DebugLogger& getDebugLogger() const { return debugLogger; }
+
+	/** Returns the worker pool that can be used by the audio thread to render in parallel. */
+	RealtimeWorkerPool& getRealtimeWorkerPool() { return realtimeWorkerPool; }
+	const RealtimeWorkerPool& getRealtimeWorkerPool() const { return realtimeWorkerPool; }
     
 	void setBufferToPlay(const AudioSampleBuffer& buffer)
 	{
@@ -923,6 +1020,12 @@ public:
 
 	EventIdHandler& getEventHandler() { return eventIdHandler; }
 
+	/** Returns the inbox that can be used to send events to the audio thread from any other thread.
+	*
+	*	The events are added to the master event buffer at the start of the next audio callback.
+	*/
+	HiseEventInbox& getEventInbox() { return eventInbox; }
+
 	void setSkipCompileAtPresetLoad(bool shouldSkip)
 	{
 		skipCompilingAtPresetLoad = shouldSkip;
@@ -1137,6 +1240,7 @@ private:
 	bool replaceBufferContent = true;
 
 	HiseEventBuffer masterEventBuffer;
+	HiseEventInbox eventInbox;
 	EventIdHandler eventIdHandler;
 	UserPresetHandler userPresetHandler;
 	ProcessorChangeHandler processorChangeHandler;
@@ -1208,6 +1312,8 @@ private:
 
 	DebugLogger debugLogger;
 
+	RealtimeWorkerPool realtimeWorkerPool;
+
 #if USE_BACKEND
     
 	
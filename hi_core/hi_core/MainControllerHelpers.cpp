@@ -297,7 +297,20 @@ void MidiControllerAutomationHandler::restoreFromValueTree(const ValueTree &v)
 {
 	if (v.getType() != Identifier("MidiAutomation")) return;
 
-	clear();
+	PreparedData d;
+	prepareFromValueTree(v, d);
+
+	{
+		ScopedLock sl(mc->getLock());
+		swapPreparedData(d);
+	}
+
+	sendChangeMessage();
+}
+
+void MidiControllerAutomationHandler::prepareFromValueTree(const ValueTree& v, PreparedData& d) const
+{
+	if (v.getType() != Identifier("MidiAutomation")) return;
 
 	for (int i = 0; i < v.getNumChildren(); i++)
 	{
@@ -305,7 +318,7 @@ void MidiControllerAutomationHandler::restoreFromValueTree(const ValueTree &v)
 
 		int controller = cc.getProperty("Controller", 1);
 
-		auto& aArray = automationData[controller];
+		auto& aArray = d.automationData[controller];
 
 		AutomationData a;
 		a.mc = mc;
@@ -313,11 +326,19 @@ void MidiControllerAutomationHandler::restoreFromValueTree(const ValueTree &v)
 		a.restoreFromValueTree(cc);
 
 		aArray.addIfNotAlreadyThere(a);
+
+		d.anyUsed |= a.used;
 	}
+}
 
-	sendChangeMessage();
+void MidiControllerAutomationHandler::swapPreparedData(PreparedData& d)
+{
+	for (int i = 0; i < 128; i++)
+		automationData[i].swapWith(d.automationData[i]);
 
-	refreshAnyUsedState();
+	std::swap(anyUsed, d.anyUsed);
+
+	unlearnedData = AutomationData();
 }
 
 void MidiControllerAutomationHandler::handleParameterData(MidiBuffer &b)
@@ -159,6 +159,19 @@ public:
 		bool used;
 	};
 
+	/** The automation data of a user preset that is created before it is swapped in. */
+	struct PreparedData
+	{
+		Array<AutomationData> automationData[128];
+		bool anyUsed = false;
+	};
+
+	/** Creates the automation data from the given ValueTree without changing the current state. */
+	void prepareFromValueTree(const ValueTree& v, PreparedData& d) const;
+
+	/** Swaps the prepared data with the current state. This doesn't allocate, so you can call it on the audio thread. */
+	void swapPreparedData(PreparedData& d);
+
 	/** Returns a copy of the automation data for the given index. */
 	AutomationData getDataFromIndex(int index) const;
 
@@ -597,9 +597,24 @@ void BorderPanel::buttonClicked(Button* /*b*/)
 	}
 }
 
+void DisplayList::addAction(Action* newAction)
+{
+	canvasNeeded |= newAction->needsCanvas();
+	actions.add(newAction);
+}
+
+void DisplayList::draw(Graphics& g, Image* canvas) const
+{
+	for (auto a : actions)
+		a->perform(g, canvas);
+}
+
 void BorderPanel::changeListenerCallback(SafeChangeBroadcaster* b)
 {
-    image = dynamic_cast<ScriptingApi::Content::ScriptPanel::RepaintNotifier*>(b)->panel->getImage();
+	auto panel = dynamic_cast<ScriptingApi::Content::ScriptPanel::RepaintNotifier*>(b)->panel;
+
+    image = panel->getImage();
+	displayList = panel->getDisplayList();
     
     if(isShowing())
         repaint();
@@ -614,7 +629,36 @@ void BorderPanel::paint(Graphics &g)
 		g.setColour(Colours::black);
 		g.setOpacity(1.0f);
 		
-        g.drawImageWithin(image, 0, 0, getWidth() , getHeight(), RectanglePlacement::centred);
+		if (displayList == nullptr)
+		{
+			g.drawImageWithin(image, 0, 0, getWidth(), getHeight(), RectanglePlacement::centred);
+		}
+		else if (!displayList->needsCanvas())
+		{
+			Graphics::ScopedSaveState ss(g);
+			displayList->draw(g, nullptr);
+		}
+		else
+		{
+			// Some actions need to read the pixels, so the list is drawn on an image with the physical resolution
+			const float scaleFactor = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+			const int w = roundToInt((float)getWidth() * scaleFactor);
+			const int h = roundToInt((float)getHeight() * scaleFactor);
+
+			if (w <= 0 || h <= 0)
+				return;
+
+			Image canvas(Image::PixelFormat::ARGB, w, h, !isOpaque());
+
+			{
+				Graphics cg(canvas);
+				cg.addTransform(AffineTransform::scale(scaleFactor));
+				displayList->draw(cg, &canvas);
+			}
+
+			g.drawImageWithin(canvas, 0, 0, getWidth(), getHeight(), RectanglePlacement::centred);
+		}
 	}
 	else
 	{
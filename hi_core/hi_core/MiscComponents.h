@@ -232,6 +232,51 @@ private:
 
 
 
+/** A list of recorded draw calls that can be replayed on any Graphics context.
+*
+*	The ScriptPanel records the calls of its paint routine into a DisplayList, so the BorderPanel can redraw itself
+*	without executing the script and without an intermediate image.
+*/
+class DisplayList : public ReferenceCountedObject
+{
+public:
+
+	using Ptr = ReferenceCountedObjectPtr<DisplayList>;
+
+	DisplayList() {};
+
+	/** A single recorded draw call. */
+	struct Action
+	{
+		virtual ~Action() {};
+
+		/** Performs the draw call. The canvas is the image that is drawn on or nullptr if the list is drawn directly. */
+		virtual void perform(Graphics& g, Image* canvas) const = 0;
+
+		/** Overwrite this and return true if the action needs to read the pixels of the canvas. */
+		virtual bool needsCanvas() const { return false; }
+	};
+
+	/** Adds an action to the end of the list. The list takes ownership. */
+	void addAction(Action* newAction);
+
+	/** Replays all actions in the order they were recorded. */
+	void draw(Graphics& g, Image* canvas) const;
+
+	/** Returns true if one of the actions can only be performed on an image. */
+	bool needsCanvas() const noexcept { return canvasNeeded; }
+
+	int getNumActions() const noexcept { return actions.size(); }
+
+private:
+
+	OwnedArray<Action> actions;
+	bool canvasNeeded = false;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DisplayList);
+};
+
+
 class BorderPanel : public MouseCallbackComponent,
                     public SafeChangeListener,
 					public SettableTooltipClient,
@@ -267,6 +312,7 @@ public:
 	float borderRadius;
 	float borderSize;
 	Image image;
+	DisplayList::Ptr displayList;
 	bool isUsingCustomImage;
 
 	bool isPopupPanel;
@@ -0,0 +1,190 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise { using namespace juce;
+
+class RealtimeWorkerPool::Worker : public Thread
+{
+public:
+
+	Worker(RealtimeWorkerPool& parent_, int threadIndex_) :
+		Thread("Audio Worker " + String(threadIndex_)),
+		parent(parent_),
+		threadIndex(threadIndex_)
+	{
+		sleeping.store(false);
+	}
+
+	~Worker()
+	{
+		signalThreadShouldExit();
+		wakeUp();
+		stopThread(1000);
+	}
+
+	void wakeUp()
+	{
+		if (sleeping.load(std::memory_order_seq_cst))
+			wakeUpEvent.signal();
+	}
+
+	void run() override
+	{
+		uint32 lastJob = parent.jobCounter.load();
+
+		while (!threadShouldExit())
+		{
+			if (!waitForNextJob(lastJob))
+				continue;
+
+			lastJob = parent.jobCounter.load(std::memory_order_acquire);
+
+			// This store -> load pair and the one in RealtimeWorkerPool::run() need sequential consistency,
+			// otherwise the caller might not see this worker and return while it still uses the job.
+			parent.numActiveWorkers.fetch_add(1, std::memory_order_seq_cst);
+
+			if (auto job = parent.currentJob.load(std::memory_order_seq_cst))
+				parent.processTasks(*job, threadIndex);
+
+			parent.numActiveWorkers.fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+
+private:
+
+	/** Spins for a few iterations (so that a job that is added right away is picked up immediately) and then goes to sleep. */
+	bool waitForNextJob(uint32 lastJob)
+	{
+		for (int i = 0; i < NumSpinsBeforeSleeping; i++)
+		{
+			if (parent.jobCounter.load(std::memory_order_acquire) != lastJob)
+				return true;
+
+			Thread::yield();
+		}
+
+		sleeping.store(true, std::memory_order_seq_cst);
+
+		// check again to catch a job that was added before the sleeping flag was set
+		if (parent.jobCounter.load(std::memory_order_seq_cst) == lastJob)
+			wakeUpEvent.wait(100);
+
+		sleeping.store(false);
+
+		return parent.jobCounter.load(std::memory_order_acquire) != lastJob;
+	}
+
+	static constexpr int NumSpinsBeforeSleeping = 64;
+
+	RealtimeWorkerPool& parent;
+	const int threadIndex;
+
+	WaitableEvent wakeUpEvent;
+	std::atomic<bool> sleeping;
+};
+
+RealtimeWorkerPool::RealtimeWorkerPool(int numWorkerThreads)
+{
+	currentJob.store(nullptr);
+	numTasksToProcess.store(0);
+	nextTaskIndex.store(0);
+	numTasksFinished.store(0);
+	numActiveWorkers.store(0);
+	jobCounter.store(0);
+
+	for (int i = 0; i < numWorkerThreads; i++)
+	{
+		workers.add(new Worker(*this, i + 1));
+		workers.getLast()->startThread(9);
+	}
+}
+
+RealtimeWorkerPool::~RealtimeWorkerPool()
+{
+	workers.clear();
+}
+
+void RealtimeWorkerPool::run(Job& job, int numTasks)
+{
+	if (numTasks <= 0)
+		return;
+
+	if (numTasks == 1 || workers.size() == 0)
+	{
+		for (int i = 0; i < numTasks; i++)
+			job.runTask(i, 0);
+
+		return;
+	}
+
+	// Another thread is using the pool or this is called from a task...
+	jassert(currentJob.load() == nullptr);
+
+	numTasksToProcess.store(numTasks);
+	nextTaskIndex.store(0);
+	numTasksFinished.store(0);
+	currentJob.store(&job, std::memory_order_release);
+
+	jobCounter.fetch_add(1, std::memory_order_seq_cst);
+
+	for (int i = 0; i < jmin<int>(workers.size(), numTasks - 1); i++)
+		workers.getUnchecked(i)->wakeUp();
+
+	processTasks(job, 0);
+
+	while (numTasksFinished.load(std::memory_order_acquire) < numTasks)
+		;
+
+	currentJob.store(nullptr, std::memory_order_seq_cst);
+
+	// Wait for the workers that are about to look for a task so that they don't pick up the next job's data
+	while (numActiveWorkers.load(std::memory_order_seq_cst) != 0)
+		;
+}
+
+int RealtimeWorkerPool::processTasks(Job& job, int threadIndex)
+{
+	const int numTasks = numTasksToProcess.load(std::memory_order_acquire);
+	int numProcessed = 0;
+
+	for (int i = nextTaskIndex++; i < numTasks; i = nextTaskIndex++)
+	{
+		job.runTask(i, threadIndex);
+		numTasksFinished.fetch_add(1, std::memory_order_release);
+		numProcessed++;
+	}
+
+	return numProcessed;
+}
+
+} // namespace hise
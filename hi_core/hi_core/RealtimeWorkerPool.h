@@ -0,0 +1,112 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+#ifndef REALTIMEWORKERPOOL_H_INCLUDED
+#define REALTIMEWORKERPOOL_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** A pool of worker threads that can be used by the audio thread to spread the rendering across multiple cores.
+*
+*	The audio thread calls run() with a Job and a number of tasks. The tasks will be distributed to the worker threads
+*	and the audio thread itself will process tasks until all of them are finished, so it doesn't have to wait for
+*	a worker to wake up if the job is small.
+*
+*	Calling run() does not allocate or lock (except for signalling sleeping worker threads), so it is safe to be
+*	called from the audio thread. The order in which the tasks are executed is not defined, so every task must write into
+*	its own buffer and the results must be combined by the calling thread after run() returns if you need deterministic output.
+*
+*	Only one thread can call run() at the same time, and you must not call run() from within a task.
+*/
+class RealtimeWorkerPool
+{
+public:
+
+	/** The interface class for the work that should be spread across the worker threads. */
+	class Job
+	{
+	public:
+
+		virtual ~Job() {};
+
+		/** Processes the task with the given index. 
+		*
+		*	The threadIndex is a number between 0 and getNumThreads() - 1 that can be used to select 
+		*	a scratch buffer for the thread that is executing the task. The calling thread has the index 0.
+		*/
+		virtual void runTask(int taskIndex, int threadIndex) = 0;
+	};
+
+	/** Creates a pool with the given amount of worker threads. */
+	RealtimeWorkerPool(int numWorkerThreads);
+
+	~RealtimeWorkerPool();
+
+	/** Executes all tasks of the given job and returns when every task was processed. */
+	void run(Job& job, int numTasks);
+
+	/** Returns the number of threads that can execute a task (including the calling thread). */
+	int getNumThreads() const noexcept { return workers.size() + 1; }
+
+	/** Returns true if the pool has worker threads. */
+	bool isEnabled() const noexcept { return workers.size() != 0; }
+
+	/** Returns true if a job is currently distributed to the worker threads. 
+	*
+	*	Check this before calling run() from code that might be executed by a task (eg. the rendering of a child synth).
+	*/
+	bool isBusy() const noexcept { return currentJob.load(std::memory_order_acquire) != nullptr; }
+
+private:
+
+	class Worker;
+
+	/** Processes tasks until there are no more tasks. Returns the number of processed tasks. */
+	int processTasks(Job& job, int threadIndex);
+
+	OwnedArray<Worker> workers;
+
+	std::atomic<Job*> currentJob;
+	std::atomic<int> numTasksToProcess;
+	std::atomic<int> nextTaskIndex;
+	std::atomic<int> numTasksFinished;
+	std::atomic<int> numActiveWorkers;
+	std::atomic<uint32> jobCounter;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeWorkerPool);
+};
+
+} // namespace hise
+
+#endif  // REALTIMEWORKERPOOL_H_INCLUDED
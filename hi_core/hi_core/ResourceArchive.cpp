@@ -0,0 +1,353 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise { using namespace juce;
+
+/* The archive layout (all numbers are little endian):
+*
+*	uint32 magic number ('HRA1')
+*	uint32 version
+*	uint32 number of entries
+*	uint32 size of the index in bytes
+*
+*	For every entry in the index:
+*	- the ID and the file name as null terminated UTF-8 strings
+*	- the additional data as double (the sample rate for audio files)
+*	- the offset of the data (relative to the end of the index) and its size as int64 
+*
+*	After the index, the file data of every entry follows.
+*/
+namespace ResourceArchiveFormat
+{
+	static const uint32 magicNumber = 0x31415248;
+	static const uint32 version = 1;
+	static const int headerSize = 4 * sizeof(uint32);
+}
+
+struct ResourceArchive::Registry
+{
+	CriticalSection lock;
+	ReferenceCountedArray<ResourceArchive> archives;
+};
+
+ResourceArchive::Registry& ResourceArchive::getRegistry()
+{
+	static Registry registry;
+	return registry;
+}
+
+ResourceArchive::ResourceArchive(const String& key_) :
+	key(key_)
+{
+
+}
+
+ResourceArchive::~ResourceArchive()
+{
+	clearImageCache();
+}
+
+ResourceArchive::Ptr ResourceArchive::getOrCreate(const File& archiveFile)
+{
+	const String key = archiveFile.getFullPathName();
+
+	auto& r = getRegistry();
+
+	ScopedLock sl(r.lock);
+
+	for (auto a : r.archives)
+	{
+		if (a->key == key)
+			return a;
+	}
+
+	Ptr newArchive = new ResourceArchive(key);
+
+	newArchive->mappedFile = new MemoryMappedFile(archiveFile, MemoryMappedFile::readOnly);
+
+	const void* data = newArchive->mappedFile->getData();
+	size_t size = newArchive->mappedFile->getSize();
+
+	if (data == nullptr)
+	{
+		// The file can't be mapped, so we'll read it into memory instead...
+		newArchive->mappedFile = nullptr;
+
+		if (!archiveFile.loadFileAsData(newArchive->fileData))
+			return nullptr;
+
+		data = newArchive->fileData.getData();
+		size = newArchive->fileData.getSize();
+	}
+
+	if (!newArchive->parseIndex(data, size))
+		return nullptr;
+
+	r.archives.add(newArchive);
+
+	return newArchive;
+}
+
+ResourceArchive::Ptr ResourceArchive::getOrCreate(const void* embeddedData, size_t dataSize)
+{
+	const String key = "embedded:" + String::toHexString((pointer_sized_int)embeddedData);
+
+	auto& r = getRegistry();
+
+	ScopedLock sl(r.lock);
+
+	for (auto a : r.archives)
+	{
+		if (a->key == key)
+			return a;
+	}
+
+	Ptr newArchive = new ResourceArchive(key);
+
+	if (!newArchive->parseIndex(embeddedData, dataSize))
+		return nullptr;
+
+	r.archives.add(newArchive);
+
+	return newArchive;
+}
+
+void ResourceArchive::releaseArchive(Ptr& archiveToRelease)
+{
+	if (archiveToRelease == nullptr)
+		return;
+
+	auto& r = getRegistry();
+
+	ScopedLock sl(r.lock);
+
+	archiveToRelease = nullptr;
+
+	for (int i = r.archives.size() - 1; i >= 0; i--)
+	{
+		// Only referenced by the registry itself...
+		if (r.archives[i]->getReferenceCount() == 1)
+			r.archives.remove(i);
+	}
+}
+
+bool ResourceArchive::isResourceArchive(const void* data, size_t dataSize)
+{
+	if (data == nullptr || dataSize < (size_t)ResourceArchiveFormat::headerSize)
+		return false;
+
+	MemoryInputStream mis(data, ResourceArchiveFormat::headerSize, false);
+
+	return (uint32)mis.readInt() == ResourceArchiveFormat::magicNumber &&
+		   (uint32)mis.readInt() == ResourceArchiveFormat::version;
+}
+
+bool ResourceArchive::writeArchive(const ValueTree& poolData, OutputStream& output)
+{
+	MemoryOutputStream index;
+	int64 offset = 0;
+
+	for (auto child : poolData)
+	{
+		auto mb = child.getProperty("Data").getBinaryData();
+		const int64 size = mb != nullptr ? (int64)mb->getSize() : 0;
+
+		index.writeString(child.getProperty("ID").toString());
+		index.writeString(child.getProperty("FileName").toString());
+		index.writeDouble((double)child.getProperty("AdditionalData", 0.0));
+		index.writeInt64(offset);
+		index.writeInt64(size);
+
+		offset += size;
+	}
+
+	bool ok = output.writeInt((int)ResourceArchiveFormat::magicNumber);
+	ok &= output.writeInt((int)ResourceArchiveFormat::version);
+	ok &= output.writeInt(poolData.getNumChildren());
+	ok &= output.writeInt((int)index.getDataSize());
+	ok &= output.write(index.getData(), index.getDataSize());
+
+	for (auto child : poolData)
+	{
+		if (auto mb = child.getProperty("Data").getBinaryData())
+			ok &= output.write(mb->getData(), mb->getSize());
+	}
+
+	return ok;
+}
+
+bool ResourceArchive::writeArchive(const ValueTree& poolData, const File& targetFile)
+{
+	TemporaryFile tempFile(targetFile);
+
+	{
+		ScopedPointer<FileOutputStream> fos = tempFile.getFile().createOutputStream();
+
+		if (fos == nullptr || !writeArchive(poolData, *fos))
+			return false;
+	}
+
+	return tempFile.overwriteTargetFileWithTemporary();
+}
+
+bool ResourceArchive::parseIndex(const void* archiveData, size_t archiveSize)
+{
+	if (!isResourceArchive(archiveData, archiveSize))
+		return false;
+
+	auto start = static_cast<const uint8*>(archiveData);
+
+	MemoryInputStream header(start, ResourceArchiveFormat::headerSize, false);
+	header.skipNextBytes(2 * sizeof(uint32));
+
+	const int numEntries = header.readInt();
+	const size_t indexSize = (size_t)(uint32)header.readInt();
+
+	const size_t dataStart = ResourceArchiveFormat::headerSize + indexSize;
+
+	if (numEntries < 0 || dataStart > archiveSize)
+		return false;
+
+	const size_t dataSize = archiveSize - dataStart;
+
+	MemoryInputStream index(start + ResourceArchiveFormat::headerSize, indexSize, false);
+
+	entries.ensureStorageAllocated(numEntries);
+
+	for (int i = 0; i < numEntries; i++)
+	{
+		if (index.isExhausted())
+			return false;
+
+		Entry e;
+
+		const String id = index.readString();
+
+		e.id = id.isNotEmpty() ? Identifier(id) : Identifier();
+		e.fileName = index.readString();
+		e.additionalData = index.readDouble();
+
+		const int64 offset = index.readInt64();
+		const int64 size = index.readInt64();
+
+		if (offset < 0 || size < 0 || size > (int64)dataSize || offset > (int64)dataSize - size)
+			return false;
+
+		e.data = start + dataStart + offset;
+		e.size = (size_t)size;
+
+		entries.add(e);
+	}
+
+	return true;
+}
+
+int ResourceArchive::indexOf(const Identifier& id) const
+{
+	for (int i = 0; i < entries.size(); i++)
+	{
+		if (entries.getReference(i).id == id)
+			return i;
+	}
+
+	return -1;
+}
+
+MemoryInputStream* ResourceArchive::createInputStream(int index) const
+{
+	if (isPositiveAndBelow(index, entries.size()))
+	{
+		const auto& e = entries.getReference(index);
+		return new MemoryInputStream(e.data, e.size, false);
+	}
+
+	return nullptr;
+}
+
+Image ResourceArchive::getImage(int index)
+{
+	if (!isPositiveAndBelow(index, entries.size()))
+		return Image();
+
+	ScopedLock sl(cacheLock);
+
+	for (int i = 0; i < imageCache.size(); i++)
+	{
+		if (imageCache.getReference(i).index == index)
+		{
+			// move it to the end so that the least recently used image is always the first one
+			auto c = imageCache.getReference(i);
+			imageCache.remove(i);
+			imageCache.add(c);
+			return c.image;
+		}
+	}
+
+	const auto& e = entries.getReference(index);
+
+	CachedImage c;
+	c.index = index;
+	c.image = ImageFileFormat::loadFrom(e.data, e.size);
+	c.numBytes = (size_t)c.image.getWidth() * (size_t)c.image.getHeight() * sizeof(uint32);
+
+	if (!c.image.isValid())
+		return Image();
+
+	imageCache.add(c);
+	imageCacheSize += c.numBytes;
+
+	const size_t limit = (size_t)HISE_RESOURCE_ARCHIVE_IMAGE_CACHE_MB * 1024 * 1024;
+
+	while (imageCacheSize > limit && imageCache.size() > 1)
+	{
+		imageCacheSize -= imageCache.getReference(0).numBytes;
+		imageCache.remove(0);
+	}
+
+	return c.image;
+}
+
+size_t ResourceArchive::getImageCacheSize() const
+{
+	ScopedLock sl(cacheLock);
+	return imageCacheSize;
+}
+
+void ResourceArchive::clearImageCache()
+{
+	ScopedLock sl(cacheLock);
+	imageCache.clear();
+	imageCacheSize = 0;
+}
+
+} // namespace hise
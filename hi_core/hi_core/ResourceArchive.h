@@ -0,0 +1,138 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#ifndef RESOURCEARCHIVE_H_INCLUDED
+#define RESOURCEARCHIVE_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** A read only archive for the images and audio files that are embedded into a compiled project.
+*
+*	The archive consists of a small index followed by the unaltered file data of every entry. Opening an archive
+*	only parses the index, the file data stays in the memory mapped file (or the embedded binary data) until an entry
+*	is requested, so the amount of resources does not affect the instantiation time of the plugin.
+*
+*	Archives are shared between all plugin instances of the process. Use getOrCreate() to obtain the archive for a file 
+*	or an embedded data block and releaseArchive() when you don't need it anymore. 
+*
+*	Decoded images are kept in a LRU cache which is limited to HISE_RESOURCE_ARCHIVE_IMAGE_CACHE_MB, so unused 
+*	filmstrips will be freed again (of course an image stays in memory as long as a component still uses it).
+*/
+class ResourceArchive : public ReferenceCountedObject
+{
+public:
+
+	typedef ReferenceCountedObjectPtr<ResourceArchive> Ptr;
+
+	struct Entry
+	{
+		Identifier id;
+		String fileName;
+		var additionalData;
+		const void* data;
+		size_t size;
+	};
+
+	~ResourceArchive();
+
+	/** Returns the archive for the given file. If the file is not a valid archive, it will return nullptr. */
+	static Ptr getOrCreate(const File& archiveFile);
+
+	/** Returns the archive for the given binary data. The data must stay valid for the lifetime of the process. */
+	static Ptr getOrCreate(const void* embeddedData, size_t dataSize);
+
+	/** Releases the reference and deletes all archives that are not used anymore. */
+	static void releaseArchive(Ptr& archiveToRelease);
+
+	/** Checks whether the data starts with a valid archive header. */
+	static bool isResourceArchive(const void* data, size_t dataSize);
+
+	/** Writes the exported ValueTree of a SharedPoolBase as archive to the given stream. */
+	static bool writeArchive(const ValueTree& poolData, OutputStream& output);
+
+	/** Writes the exported ValueTree of a SharedPoolBase as archive to the given file. */
+	static bool writeArchive(const ValueTree& poolData, const File& targetFile);
+
+	int getNumEntries() const noexcept { return entries.size(); }
+
+	/** Returns the index of the entry with the given id or -1 if it's not in the archive. */
+	int indexOf(const Identifier& id) const;
+
+	const Entry& getEntry(int index) const { return entries.getReference(index); }
+
+	/** Creates a stream that reads the data of the given entry without copying it. */
+	MemoryInputStream* createInputStream(int index) const;
+
+	/** Returns the decoded image of the given entry. It will be decoded on the first call. */
+	Image getImage(int index);
+
+	/** Returns the amount of memory that is used by the decoded images in the cache. */
+	size_t getImageCacheSize() const;
+
+	/** Clears the image cache. */
+	void clearImageCache();
+
+private:
+
+	struct Registry;
+
+	struct CachedImage
+	{
+		int index;
+		Image image;
+		size_t numBytes;
+	};
+
+	ResourceArchive(const String& key_);
+
+	bool parseIndex(const void* archiveData, size_t archiveSize);
+
+	static Registry& getRegistry();
+
+	const String key;
+
+	ScopedPointer<MemoryMappedFile> mappedFile;
+	MemoryBlock fileData;
+
+	Array<Entry> entries;
+
+	CriticalSection cacheLock;
+	Array<CachedImage> imageCache;
+	size_t imageCacheSize = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResourceArchive)
+};
+
+} // namespace hise
+
+#endif  // RESOURCEARCHIVE_H_INCLUDED
@@ -0,0 +1,189 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class ResourceArchiveUnitTest : public UnitTest
+{
+public:
+
+	ResourceArchiveUnitTest() :
+		UnitTest("Testing the resource archive")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testRoundtrip();
+		testSharing();
+		testCorruptData();
+	}
+
+private:
+
+	static MemoryBlock createPNG(int width, int height, Colour c)
+	{
+		Image img(Image::ARGB, width, height, true);
+		img.clear(img.getBounds(), c);
+
+		MemoryBlock mb;
+		MemoryOutputStream mos(mb, false);
+		PNGImageFormat().writeImageToStream(img, mos);
+		mos.flush();
+
+		return mb;
+	}
+
+	static ValueTree createPoolTree()
+	{
+		ValueTree v("Images");
+
+		for (int i = 0; i < 3; i++)
+		{
+			ValueTree child("PoolData");
+
+			auto mb = createPNG(10 + i, 20 + i, Colours::red.withHue((float)i / 3.0f));
+
+			child.setProperty("ID", "folder/image" + String(i), nullptr);
+			child.setProperty("FileName", "image" + String(i) + ".png", nullptr);
+			child.setProperty("Data", var(mb.getData(), mb.getSize()), nullptr);
+			child.setProperty("AdditionalData", 44100.0 + i, nullptr);
+
+			v.addChild(child, -1, nullptr);
+		}
+
+		return v;
+	}
+
+	void testRoundtrip()
+	{
+		beginTest("Testing archive roundtrip");
+
+		auto v = createPoolTree();
+
+		MemoryOutputStream mos(archiveData, false);
+		expect(ResourceArchive::writeArchive(v, mos), "Writing failed");
+		mos.flush();
+
+		expect(ResourceArchive::isResourceArchive(archiveData.getData(), archiveData.getSize()), "Not an archive");
+
+		auto archive = ResourceArchive::getOrCreate(archiveData.getData(), archiveData.getSize());
+
+		expect(archive != nullptr, "Archive can't be opened");
+		expectEquals(archive->getNumEntries(), 3);
+		expectEquals(archive->indexOf(Identifier("folder/image1")), 1);
+		expectEquals(archive->indexOf(Identifier("unknown")), -1);
+
+		for (int i = 0; i < 3; i++)
+		{
+			const auto& e = archive->getEntry(i);
+			auto original = v.getChild(i).getProperty("Data").getBinaryData();
+
+			expectEquals(e.fileName, "image" + String(i) + ".png");
+			expectEquals((double)e.additionalData, 44100.0 + i);
+			expect(e.size == original->getSize() && memcmp(e.data, original->getData(), e.size) == 0, "Data mismatch");
+
+			auto img = archive->getImage(i);
+
+			expectEquals(img.getWidth(), 10 + i);
+			expectEquals(img.getHeight(), 20 + i);
+		}
+
+		auto first = archive->getImage(0);
+		auto second = archive->getImage(0);
+
+		expect(first.getPixelData() == second.getPixelData(), "Image was decoded twice");
+		expect(archive->getImageCacheSize() > 0, "Cache is empty");
+
+		ResourceArchive::releaseArchive(archive);
+	}
+
+	void testSharing()
+	{
+		beginTest("Testing sharing of archives");
+
+		auto a1 = ResourceArchive::getOrCreate(archiveData.getData(), archiveData.getSize());
+		auto a2 = ResourceArchive::getOrCreate(archiveData.getData(), archiveData.getSize());
+
+		expect(a1 != nullptr && a1 == a2, "Archive isn't shared");
+
+		TemporaryFile tempFile;
+
+		expect(ResourceArchive::writeArchive(createPoolTree(), tempFile.getFile()), "Writing the file failed");
+
+		auto a3 = ResourceArchive::getOrCreate(tempFile.getFile());
+
+		expect(a3 != nullptr && a3 != a1, "File archive can't be opened");
+		expect(a3 == ResourceArchive::getOrCreate(tempFile.getFile()), "File archive isn't shared");
+		expectEquals(a3->getImage(2).getWidth(), 12);
+
+		ResourceArchive::releaseArchive(a1);
+		ResourceArchive::releaseArchive(a2);
+		ResourceArchive::releaseArchive(a3);
+	}
+
+	void testCorruptData()
+	{
+		beginTest("Testing corrupt archives");
+
+		MemoryBlock truncated(archiveData.getData(), archiveData.getSize() / 2);
+
+		expect(ResourceArchive::getOrCreate(truncated.getData(), truncated.getSize()) == nullptr, "Truncated archive was opened");
+
+		MemoryBlock garbage(256, true);
+
+		expect(ResourceArchive::getOrCreate(garbage.getData(), garbage.getSize()) == nullptr, "Garbage was opened");
+
+		TemporaryFile missingFile;
+
+		expect(ResourceArchive::getOrCreate(missingFile.getFile()) == nullptr, "Missing file was opened");
+	}
+
+	MemoryBlock archiveData;
+};
+
+static ResourceArchiveUnitTest resourceArchiveUnitTest;
+
+} // namespace hise
+
+#endif
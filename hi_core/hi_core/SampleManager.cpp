@@ -55,7 +55,12 @@ MainController::SampleManager::SampleManager(MainController *mc_) :
 	preloadFlag(false)
 
 {
+#if HISE_NUM_PRELOAD_THREADS > 0
+	preloadThreadPool = new ThreadPool(HISE_NUM_PRELOAD_THREADS);
 
+	// The streaming threads must always win...
+	preloadThreadPool->setThreadPriorities(4);
+#endif
 }
 
 
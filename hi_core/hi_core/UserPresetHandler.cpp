@@ -32,13 +32,188 @@
 
 namespace hise { using namespace juce;
 
+MainController::UserPresetHandler::UserPresetHandler(MainController* mc_) :
+	mc(mc_),
+	loadingJob(*this)
+{
+
+}
+
+MainController::UserPresetHandler::~UserPresetHandler()
+{
+	loadingJob.signalJobShouldExit();
+}
+
 void MainController::UserPresetHandler::loadUserPreset(const ValueTree& v)
 {
+#if HISE_GAPLESS_PRESET_LOADING
+
+	bool needsNewJob;
+
+	{
+		SpinLock::ScopedLockType sl(pendingPresetLock);
+		pendingPreset = v;
+
+		// If the job is still pending, it will pick up the most recent preset before it finishes
+		needsNewJob = !loadingJobIsPending;
+		loadingJobIsPending = true;
+	}
+
+	if (needsNewJob)
+		mc->getSampleManager().getGlobalSampleThreadPool()->addJob(&loadingJob, false);
+
+#else
+
 	auto f = [this, v](Processor*) {loadUserPresetInternal(v); return true; };
 
 	auto synthChain = mc->getMainSynthChain();
 
 	mc->getKillStateHandler().killVoicesAndCall(synthChain, f, KillStateHandler::TargetThread::SampleLoadingThread);
+
+#endif
+}
+
+struct MainController::UserPresetHandler::PreparedPreset
+{
+	ValueTree midiAutomation;
+	MidiControllerAutomationHandler::PreparedData automationData;
+
+	WeakReference<Processor> globalModulatorContainer;
+	GlobalModulatorContainer::PreparedModulatedParameters modulatedParameters;
+};
+
+SampleThreadPool::Job::JobStatus MainController::UserPresetHandler::PresetLoadingJob::runJob()
+{
+	ValueTree v;
+
+	{
+		SpinLock::ScopedLockType sl(parent.pendingPresetLock);
+		v = parent.pendingPreset;
+		parent.pendingPreset = ValueTree();
+	}
+
+	if (v.isValid() && !shouldExit())
+		loadPreset(v);
+
+	// The flag is cleared with the same lock as the pending preset, so a preset that is set
+	// after this check will add the job again.
+	SpinLock::ScopedLockType sl(parent.pendingPresetLock);
+
+	if (parent.pendingPreset.isValid() && !shouldExit())
+		return jobNeedsRunningAgain;
+
+	parent.loadingJobIsPending = false;
+	return jobHasFinished;
+}
+
+void MainController::UserPresetHandler::PresetLoadingJob::loadPreset(const ValueTree& v)
+{
+#if USE_BACKEND
+	if (!GET_PROJECT_HANDLER(parent.mc->getMainSynthChain()).isActive()) 
+		return;
+#endif
+
+	// Everything expensive is done while the audio is still playing...
+	PreparedPreset preparedPreset;
+	parent.prepareUserPreset(v, preparedPreset);
+
+	// ... so that the audio thread only has to swap the prepared state.
+	parent.committer.commitAndWait([&]() { parent.swapUserPreset(preparedPreset); });
+
+	if (preparedPreset.midiAutomation.isValid())
+		parent.mc->getMacroManager().getMidiControlAutomationHandler()->sendChangeMessage();
+
+	parent.sendPresetChangeMessage();
+}
+
+void MainController::UserPresetHandler::prepareUserPreset(const ValueTree& userPresetToLoad, PreparedPreset& p)
+{
+	// The control callbacks can change any state (and load sample maps), so they can't be deferred.
+	// They run like any other control change, and samplers that load another sample map kill their own voices.
+	Processor::Iterator<JavascriptMidiProcessor> iter(mc->getMainSynthChain());
+
+	mc->getSampleManager().setShouldSkipPreloading(true);
+
+	while (JavascriptMidiProcessor *sp = iter.getNextProcessor())
+	{
+		if (!sp->isFront()) continue;
+
+		auto v = userPresetToLoad.getChildWithProperty("Processor", sp->getId());
+
+		if (v.isValid())
+			sp->getScriptingContent()->restoreAllControlsFromPreset(v);
+	}
+
+	mc->getSampleManager().preloadEverything();
+
+	p.midiAutomation = userPresetToLoad.getChildWithName("MidiAutomation");
+
+	if (p.midiAutomation.isValid())
+		mc->getMacroManager().getMidiControlAutomationHandler()->prepareFromValueTree(p.midiAutomation, p.automationData);
+
+	auto modulationData = userPresetToLoad.getChildWithName("ModulatedParameters");
+
+	if (modulationData.isValid())
+	{
+		if (auto container = ProcessorHelpers::getFirstProcessorWithType<GlobalModulatorContainer>(mc->getMainSynthChain()))
+		{
+			p.globalModulatorContainer = container;
+			container->prepareModulatedParameters(modulationData, p.modulatedParameters);
+		}
+	}
+}
+
+void MainController::UserPresetHandler::swapUserPreset(PreparedPreset& p)
+{
+	if (p.midiAutomation.isValid())
+		mc->getMacroManager().getMidiControlAutomationHandler()->swapPreparedData(p.automationData);
+
+	if (auto container = dynamic_cast<GlobalModulatorContainer*>(p.globalModulatorContainer.get()))
+		container->swapModulatedParameters(p.modulatedParameters);
+}
+
+MainController::UserPresetHandler::PresetCommitter::PresetCommitter() :
+	state(Idle)
+{
+
+}
+
+void MainController::UserPresetHandler::PresetCommitter::commitAndWait(const std::function<void()>& swapFunction, int timeoutMs)
+{
+	pendingSwapFunction = swapFunction;
+	committed.reset();
+	state.store(Pending);
+
+	if (!committed.wait(timeoutMs))
+	{
+		int expected = Pending;
+
+		// No audio callback, so the state can be swapped on this thread
+		if (state.compare_exchange_strong(expected, Committing))
+		{
+			pendingSwapFunction();
+			state.store(Idle);
+		}
+		else
+		{
+			// The audio thread is already committing
+			committed.wait();
+		}
+	}
+
+	pendingSwapFunction = {};
+}
+
+void MainController::UserPresetHandler::PresetCommitter::commitIfPending()
+{
+	int expected = Pending;
+
+	if (state.compare_exchange_strong(expected, Committing))
+	{
+		pendingSwapFunction();
+		state.store(Idle);
+		committed.signal();
+	}
 }
 
 void MainController::UserPresetHandler::loadUserPreset(const File& f)
@@ -155,6 +330,13 @@ void MainController::UserPresetHandler::loadUserPresetInternal(const ValueTree&
 		}
 	}
 
+	sendPresetChangeMessage();
+
+	mc->allNotesOff(true);
+}
+
+void MainController::UserPresetHandler::sendPresetChangeMessage()
+{
 	auto f = [this]()->void
 	{
 		for (auto l : this->listeners)
@@ -165,9 +347,6 @@ void MainController::UserPresetHandler::loadUserPresetInternal(const ValueTree&
 	};
 
 	new DelayedFunctionCaller(f, 400);
-
-
-	mc->allNotesOff(true);
 }
 
 
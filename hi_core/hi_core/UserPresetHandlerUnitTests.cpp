@@ -0,0 +1,149 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class UserPresetHandlerUnitTest : public UnitTest
+{
+public:
+
+	using PresetCommitter = MainController::UserPresetHandler::PresetCommitter;
+
+	UserPresetHandlerUnitTest() :
+		UnitTest("Testing the gapless user preset loading")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testCommitAtBlockBoundary();
+		testCommitWithoutAudioCallback();
+	}
+
+private:
+
+	/** Calls the committer at the start of every block like the audio callback of the MainController. */
+	class AudioThread : public Thread
+	{
+	public:
+
+		AudioThread(PresetCommitter& committer_) :
+			Thread("Fake Audio Thread"),
+			committer(committer_)
+		{};
+
+		void run() override
+		{
+			while (!threadShouldExit())
+			{
+				committer.commitIfPending();
+
+				isRendering.store(true);
+				Thread::sleep(1);
+				isRendering.store(false);
+			}
+		}
+
+		PresetCommitter& committer;
+		std::atomic<bool> isRendering = { false };
+	};
+
+	/** Commits a few presets in a row and checks that every swap is done once by the audio thread between two blocks. */
+	void testCommitAtBlockBoundary()
+	{
+		beginTest("Testing the commit at the block boundary");
+
+		PresetCommitter committer;
+		AudioThread audioThread(committer);
+
+		audioThread.startThread();
+
+		for (int i = 0; i < 20; i++)
+		{
+			int numSwaps = 0;
+			bool swappedOnAudioThread = false;
+			bool swappedWhileRendering = false;
+
+			committer.commitAndWait([&]()
+			{
+				numSwaps++;
+				swappedOnAudioThread = Thread::getCurrentThread() == &audioThread;
+				swappedWhileRendering = audioThread.isRendering.load();
+			});
+
+			expectEquals(numSwaps, 1, "Wrong number of swaps");
+			expect(swappedOnAudioThread, "The swap wasn't done by the audio thread");
+			expect(!swappedWhileRendering, "The swap was done in the middle of a block");
+			expect(committer.getState() == PresetCommitter::Idle, "The committer isn't idle after the commit");
+
+			if (numSwaps != 1 || !swappedOnAudioThread)
+				break;
+		}
+
+		audioThread.stopThread(1000);
+	}
+
+	void testCommitWithoutAudioCallback()
+	{
+		beginTest("Testing the commit without audio callback");
+
+		PresetCommitter committer;
+
+		bool swappedOnThisThread = false;
+
+		committer.commitAndWait([&]()
+		{
+			swappedOnThisThread = Thread::getCurrentThread() == nullptr;
+		}, 20);
+
+		expect(swappedOnThisThread, "The swap wasn't done after the timeout");
+		expect(committer.getState() == PresetCommitter::Idle, "The committer isn't idle after the commit");
+	}
+};
+
+static UserPresetHandlerUnitTest userPresetHandlerUnitTest;
+
+} // namespace hise
+
+#endif
@@ -808,4 +808,101 @@ bool SafeFunctionCall::call()
 	return false;
 }
 
+CustomKeyboardState::CustomKeyboardState(HiseEventInbox& eventInbox_) :
+	MidiKeyboardState(),
+	eventInbox(eventInbox_),
+	lowestKey(40)
+{
+	for (int i = 0; i < 128; i++)
+	{
+		midiInputNoteStates[i].store(0);
+		displayedMidiInputNoteStates[i] = 0;
+	}
+
+	for (int i = 0; i < 127; i++)
+	{
+		setColourForSingleKey(i, Colours::transparentBlack);
+	}
+
+	addListener(this);
+
+	startTimer(30);
+}
+
+CustomKeyboardState::~CustomKeyboardState()
+{
+	stopTimer();
+	removeListener(this);
+}
+
+void CustomKeyboardState::updateFromMidiInput(const MidiBuffer& midiMessages) noexcept
+{
+	MidiBuffer::Iterator it(midiMessages);
+	MidiMessage m;
+	int samplePosition;
+
+	while (it.getNextEvent(m, samplePosition))
+	{
+		const uint16 channelBit = (uint16)(1 << jlimit<int>(0, 15, m.getChannel() - 1));
+
+		if (m.isNoteOn())
+			midiInputNoteStates[m.getNoteNumber()].fetch_or(channelBit);
+		else if (m.isNoteOff())
+			midiInputNoteStates[m.getNoteNumber()].fetch_and((uint16)~channelBit);
+		else if (m.isAllNotesOff())
+		{
+			for (int i = 0; i < 128; i++)
+				midiInputNoteStates[i].fetch_and((uint16)~channelBit);
+		}
+	}
+}
+
+void CustomKeyboardState::handleNoteOn(MidiKeyboardState* /*source*/, int midiChannel, int midiNoteNumber, float velocity)
+{
+	if (displayingMidiInput)
+		return;
+
+	const uint8 velocityValue = (uint8)jlimit<int>(1, 127, roundToInt(velocity * 127.0f));
+
+	eventInbox.push(HiseEvent(HiseEvent::Type::NoteOn, (uint8)midiNoteNumber, velocityValue, (uint8)midiChannel));
+}
+
+void CustomKeyboardState::handleNoteOff(MidiKeyboardState* /*source*/, int midiChannel, int midiNoteNumber, float /*velocity*/)
+{
+	if (displayingMidiInput)
+		return;
+
+	eventInbox.push(HiseEvent(HiseEvent::Type::NoteOff, (uint8)midiNoteNumber, 0, (uint8)midiChannel));
+}
+
+void CustomKeyboardState::timerCallback()
+{
+	// The notes of the MIDI input are already on their way to the audio thread, so they must not be sent again
+	ScopedValueSetter<bool> svs(displayingMidiInput, true);
+
+	for (int i = 0; i < 128; i++)
+	{
+		const uint16 newState = midiInputNoteStates[i].load();
+		const uint16 changedChannels = newState ^ displayedMidiInputNoteStates[i];
+
+		if (changedChannels == 0)
+			continue;
+
+		for (int channel = 1; channel <= 16; channel++)
+		{
+			const uint16 channelBit = (uint16)(1 << (channel - 1));
+
+			if ((changedChannels & channelBit) == 0)
+				continue;
+
+			if ((newState & channelBit) != 0)
+				processNextMidiEvent(MidiMessage::noteOn(channel, i, (uint8)127));
+			else
+				processNextMidiEvent(MidiMessage::noteOff(channel, i));
+		}
+
+		displayedMidiInputNoteStates[i] = newState;
+	}
+}
+
 } // namespace hise
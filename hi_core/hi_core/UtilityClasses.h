@@ -862,22 +862,28 @@ private:
 
 
 
-/** A keyboard state which adds the possibility of colouring the keys. */
+class HiseEventInbox;
+
+/** A keyboard state which adds the possibility of colouring the keys.
+*
+*	The notes that are played on the keyboard are sent to the audio thread through the given HiseEventInbox. The notes
+*	of the MIDI input are displayed by a timer on the message thread, so the audio thread never acquires the lock of the
+*	MidiKeyboardState.
+*/
 class CustomKeyboardState : public MidiKeyboardState,
-	public SafeChangeBroadcaster
+	public SafeChangeBroadcaster,
+	private MidiKeyboardStateListener,
+	private Timer
 {
 public:
 
-	/** Creates a new keyboard state. */
-	CustomKeyboardState() :
-		MidiKeyboardState(),
-		lowestKey(40)
-	{
-		for (int i = 0; i < 127; i++)
-		{
-			setColourForSingleKey(i, Colours::transparentBlack);
-		}
-	}
+	/** Creates a new keyboard state that sends the played notes to the given inbox. */
+	CustomKeyboardState(HiseEventInbox& eventInbox);
+
+	~CustomKeyboardState();
+
+	/** Updates the displayed state of the notes in the MIDI input. This is lock free, so you can call it in the audio callback. */
+	void updateFromMidiInput(const MidiBuffer& midiMessages) noexcept;
 
 	/** Returns the colour for the given note number. */
 	Colour getColourForSingleKey(int noteNumber) const
@@ -911,6 +917,21 @@ public:
 
 private:
 
+	void handleNoteOn(MidiKeyboardState* source, int midiChannel, int midiNoteNumber, float velocity) override;
+	void handleNoteOff(MidiKeyboardState* source, int midiChannel, int midiNoteNumber, float velocity) override;
+
+	void timerCallback() override;
+
+	HiseEventInbox& eventInbox;
+
+	/** The channel bits of the notes in the MIDI input (written by the audio thread). */
+	std::atomic<uint16> midiInputNoteStates[128];
+
+	/** The channel bits that were already applied to the keyboard state (only used by the message thread). */
+	uint16 displayedMidiInputNoteStates[128];
+
+	bool displayingMidiInput = false;
+
 	Colour noteColours[127];
 	int lowestKey;
 
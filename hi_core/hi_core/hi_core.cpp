@@ -64,12 +64,16 @@
 
 #endif
 
+#include "HiseFFT.cpp"
+
 #include "AES.cpp"
 #include "UtilityClasses.cpp"
 #include "DebugLogger.cpp"
+#include "RealtimeWorkerPool.cpp"
 #include "ThreadWithQuasiModalProgressWindow.cpp"
 #include "HI_LookAndFeels.cpp"
 #include "Tables.cpp"
+#include "ResourceArchive.cpp"
 #include "ExternalFilePool.cpp"
 #include "GlobalScriptCompileBroadcaster.cpp"
 #include "MainControllerHelpers.cpp"
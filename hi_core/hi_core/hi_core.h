@@ -60,6 +60,8 @@ struct TestGlobalNamespace
 #include "IppFFT.h"
 #endif
 
+#include "HiseFFT.h"
+
 
 #include "CustomDataContainers.h"
 
@@ -76,12 +78,14 @@ struct TestGlobalNamespace
 #include "HI_LookAndFeels.h"
 #include "HiseEventBuffer.h"
 #include "DebugLogger.h"
+#include "RealtimeWorkerPool.h"
 
 
 #include "ThreadWithQuasiModalProgressWindow.h"
 #include "Popup.h"
 #include "Tables.h"
 #include "UpdateMerger.h"
+#include "ResourceArchive.h"
 #include "ExternalFilePool.h"
 #include "Markdown.h"
 #include "BackgroundThreads.h"
@@ -62,4 +62,5 @@
 #include "modules/ModulatorSynthGroup.cpp"
 
 #include "plugin_parameter/PluginParameterProcessor.cpp"
+#include "plugin_parameter/UnitTestAudioProcessor.cpp"
 
@@ -177,6 +177,7 @@ class ProcessorEditor;
 // Plugin Parameters
 
 #include "plugin_parameter/PluginParameterProcessor.h"
+#include "plugin_parameter/UnitTestAudioProcessor.h"
 
 
 
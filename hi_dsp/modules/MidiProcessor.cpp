@@ -96,6 +96,12 @@ void MidiProcessorChain::addArtificialEvent(const HiseEvent& m)
 
 	//jassert(m.isArtificial());
 
+	if (getMainController()->getKillStateHandler().getCurrentThread() != MainController::KillStateHandler::AudioThread)
+	{
+		eventsFromOtherThreads.push(m);
+		return;
+	}
+
 	const int thisBlockSize = dynamic_cast<AudioProcessor*>(getMainController())->getBlockSize();
 
 	if (timeStamp > thisBlockSize)
@@ -117,6 +123,11 @@ void MidiProcessorChain::renderNextHiseEventBuffer(HiseEventBuffer &buffer, int
 		allNotesOffAtNextBuffer = false;
 	}
 
+	eventsFromOtherThreads.popAllInto(artificialEvents, futureEventBuffer, numSamples);
+
+	if (const int numDroppedEvents = eventsFromOtherThreads.getAndResetNumDroppedEvents())
+		getMainController()->getDebugLogger().addEventBufferOverflow(this, numDroppedEvents);
+
 	if (buffer.isEmpty() && futureEventBuffer.isEmpty() && artificialEvents.isEmpty()) return;
 
 	HiseEventBuffer::Iterator it(buffer);
@@ -184,6 +184,11 @@ public:
 
 	ProcessorEditorBody *createEditor(ProcessorEditor *parentEditor)  override;
 
+	/** Adds an event that was created by a MidiProcessor.
+	*
+	*	If this is called from another thread than the audio thread (eg. a deferred script callback), the event will be
+	*	queued in a lock free inbox and added at the start of the next buffer.
+	*/
 	void addArtificialEvent(const HiseEvent& m);
 
 	void sendAllNoteOffEvent()
@@ -292,6 +297,8 @@ private:
 	HiseEventBuffer futureEventBuffer;
 	HiseEventBuffer artificialEvents;
 
+	HiseEventInbox eventsFromOtherThreads;
+
 };
 
 
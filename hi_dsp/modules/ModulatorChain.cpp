@@ -48,6 +48,9 @@ ModulatorChain::ModulatorChain(MainController *mc, const String &uid, int numVoi
 
 	FloatVectorOperations::fill(lastVoiceValues, 1.0, NUM_POLYPHONIC_VOICES);
 
+	zeromem(voiceBatchDestinations, sizeof(voiceBatchDestinations));
+	zeromem(voiceBatchPending, sizeof(voiceBatchPending));
+
 	if (Identifier::isValidIdentifier(uid))
 	{
 		chainIdentifier = Identifier(uid);
@@ -158,6 +161,14 @@ void ModulatorChain::startVoice(int voiceIndex)
 {
 	activeVoices.setBit(voiceIndex, true);
 
+	voiceBatchPending[voiceIndex] = false;
+
+	if (controlRateStates != nullptr)
+	{
+		controlRateStates[voiceIndex].samplesLeft = 0;
+		controlRateStates[voiceIndex].initialised = false;
+	}
+
 
 	polyManager.setLastStartedVoice(voiceIndex);
 
@@ -206,12 +217,34 @@ void ModulatorChain::prepareToPlay(double sampleRate, int samplesPerBlock)
 	ProcessorHelpers::increaseBufferIfNeeded(internalVoiceBuffer, samplesPerBlock);
 	ProcessorHelpers::increaseBufferIfNeeded(envelopeTempBuffer, samplesPerBlock);
 
-	for(int i = 0; i < envelopeModulators.size(); i++) envelopeModulators[i]->prepareToPlay(sampleRate, samplesPerBlock);
+	if (controlRateDownsamplingFactor > 1)
+		ProcessorHelpers::increaseBufferIfNeeded(controlRateBuffer, samplesPerBlock);
+
+	const double envelopeSampleRate = sampleRate / (double)controlRateDownsamplingFactor;
+
+	for(int i = 0; i < envelopeModulators.size(); i++) envelopeModulators[i]->prepareToPlay(envelopeSampleRate, samplesPerBlock);
 	for(int i = 0; i < variantModulators.size(); i++) variantModulators[i]->prepareToPlay(sampleRate, samplesPerBlock);
 
+	allocateVoiceBatchBufferIfNeeded();
+
 	jassert(checkModulatorStructure());
 };
 
+void ModulatorChain::allocateVoiceBatchBufferIfNeeded()
+{
+	if (voiceBatchBuffer.getNumChannels() != 0)
+		return;
+
+	for (auto m : envelopeModulators)
+	{
+		if (m->canCalculateVoiceBatch())
+		{
+			voiceBatchBuffer.setSize(polyManager.getVoiceAmount(), VoiceBatchChunkSize);
+			return;
+		}
+	}
+}
+
 float ModulatorChain::calculateNewValue()
 {
 	jassertfalse;
@@ -237,6 +270,122 @@ void ModulatorChain::setIsVoiceStartChain(bool isVoiceStartChain_)
 	}
 }
 
+void ModulatorChain::setControlRateDownsamplingFactor(int newDownsamplingFactor)
+{
+	newDownsamplingFactor = jlimit<int>(1, 64, newDownsamplingFactor);
+
+	if (newDownsamplingFactor == controlRateDownsamplingFactor)
+		return;
+
+	ScopedLock sl(getMainController()->getLock());
+
+	controlRateDownsamplingFactor = newDownsamplingFactor;
+
+	if (controlRateDownsamplingFactor > 1)
+	{
+		// The last state is used by the envelopes in monophonic mode
+		controlRateStates.calloc(polyManager.getVoiceAmount() + 1);
+	}
+	else
+	{
+		controlRateStates.free();
+	}
+
+	if (getSampleRate() > 0.0)
+	{
+		if (controlRateDownsamplingFactor > 1)
+			ProcessorHelpers::increaseBufferIfNeeded(controlRateBuffer, blockSize);
+
+		for (int i = 0; i < envelopeModulators.size(); i++) envelopeModulators[i]->prepareToPlay(getControlRateSampleRate(), blockSize);
+	}
+}
+
+void ModulatorChain::renderEnvelopesAtControlRate(int voiceIndex, float* destination, int numSamples)
+{
+	const bool renderMonophonicEnvelopes = voiceIndex < 0;
+
+	bool hasEnvelopesToRender = false;
+
+	for (int i = 0; i < envelopeModulators.size(); i++)
+	{
+		if (!envelopeModulators[i]->isBypassed() && envelopeModulators[i]->isInMonophonicMode() == renderMonophonicEnvelopes)
+		{
+			hasEnvelopesToRender = true;
+			break;
+		}
+	}
+
+	if (!hasEnvelopesToRender)
+		return;
+
+	ControlRateState& s = controlRateStates[renderMonophonicEnvelopes ? polyManager.getVoiceAmount() : voiceIndex];
+	const int factor = controlRateDownsamplingFactor;
+
+	// The amount of control values that are needed after the current ramp has finished
+	const int numControlValues = (jmax<int>(0, numSamples - s.samplesLeft) + factor - 1) / factor;
+
+	jassert(numControlValues <= controlRateBuffer.getNumSamples());
+
+	float* controlValues = controlRateBuffer.getWritePointer(0);
+
+	if (numControlValues > 0)
+	{
+		FloatVectorOperations::fill(controlValues, 1.0f, numControlValues);
+
+		AudioSampleBuffer b(&controlValues, 1, numControlValues);
+
+		for (int i = 0; i < envelopeModulators.size(); i++)
+		{
+			EnvelopeModulator *m = envelopeModulators[i];
+
+			if (m->isBypassed() || m->isInMonophonicMode() != renderMonophonicEnvelopes)
+				continue;
+
+			if (!renderMonophonicEnvelopes)
+				m->polyManager.setCurrentVoice(voiceIndex);
+
+			m->renderNextBlock(b, 0, numControlValues);
+
+			if (!renderMonophonicEnvelopes)
+				m->polyManager.clearCurrentVoice();
+		}
+
+		if (!s.initialised)
+		{
+			s.currentValue = controlValues[0];
+			s.targetValue = controlValues[0];
+			s.initialised = true;
+		}
+	}
+
+	int pos = 0;
+
+	while (pos < numSamples)
+	{
+		if (s.samplesLeft == 0)
+		{
+			s.currentValue = s.targetValue;
+			s.targetValue = *controlValues++;
+			s.delta = (s.targetValue - s.currentValue) / (float)factor;
+			s.samplesLeft = factor;
+		}
+
+		const int numThisTime = jmin<int>(s.samplesLeft, numSamples - pos);
+
+		float value = s.currentValue;
+
+		for (int i = 0; i < numThisTime; i++)
+		{
+			value += s.delta;
+			destination[pos + i] *= value;
+		}
+
+		s.currentValue = value;
+		s.samplesLeft -= numThisTime;
+		pos += numThisTime;
+	}
+}
+
 void ModulatorChain::ModulatorChainHandler::addModulator(Modulator *newModulator, Processor *siblingToInsertBefore)
 {
 	newModulator->setColour(chain->getColour());
@@ -249,7 +398,11 @@ void ModulatorChain::ModulatorChainHandler::addModulator(Modulator *newModulator
 	newModulator->setConstrainerForAllInternalChains(chain->getFactoryType()->getConstrainer());
 
 	if (chain->isInitialized())
-		newModulator->prepareToPlay(chain->getSampleRate(), chain->blockSize);
+	{
+		const bool isEnvelope = dynamic_cast<EnvelopeModulator*>(newModulator) != nullptr;
+
+		newModulator->prepareToPlay(isEnvelope ? chain->getControlRateSampleRate() : chain->getSampleRate(), chain->blockSize);
+	}
 	
 	const int index = siblingToInsertBefore == nullptr ? -1 : chain->allModulators.indexOf(dynamic_cast<Modulator*>(siblingToInsertBefore));
 
@@ -267,6 +420,9 @@ void ModulatorChain::ModulatorChainHandler::addModulator(Modulator *newModulator
 		{
 			EnvelopeModulator *m = static_cast<EnvelopeModulator*>(newModulator);
 			chain->envelopeModulators.add(m);
+
+			if (chain->isInitialized())
+				chain->allocateVoiceBatchBufferIfNeeded();
 		}
 		else if (dynamic_cast<TimeVariantModulator*>(newModulator) != nullptr)
 		{
@@ -442,7 +598,11 @@ void ModulatorChain::renderVoice(int voiceIndex, int startSample, int numSamples
 
 		lastVoiceValues[voiceIndex] = constantVoiceValue;
 
-		for(int i = 0; i < envelopeModulators.size(); i++)
+		if (controlRateStates != nullptr)
+		{
+			renderEnvelopesAtControlRate(voiceIndex, internalBuffer.getWritePointer(0, startSample), numSamples);
+		}
+		else for(int i = 0; i < envelopeModulators.size(); i++)
 		{
 			EnvelopeModulator *m = envelopeModulators[i];
 		
@@ -450,6 +610,10 @@ void ModulatorChain::renderVoice(int voiceIndex, int startSample, int numSamples
 
 			if (m->isInMonophonicMode())
 				continue;
+
+			// Already calculated by renderVoiceBatch()
+			if (voiceBatchPending[voiceIndex] && m->canCalculateVoiceBatch())
+				continue;
 			
 			m->polyManager.setCurrentVoice(voiceIndex);
 
@@ -464,6 +628,11 @@ void ModulatorChain::renderVoice(int voiceIndex, int startSample, int numSamples
 			m->polyManager.clearCurrentVoice();
 		}
 
+		if (voiceBatchPending[voiceIndex])
+		{
+			FloatVectorOperations::multiply(internalBuffer.getWritePointer(0, startSample), internalVoiceBuffer.getReadPointer(voiceIndex, startSample), numSamples);
+			voiceBatchPending[voiceIndex] = false;
+		}
 	}
 
 	CHECK_AND_LOG_BUFFER_DATA_WITH_ID(parentProcessor, chainIdentifier, DebugLogger::Location::ModulatorChainVoiceRendering, internalBuffer.getReadPointer(0, startIndex), true, sampleAmount);
@@ -488,6 +657,54 @@ void ModulatorChain::renderVoice(int voiceIndex, int startSample, int numSamples
 
 }
 
+void ModulatorChain::renderVoiceBatch(const int* voiceIndexes, int numVoices, int startSample, int numSamples)
+{
+	zeromem(voiceBatchPending, sizeof(voiceBatchPending));
+
+	// The buffer is only allocated if the chain contains a batched envelope. If the linear mode of an envelope
+	// was enabled after prepareToPlay(), the voices use the per voice rendering until the buffer was allocated.
+	if (numVoices < 2 || numVoices > voiceBatchBuffer.getNumChannels() || controlRateStates != nullptr || !shouldBeProcessed(true))
+		return;
+
+	bool hasBatchedEnvelopes = false;
+
+	for (auto m : envelopeModulators)
+	{
+		if (!m->isBypassed() && !m->isInMonophonicMode() && m->canCalculateVoiceBatch())
+		{
+			if (!hasBatchedEnvelopes)
+			{
+				for (int v = 0; v < numVoices; v++)
+					FloatVectorOperations::fill(internalVoiceBuffer.getWritePointer(voiceIndexes[v], startSample), 1.0f, numSamples);
+
+				hasBatchedEnvelopes = true;
+			}
+
+			for (int offset = 0; offset < numSamples; offset += VoiceBatchChunkSize)
+			{
+				const int numThisTime = jmin<int>(VoiceBatchChunkSize, numSamples - offset);
+
+				for (int v = 0; v < numVoices; v++)
+					voiceBatchDestinations[v] = voiceBatchBuffer.getWritePointer(v);
+
+				m->calculateVoiceBatch(voiceIndexes, numVoices, voiceBatchDestinations, numThisTime);
+
+				for (int v = 0; v < numVoices; v++)
+				{
+					float* destination = internalVoiceBuffer.getWritePointer(voiceIndexes[v], startSample + offset);
+					m->applyVoiceBatchValues(voiceBatchBuffer.getWritePointer(v), destination, numThisTime);
+				}
+			}
+		}
+	}
+
+	if (hasBatchedEnvelopes)
+	{
+		for (int v = 0; v < numVoices; v++)
+			voiceBatchPending[voiceIndexes[v]] = true;
+	}
+}
+
 void ModulatorChain::renderNextBlock(AudioSampleBuffer& buffer, int startSample, int numSamples)
 {
 	const int startIndex = startSample;
@@ -506,7 +723,11 @@ void ModulatorChain::renderNextBlock(AudioSampleBuffer& buffer, int startSample,
 			v->renderNextBlock(internalBuffer, startSample, numSamples);
 		}
 
-		for (auto m : envelopeModulators)
+		if (controlRateStates != nullptr)
+		{
+			renderEnvelopesAtControlRate(-1, internalBuffer.getWritePointer(0, startSample), numSamples);
+		}
+		else for (auto m : envelopeModulators)
 		{
 			if (m->isBypassed()) continue;
 			if (!m->isInMonophonicMode()) continue;
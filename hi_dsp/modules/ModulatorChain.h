@@ -168,6 +168,14 @@ public:
 	*/
 	void renderVoice(int voiceIndex, int startSample, int numSamples);
 
+	/** Calculates the envelopes that support batch processing for all given voices at once.
+	*
+	*	Call this before renderVoice() is called for each voice of the current block. The envelopes that return true
+	*	in EnvelopeModulator::canCalculateVoiceBatch() are calculated here and renderVoice() will only apply the stored
+	*	values. Calling this with less than two voices just clears the stored values from the last block.
+	*/
+	void renderVoiceBatch(const int* voiceIndexes, int numVoices, int startSample, int numSamples);
+
 	/** Returns a read pointer to the calculated voice values. The array size is supposed to be the size of the internal buffer. */
 	float *getVoiceValues(int voiceIndex) noexcept
 	{ return internalVoiceBuffer.getWritePointer(voiceIndex); };
@@ -200,6 +208,19 @@ public:
 	/** If you want the chain to only process voice start modulators, set this to true. */
 	void setIsVoiceStartChain(bool isVoiceStartChain_);
 
+	/** Sets the decimation factor for the envelopes of this chain.
+	*
+	*	If the factor is bigger than 1, the envelopes are prepared with the reduced sample rate and calculate one value
+	*	every 'factor' samples. The chain interpolates linearly between these values when it creates the voice values, which
+	*	delays the modulation by one control period. Use 8 or 16 to match the event raster of the ModulatorSynth.
+	*/
+	void setControlRateDownsamplingFactor(int newDownsamplingFactor);
+
+	int getControlRateDownsamplingFactor() const noexcept { return controlRateDownsamplingFactor; }
+
+	/** Returns the sample rate that is used by the envelopes of this chain. */
+	double getControlRateSampleRate() const noexcept { return getSampleRate() / (double)controlRateDownsamplingFactor; }
+
 	/** This renders all modulators as they were monophonic. This is useful for ModulatorChains that are not interested in polyphony (eg internal chains of non-polyphonic Modulators, but want to process polyphonic modulators.
 	*
 	*	The best thing is to use this method after / or before all voices are rendered.
@@ -282,6 +303,43 @@ private:
 	// Checks if the Modulators are initialized correctly and are set to the right voices */
 	bool checkModulatorStructure();
 
+	/** The interpolation state between two control values. */
+	struct ControlRateState
+	{
+		float currentValue;
+		float targetValue;
+		float delta;
+		int samplesLeft;
+		bool initialised;
+	};
+
+	/** Renders the envelopes at the control rate and multiplies the interpolated values with the destination.
+	*
+	*	Pass -1 as voiceIndex to render the envelopes that are in monophonic mode.
+	*/
+	void renderEnvelopesAtControlRate(int voiceIndex, float* destination, int numSamples);
+
+	// The envelopes are batched in chunks so that the scratch buffer stays in the cache.
+	static constexpr int VoiceBatchChunkSize = 64;
+
+	/** Allocates the voiceBatchBuffer if an envelope of this chain can be batched. */
+	void allocateVoiceBatchBufferIfNeeded();
+
+	// One channel per voice with the raw values of the batched envelope that is currently calculated (empty if nothing is batched)
+	AudioSampleBuffer voiceBatchBuffer;
+
+	float* voiceBatchDestinations[NUM_POLYPHONIC_VOICES];
+
+	// true if the batched envelope values for this voice are stored in the internalVoiceBuffer
+	bool voiceBatchPending[NUM_POLYPHONIC_VOICES];
+
+	int controlRateDownsamplingFactor = 1;
+
+	// One state per voice and one for the monophonic envelopes
+	HeapBlock<ControlRateState> controlRateStates;
+
+	AudioSampleBuffer controlRateBuffer;
+
 	BigInteger activeVoices;
 
 	// Saves 4 values of the envelope modulation result for later
@@ -130,6 +130,15 @@ ValueTree ModulatorSynth::exportAsValueTree() const
 
 	v.setProperty("IconColour", iconColour.toString(), nullptr);
 
+	if (useParallelVoiceRendering)
+		v.setProperty("ParallelVoiceRendering", true, nullptr);
+
+	if (useCoalescedRendering)
+		v.setProperty("CoalescedRendering", true, nullptr);
+
+	if (controlRateDownsamplingFactor != 1)
+		v.setProperty("ControlRateDownsampling", controlRateDownsamplingFactor, nullptr);
+
 	return v;
 }
 
@@ -144,6 +153,11 @@ void ModulatorSynth::restoreFromValueTree(const ValueTree &v)
 
 	iconColour = Colour::fromString(v.getProperty("IconColour", Colours::transparentBlack.toString()).toString());
 
+	useParallelVoiceRendering = v.getProperty("ParallelVoiceRendering", false);
+	useCoalescedRendering = v.getProperty("CoalescedRendering", false);
+
+	setControlRateDownsamplingFactor(v.getProperty("ControlRateDownsampling", 1));
+
 	Processor::restoreFromValueTree(v);
 }
 
@@ -326,6 +340,12 @@ void ModulatorSynth::processHiseEventBuffer(const HiseEventBuffer &inputBuffer,
 	}
 
 	midiProcessorChain->renderNextHiseEventBuffer(eventBuffer, numSamples);
+
+	if (eventBuffer.getNumDroppedEvents() != 0)
+	{
+		getMainController()->getDebugLogger().addEventBufferOverflow(this, eventBuffer.getNumDroppedEvents());
+		eventBuffer.resetDroppedEventCounter();
+	}
 }
 
 void ModulatorSynth::addProcessorsWhenEmpty()
@@ -371,7 +391,11 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 	HiseEvent m;
 	int midiEventPos;
 
-	while (numSamples > 0)
+	if (shouldUseCoalescedRendering())
+	{
+		renderCoalescedBlock(eventIterator, numSamplesFixed);
+	}
+	else while (numSamples > 0)
 	{
 		if (!eventIterator.getNextEvent(m, midiEventPos, true, false))
 		{
@@ -458,6 +482,79 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 	handlePeakDisplay(numSamplesFixed);
 }
 
+bool ModulatorSynth::shouldUseCoalescedRendering() const
+{
+	return useCoalescedRendering && supportsCoalescedRendering();
+}
+
+bool ModulatorSynth::isVoiceEvent(const HiseEvent& e) noexcept
+{
+	if (e.isController())
+	{
+		// Releasing the pedals stops the sustained voices
+		const int controllerNumber = e.getControllerNumber();
+		return controllerNumber == 0x40 || controllerNumber == 0x42;
+	}
+
+	return e.isNoteOnOrOff() || e.isAllNotesOff() || e.isVolumeFade() || e.isPitchFade();
+}
+
+void ModulatorSynth::renderCoalescedBlock(HiseEventBuffer::Iterator& eventIterator, int numSamples)
+{
+	int voiceStart = 0;
+	int chainStart = 0;
+
+	// The time variant modulation is cheap, so it is split at every event
+	auto renderChainsUntil = [&](int position)
+	{
+		if (position > chainStart)
+		{
+			preVoiceRendering(chainStart, position - chainStart);
+			gainChain->renderNextBlock(gainBuffer, chainStart, position - chainStart);
+			chainStart = position;
+		}
+	};
+
+	HiseEvent m;
+	int midiEventPos;
+	bool eventAfterBlock = false;
+
+	while (eventIterator.getNextEvent(m, midiEventPos, true, false))
+	{
+		const int rasteredPosition = midiEventPos - (midiEventPos % 8);
+
+		// Like the normal path, render the whole block before an event at the block end is handled
+		if (rasteredPosition >= numSamples)
+		{
+			eventAfterBlock = true;
+			break;
+		}
+
+		renderChainsUntil(rasteredPosition);
+
+		if (isVoiceEvent(m) && rasteredPosition - voiceStart >= 32)
+		{
+			renderVoice(voiceStart, rasteredPosition - voiceStart);
+			voiceStart = rasteredPosition;
+		}
+
+		handleHiseEvent(m);
+	}
+
+	renderChainsUntil(numSamples);
+
+	if (numSamples > voiceStart)
+		renderVoice(voiceStart, numSamples - voiceStart);
+
+	gainValuesArePrecalculated = true;
+	postVoiceRendering(0, numSamples);
+	gainValuesArePrecalculated = false;
+
+	// The remaining events are handled by the caller
+	if (eventAfterBlock)
+		handleHiseEvent(m);
+}
+
 void ModulatorSynth::preVoiceRendering(int startSample, int numThisTime)
 {
 	// calculate the variant pitch values before the voices are rendered.
@@ -472,6 +569,14 @@ void ModulatorSynth::renderVoice(int startSample, int numThisTime)
 {
     ADD_GLITCH_DETECTOR(this, DebugLogger::Location::SynthVoiceRendering);
     
+	calculateEnvelopeVoiceBatch(startSample, numThisTime);
+
+	if (shouldRenderVoicesInParallel())
+	{
+		renderVoicesInParallel(startSample, numThisTime);
+		return;
+	}
+
 	for (int i = 0; i < activeVoices.size(); i++)
 	{
 		//jassert(!activeVoices[i]->isInactive());
@@ -485,11 +590,94 @@ void ModulatorSynth::renderVoice(int startSample, int numThisTime)
 	}
 };
 
+
+void ModulatorSynth::calculateEnvelopeVoiceBatch(int startSample, int numThisTime)
+{
+	int voiceIndexes[NUM_POLYPHONIC_VOICES];
+	int numVoices = 0;
+
+	jassert(activeVoices.size() <= NUM_POLYPHONIC_VOICES);
+
+	for (int i = 0; i < activeVoices.size(); i++)
+	{
+		if (!activeVoices[i]->isInactive())
+			voiceIndexes[numVoices++] = activeVoices[i]->getVoiceIndex();
+	}
+
+	// The pitch chain is skipped because the voices only render it if the pitch modulation is active.
+	gainChain->renderVoiceBatch(voiceIndexes, numVoices, startSample, numThisTime);
+}
+
+void ModulatorSynth::setControlRateDownsamplingFactor(int newDownsamplingFactor)
+{
+	controlRateDownsamplingFactor = jlimit<int>(1, 64, newDownsamplingFactor);
+
+	gainChain->setControlRateDownsamplingFactor(controlRateDownsamplingFactor);
+	pitchChain->setControlRateDownsamplingFactor(controlRateDownsamplingFactor);
+}
+
+struct ModulatorSynth::ParallelVoiceRenderJob : public RealtimeWorkerPool::Job
+{
+	ParallelVoiceRenderJob(ModulatorSynthVoice** voices_, int startSample_, int numSamples_) :
+		voices(voices_),
+		startSample(startSample_),
+		numSamples(numSamples_)
+	{};
+
+	void runTask(int taskIndex, int threadIndex) override
+	{
+		voices[taskIndex]->calculateBlockOnWorkerThread(threadIndex, startSample, numSamples);
+	}
+
+	ModulatorSynthVoice** voices;
+	const int startSample;
+	const int numSamples;
+};
+
+bool ModulatorSynth::shouldRenderVoicesInParallel() const
+{
+	return useParallelVoiceRendering && 
+		   activeVoices.size() > 1 && 
+		   supportsParallelVoiceRendering() && 
+		   getMainController()->getRealtimeWorkerPool().isEnabled() &&
+		   !getMainController()->getRealtimeWorkerPool().isBusy();
+}
+
+void ModulatorSynth::renderVoicesInParallel(int startSample, int numThisTime)
+{
+	ModulatorSynthVoice* voicesToRender[NUM_POLYPHONIC_VOICES];
+	int numVoicesToRender = 0;
+
+	jassert(activeVoices.size() <= NUM_POLYPHONIC_VOICES);
+
+	// The modulation chains are not thread safe, so the first part is done here in the voice order...
+	for (int i = 0; i < activeVoices.size(); i++)
+	{
+		if (activeVoices[i]->prepareParallelRendering(startSample, numThisTime))
+			voicesToRender[numVoicesToRender++] = activeVoices[i];
+	}
+
+	ParallelVoiceRenderJob job(voicesToRender, startSample, numThisTime);
+
+	getMainController()->getRealtimeWorkerPool().run(job, numVoicesToRender);
+
+	// ... and the voices are summed in the same order to get the same output as the sequential rendering.
+	for (int i = 0; i < activeVoices.size(); i++)
+	{
+		activeVoices[i]->finishParallelRendering(internalBuffer, startSample, numThisTime);
+
+		if (activeVoices[i]->isInactive())
+		{
+			activeVoices.removeElement(i--);
+		}
+	}
+}
 	
 void ModulatorSynth::postVoiceRendering(int startSample, int numThisTime)
 {
 	// Calculate the timeVariant modulators
-	gainChain->renderNextBlock(gainBuffer, startSample, numThisTime);
+	if (!gainValuesArePrecalculated)
+		gainChain->renderNextBlock(gainBuffer, startSample, numThisTime);
 
 	CHECK_AND_LOG_BUFFER_DATA_WITH_ID(this, getIDAsIdentifier(), DebugLogger::Location::SynthPostVoiceRenderingGainMod, gainBuffer.getReadPointer(0, startSample), true, numThisTime);
 
@@ -735,6 +923,8 @@ void ModulatorSynth::prepareToPlay(double newSampleRate, int samplesPerBlock)
 		ProcessorHelpers::increaseBufferIfNeeded(pitchBuffer, samplesPerBlock);
 		ProcessorHelpers::increaseBufferIfNeeded(gainBuffer, samplesPerBlock);
 		ProcessorHelpers::increaseBufferIfNeeded(internalBuffer, samplesPerBlock);
+
+		eventBuffer.ensureCapacity(samplesPerBlock);
 		
 		for(int i = 0; i < getNumVoices(); i++)
 		{
@@ -850,55 +1040,76 @@ void ModulatorSynth::noteOn(const HiseEvent &m)
 	const int transposedMidiNoteNumber = midiNoteNumber + m.getTransposeAmount();
 	const float velocity = m.getFloatVelocity();
 
+	if (auto candidates = getSoundsForNoteOn(m))
+	{
+		// Only check the sounds that are mapped to this message (in the same order as below)
+		for (int i = candidates->size(); --i >= 0;)
+		{
+			ModulatorSynthSound *sound = candidates->getUnchecked(i);
+
+			if (soundCanBePlayed(sound, midiChannel, transposedMidiNoteNumber, velocity))
+				startNoteForSound(sound, m);
+		}
+
+		return;
+	}
+
     for (int i = sounds.size(); --i >= 0;)
     {
 		SynthesiserSound *s = sounds.getUnchecked(i);
         ModulatorSynthSound *sound = static_cast<ModulatorSynthSound*>(s);
 
 		if (soundCanBePlayed(sound, midiChannel, transposedMidiNoteNumber, velocity))
-        {
-            // If hitting a note that's still ringing, stop it first (it could be
-            // still playing because of the sustain or sostenuto pedal).
-            for (int j = voices.size(); --j >= 0;)
-            {
-                ModulatorSynthVoice* const voice = static_cast<ModulatorSynthVoice*>(voices.getUnchecked (j));
+			startNoteForSound(sound, m);
 
-				const bool voiceIsActive = voice->isPlayingChannel(midiChannel) && !voice->isBeingKilled();
+		// Deactivates starting of more than one voice per synth
+		//break;
+	}
+}
 
-				// if the voiceLimit is reached, kill the voice!
+void ModulatorSynth::startNoteForSound(ModulatorSynthSound* sound, const HiseEvent &m)
+{
+	const int midiChannel = m.getChannel();
+	const int midiNoteNumber = m.getNoteNumber();
+	const int transposedMidiNoteNumber = midiNoteNumber + m.getTransposeAmount();
 
-				if(voiceIsActive && j >= (internalVoiceLimit - 1)) 
-				{
-					killLastVoice();
-				}
+    // If hitting a note that's still ringing, stop it first (it could be
+    // still playing because of the sustain or sostenuto pedal).
+    for (int j = voices.size(); --j >= 0;)
+    {
+        ModulatorSynthVoice* const voice = static_cast<ModulatorSynthVoice*>(voices.getUnchecked (j));
 
-                else if (voice->getCurrentlyPlayingNote() == midiNoteNumber // Use the untransposed number for detecting repeated notes
-                     && voice->isPlayingChannel (midiChannel) && !(voice->getCurrentHiseEvent() == m))
-				{
-					handleRetriggeredNote(voice);
-				}
-            }
+		const bool voiceIsActive = voice->isPlayingChannel(midiChannel) && !voice->isBeingKilled();
 
-			ModulatorSynthVoice *v = static_cast<ModulatorSynthVoice*>(findFreeVoice (sound, midiChannel, midiNoteNumber, isNoteStealingEnabled()));
+		// if the voiceLimit is reached, kill the voice!
 
-			if( v != nullptr)
-			{
-				const int voiceIndex = v->getVoiceIndex();
+		if(voiceIsActive && j >= (internalVoiceLimit - 1)) 
+		{
+			killLastVoice();
+		}
 
-				jassert(voiceIndex != -1);
+        else if (voice->getCurrentlyPlayingNote() == midiNoteNumber // Use the untransposed number for detecting repeated notes
+             && voice->isPlayingChannel (midiChannel) && !(voice->getCurrentHiseEvent() == m))
+		{
+			handleRetriggeredNote(voice);
+		}
+    }
 
-				v->setStartUptime(getMainController()->getUptime());
+	ModulatorSynthVoice *v = static_cast<ModulatorSynthVoice*>(findFreeVoice (sound, midiChannel, midiNoteNumber, isNoteStealingEnabled()));
 
-				v->setCurrentHiseEvent(m);
+	if( v != nullptr)
+	{
+		const int voiceIndex = v->getVoiceIndex();
 
-				preStartVoice(voiceIndex, transposedMidiNoteNumber);
+		jassert(voiceIndex != -1);
 
-				startVoiceWithHiseEvent (v, sound, m);
-			}
+		v->setStartUptime(getMainController()->getUptime());
+
+		v->setCurrentHiseEvent(m);
+
+		preStartVoice(voiceIndex, transposedMidiNoteNumber);
 
-			// Deactivates starting of more than one voice per synth
-			//break;
-        }
+		startVoiceWithHiseEvent (v, sound, m);
 	}
 }
 
@@ -1265,32 +1476,60 @@ void ModulatorSynthVoice::renderNextBlock (AudioSampleBuffer& outputBuffer, int
 
 		calculateBlock(startSample, numSamples);
 
-		
-		if (gainFader.isSmoothing())
-		{
-			applyEventVolumeFade(startSample, numSamples);
-		}
-		else if (eventGainFactor != 1.0f)
-		{
-			applyEventVolumeFactor(startSample, numSamples);
-		}
+		addVoiceBufferToOutput(outputBuffer, startSample, numSamples);
+    }
+}
 
-		if(killThisVoice)
-		{
-			applyKillFadeout(startSample, numSamples);
-		}
+bool ModulatorSynthVoice::prepareParallelRendering(int startSample, int numSamples)
+{
+	parallelRenderingPending = isActive;
 
-		const int maxChannelAmount = jmin<int>(voiceBuffer.getNumChannels(), outputBuffer.getNumChannels());
+	if (isActive)
+	{
+		if (isPitchModulationActive()) calculateVoicePitchValues(startSample, numSamples);
 
-		for (int i = 0; i < maxChannelAmount; i++)
-		{
-			FloatVectorOperations::add(outputBuffer.getWritePointer(i, startSample), voiceBuffer.getReadPointer(i, startSample), numSamples);
-		}
+		prepareBlockForParallelRendering(startSample, numSamples);
+	}
 
+	return parallelRenderingPending;
+}
 
-		// checks if any envelopes are active and in their release state and calls stopNote until they are finished.
-		checkRelease();
-    }
+void ModulatorSynthVoice::finishParallelRendering(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+	if (parallelRenderingPending)
+	{
+		parallelRenderingPending = false;
+
+		finishBlockAfterParallelRendering(startSample, numSamples);
+		addVoiceBufferToOutput(outputBuffer, startSample, numSamples);
+	}
+}
+
+void ModulatorSynthVoice::addVoiceBufferToOutput(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+	if (gainFader.isSmoothing())
+	{
+		applyEventVolumeFade(startSample, numSamples);
+	}
+	else if (eventGainFactor != 1.0f)
+	{
+		applyEventVolumeFactor(startSample, numSamples);
+	}
+
+	if(killThisVoice)
+	{
+		applyKillFadeout(startSample, numSamples);
+	}
+
+	const int maxChannelAmount = jmin<int>(voiceBuffer.getNumChannels(), outputBuffer.getNumChannels());
+
+	for (int i = 0; i < maxChannelAmount; i++)
+	{
+		FloatVectorOperations::add(outputBuffer.getWritePointer(i, startSample), voiceBuffer.getReadPointer(i, startSample), numSamples);
+	}
+
+	// checks if any envelopes are active and in their release state and calls stopNote until they are finished.
+	checkRelease();
 }
 
 void ModulatorSynthVoice::setCurrentHiseEvent(const HiseEvent &m)
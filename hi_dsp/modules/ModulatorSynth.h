@@ -161,6 +161,37 @@ public:
 	/** This method is called to actually render all voices. It operates on the internal buffer of the ModulatorSynth. */
 	void renderVoice(int startSample, int numThisTime);
 
+	/** Enables the parallel voice rendering for this synth.
+	*
+	*	If enabled (and the synth supports it), the voices will be rendered by the RealtimeWorkerPool of the MainController
+	*	and summed in the voice order afterwards, so the output is the same as with the sequential rendering.
+	*/
+	void setUseParallelVoiceRendering(bool shouldRenderInParallel) noexcept { useParallelVoiceRendering = shouldRenderInParallel; }
+
+	bool isUsingParallelVoiceRendering() const noexcept { return useParallelVoiceRendering; }
+
+	/** Override this and return true if the voices of this synth can be rendered in parallel (see ModulatorSynthVoice::calculateBlockOnWorkerThread()). */
+	virtual bool supportsParallelVoiceRendering() const { return false; }
+
+	/** Enables the coalesced rendering of the sub blocks.
+	*
+	*	Normally the whole synth is rendered in sub blocks that are split at every event. If this is enabled, only the voices
+	*	are split at the events that start, stop or fade voices. The time variant modulators are still split at every event,
+	*	but the gain and effect chains process the full block after all voices are rendered, so dense controller
+	*	data and arpeggios don't split the effects into tiny blocks.
+	*/
+	void setUseCoalescedRendering(bool shouldBeCoalesced) noexcept { useCoalescedRendering = shouldBeCoalesced; }
+
+	bool isUsingCoalescedRendering() const noexcept { return useCoalescedRendering; }
+
+	/** Override this and return false if the synth relies on postVoiceRendering() being called for every sub block. */
+	virtual bool supportsCoalescedRendering() const { return true; }
+
+	/** Calculates the envelopes of the gain and pitch chain at a reduced rate (see ModulatorChain::setControlRateDownsamplingFactor()). */
+	void setControlRateDownsamplingFactor(int newDownsamplingFactor);
+
+	int getControlRateDownsamplingFactor() const noexcept { return controlRateDownsamplingFactor; }
+
 	/** This method is called to handle all modulatorchains after the voice rendering and handles the GUI metering. It assumes stereo mode.
 	*
 	*	The rendered buffer is supplied as reference to be able to apply changes here after all voices are rendered (eg. gain).
@@ -258,6 +289,14 @@ public:
 		/** Checks if the message fits the sound, but can be overriden to implement other group start logic. */
 	virtual bool soundCanBePlayed(ModulatorSynthSound *sound, int midiChannel, int midiNoteNumber, float velocity);
 
+	/** Returns a list of sounds that might be played by the note on message.
+	*
+	*	Synths with a lot of sounds can override this and return a precalculated list so that noteOn() doesn't have to check every sound.
+	*	The sounds in the list must be sorted by their index and will still be checked with soundCanBePlayed().
+	*	If this returns nullptr, all sounds will be checked.
+	*/
+	virtual const Array<ModulatorSynthSound*>* getSoundsForNoteOn(const HiseEvent& /*m*/) { return nullptr; }
+
 	void startVoiceWithHiseEvent(ModulatorSynthVoice* voice, SynthesiserSound *sound, const HiseEvent &e);
 
 	/** Same functionality as Synthesiser::noteOn(), but calls calculateVoiceStartValue() if a new voice is started. */
@@ -438,8 +477,33 @@ protected:
 
 private:
 
-	
+	/** Stops retriggered notes and starts a voice for the given sound. */
+	void startNoteForSound(ModulatorSynthSound* sound, const HiseEvent& m);
+
+	struct ParallelVoiceRenderJob;
 
+	/** Calculates the envelopes of the gain chain that support batch processing for all active voices at once. */
+	void calculateEnvelopeVoiceBatch(int startSample, int numThisTime);
+
+	bool shouldRenderVoicesInParallel() const;
+
+	void renderVoicesInParallel(int startSample, int numThisTime);
+
+	bool useParallelVoiceRendering = false;
+
+	bool shouldUseCoalescedRendering() const;
+
+	/** Checks if the event changes the voices (and therefore needs to split the voice rendering). */
+	static bool isVoiceEvent(const HiseEvent& e) noexcept;
+
+	void renderCoalescedBlock(HiseEventBuffer::Iterator& eventIterator, int numSamples);
+
+	bool useCoalescedRendering = false;
+
+	// Set while the coalesced block is finished, the gain values were already calculated for each sub block
+	bool gainValuesArePrecalculated = false;
+
+	int controlRateDownsamplingFactor = 1;
 
 	// ===================================================================================================================
 
@@ -525,6 +589,25 @@ public:
 
 
 	virtual void calculateBlock(int startSample, int numSamples) = 0;
+
+	/** Parallel voice rendering (see ModulatorSynth::setUseParallelVoiceRendering()).
+	*
+	*	If the synth supports parallel rendering, calculateBlock() will be split into three parts:
+	*
+	*	- prepareBlockForParallelRendering() is called on the audio thread for every voice (eg. to calculate the modulation values).
+	*	- calculateBlockOnWorkerThread() might be called on any thread at the same time as other voices. It must only write into
+	*	  the voice buffer and use the scratch buffers for the given thread index.
+	*	- finishBlockAfterParallelRendering() is called on the audio thread in the voice order.
+	*/
+	virtual void prepareBlockForParallelRendering(int /*startSample*/, int /*numSamples*/) { jassertfalse; }
+	virtual void calculateBlockOnWorkerThread(int /*threadIndex*/, int /*startSample*/, int /*numSamples*/) { jassertfalse; }
+	virtual void finishBlockAfterParallelRendering(int /*startSample*/, int /*numSamples*/) { jassertfalse; }
+
+	/** Calculates the modulation values and the first part of the voice rendering. Returns false if the voice is not active. */
+	bool prepareParallelRendering(int startSample, int numSamples);
+
+	/** Adds the voice buffer to the output buffer after the voice was rendered by a worker thread. */
+	void finishParallelRendering(AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
 	
 	void calculateVoicePitchValues(int startSample, int numSamples)
 	{
@@ -823,6 +906,11 @@ private:
 
 	ModulatorSynth* const ownerSynth;
 
+	/** Applies the fades and adds the voice buffer to the output. */
+	void addVoiceBufferToOutput(AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
+
+	bool parallelRenderingPending = false;
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModulatorSynthVoice)
 
 };
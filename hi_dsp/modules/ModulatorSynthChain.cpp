@@ -121,6 +121,8 @@ void ModulatorSynthChain::prepareToPlay(double newSampleRate, int samplesPerBloc
 	ModulatorSynth::prepareToPlay(newSampleRate, samplesPerBlock);
 
 	for (int i = 0; i < synths.size(); i++) synths[i]->prepareToPlay(newSampleRate, samplesPerBlock);
+
+	prepareChildSynthBuffers();
 }
 
 void ModulatorSynthChain::numSourceChannelsChanged()
@@ -139,7 +141,7 @@ void ModulatorSynthChain::numSourceChannelsChanged()
 
 	ModulatorSynth::numSourceChannelsChanged();
 
-	
+	prepareChildSynthBuffers();
 }
 
 void ModulatorSynthChain::numDestinationChannelsChanged()
@@ -161,6 +163,10 @@ ValueTree ModulatorSynthChain::exportAsValueTree() const
 		v.addChild(getMainController()->getMacroManager().getMidiControlAutomationHandler()->exportAsValueTree(), -1, nullptr);
 
 	}
+
+	if (useParallelChildRendering)
+		v.setProperty("ParallelChildRendering", true, nullptr);
+
 	return v;
 }
 
@@ -246,7 +252,14 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 	internalBuffer.setSize(getMatrix().getNumSourceChannels(), numSamples, true, false, true);
 
 	// Process the Synths and add store their output in the internal buffer
-	for (int i = 0; i < synths.size(); i++) if (!synths[i]->isSoftBypassed()) synths[i]->renderNextBlockWithModulators(internalBuffer, eventBuffer);
+	if (shouldRenderChildSynthsInParallel())
+	{
+		renderChildSynthsInParallel(numSamples);
+	}
+	else
+	{
+		for (int i = 0; i < synths.size(); i++) if (!synths[i]->isSoftBypassed()) synths[i]->renderNextBlockWithModulators(internalBuffer, eventBuffer);
+	}
 
 	HiseEventBuffer::Iterator eventIterator(eventBuffer);
 
@@ -311,10 +324,168 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 }
 
 
+struct ModulatorSynthChain::ChildSynthRenderJob : public RealtimeWorkerPool::Job
+{
+	ChildSynthRenderJob(ModulatorSynth** synthsToRender_, float** channels_, int numChannels_, int numSamples_, const HiseEventBuffer& eventBuffer_) :
+		synthsToRender(synthsToRender_),
+		channels(channels_),
+		numChannels(numChannels_),
+		numSamples(numSamples_),
+		eventBuffer(eventBuffer_)
+	{};
+
+	void runTask(int taskIndex, int /*threadIndex*/) override
+	{
+		AudioSampleBuffer output(channels + taskIndex * numChannels, numChannels, numSamples);
+		output.clear();
+
+		synthsToRender[taskIndex]->renderNextBlockWithModulators(output, eventBuffer);
+	}
+
+	ModulatorSynth** synthsToRender;
+	float** channels;
+	const int numChannels;
+	const int numSamples;
+	const HiseEventBuffer& eventBuffer;
+};
+
+void ModulatorSynthChain::setUseParallelChildRendering(bool shouldRenderInParallel)
+{
+	useParallelChildRendering = shouldRenderInParallel;
+
+	prepareChildSynthBuffers();
+}
+
+bool ModulatorSynthChain::canBeRenderedConcurrently(const ModulatorSynth* childSynth)
+{
+	// These synths render their children with the audio lock or provide data for other modules
+	if (dynamic_cast<const ModulatorSynthChain*>(childSynth) != nullptr ||
+		dynamic_cast<const ModulatorSynthGroup*>(childSynth) != nullptr ||
+		dynamic_cast<const GlobalModulatorContainer*>(childSynth) != nullptr)
+	{
+		return false;
+	}
+
+	// The routing matrix locks the audio lock when the peak values are sent to the editor
+	if (childSynth->getMatrix().isEditorShown())
+		return false;
+
+	// Scripts share global data and can access other modules, so they must be executed on the audio thread.
+	// This is called for every block, so it walks the tree instead of using the (allocating) Processor::Iterator.
+	struct Helper
+	{
+		static bool containsScript(const Processor* p)
+		{
+			if (dynamic_cast<const ProcessorWithScriptingContent*>(p) != nullptr)
+				return true;
+
+			for (int i = 0; i < p->getNumChildProcessors(); i++)
+			{
+				if (containsScript(p->getChildProcessor(i)))
+					return true;
+			}
+
+			return false;
+		}
+	};
+
+	return !Helper::containsScript(childSynth);
+}
+
+bool ModulatorSynthChain::shouldRenderChildSynthsInParallel() const
+{
+	auto& pool = getMainController()->getRealtimeWorkerPool();
+
+	return useParallelChildRendering &&
+		   synths.size() > 1 &&
+		   pool.isEnabled() &&
+		   !pool.isBusy() &&
+		   !getMainController()->getDebugLogger().isLogging() &&
+		   childSynthBuffer.getNumChannels() >= synths.size() * internalBuffer.getNumChannels() &&
+		   childSynthBuffer.getNumSamples() >= internalBuffer.getNumSamples();
+}
+
+void ModulatorSynthChain::renderChildSynthsInParallel(int numSamples)
+{
+	const int numChannels = internalBuffer.getNumChannels();
+	float** channels = childSynthBuffer.getArrayOfWritePointers();
+
+	int i = 0;
+
+	while (i < synths.size())
+	{
+		ModulatorSynth* s = synths[i];
+
+		if (s->isSoftBypassed())
+		{
+			i++;
+			continue;
+		}
+
+		if (!canBeRenderedConcurrently(s))
+		{
+			s->renderNextBlockWithModulators(internalBuffer, eventBuffer);
+			i++;
+			continue;
+		}
+
+		// Collect all following child synths that can be rendered at the same time...
+		childSynthsToRender.clearQuick();
+
+		while (i < synths.size() && (synths[i]->isSoftBypassed() || canBeRenderedConcurrently(synths[i])))
+		{
+			if (!synths[i]->isSoftBypassed())
+				childSynthsToRender.add(synths[i]);
+
+			i++;
+		}
+
+		if (childSynthsToRender.size() == 1)
+		{
+			childSynthsToRender.getFirst()->renderNextBlockWithModulators(internalBuffer, eventBuffer);
+			continue;
+		}
+
+		ChildSynthRenderJob job(childSynthsToRender.getRawDataPointer(), channels, numChannels, numSamples, eventBuffer);
+
+		getMainController()->getRealtimeWorkerPool().run(job, childSynthsToRender.size());
+
+		// ... and add their output in the child order so that the result doesn't depend on the thread timing.
+		for (int j = 0; j < childSynthsToRender.size(); j++)
+		{
+			for (int c = 0; c < numChannels; c++)
+			{
+				FloatVectorOperations::add(internalBuffer.getWritePointer(c, 0), channels[j * numChannels + c], numSamples);
+			}
+		}
+	}
+}
+
+void ModulatorSynthChain::prepareChildSynthBuffers()
+{
+	if (!useParallelChildRendering)
+		return;
+
+	ScopedLock sl(getSynthLock());
+
+	const int numChannels = getMatrix().getNumSourceChannels() * synths.size();
+	const int numSamples = getBlockSize();
+
+	childSynthsToRender.ensureStorageAllocated(synths.size());
+
+	if (numSamples > 0 && (numChannels > childSynthBuffer.getNumChannels() || numSamples > childSynthBuffer.getNumSamples()))
+	{
+		childSynthBuffer.setSize(jmax<int>(numChannels, childSynthBuffer.getNumChannels()), 
+								 jmax<int>(numSamples, childSynthBuffer.getNumSamples()));
+	}
+}
+
 void ModulatorSynthChain::restoreFromValueTree(const ValueTree &v)
 {
 	packageName = v.getProperty("packageName", "");
 
+	useParallelChildRendering = v.getProperty("ParallelChildRendering", false);
+
 	ModulatorSynth::restoreFromValueTree(v);
 
 	ValueTree autoData = v.getChildWithName("MidiAutomation");
@@ -534,6 +705,8 @@ void ModulatorSynthChain::ModulatorSynthChainHandler::add(Processor *newProcesso
 		synth->synths.insert(index, ms);
 	}
 
+	synth->prepareChildSynthBuffers();
+
 	sendChangeMessage();
 }
 
@@ -229,8 +229,35 @@ public:
 
 	HiseEvent::ChannelFilterData* getActiveChannelData() { return &activeChannels; }
 
+	/** Enables the parallel rendering of the child synths.
+	*
+	*	If enabled, child synths that don't depend on other modules will be rendered by the RealtimeWorkerPool
+	*	into their own buffers, which are summed in the child order afterwards. Child synths that might access
+	*	other modules (eg. because they contain a script) are rendered on the audio thread in their original position.
+	*/
+	void setUseParallelChildRendering(bool shouldRenderInParallel);
+
+	bool isUsingParallelChildRendering() const noexcept { return useParallelChildRendering; }
+
 private:
 
+	struct ChildSynthRenderJob;
+
+	/** Returns true if the child synth only accesses its own state while rendering. */
+	static bool canBeRenderedConcurrently(const ModulatorSynth* childSynth);
+
+	bool shouldRenderChildSynthsInParallel() const;
+
+	void renderChildSynthsInParallel(int numSamples);
+
+	/** Resizes the buffers for the parallel rendering. Call this whenever the child synths or the channel amount changes. */
+	void prepareChildSynthBuffers();
+
+	bool useParallelChildRendering = false;
+
+	AudioSampleBuffer childSynthBuffer;
+	Array<ModulatorSynth*> childSynthsToRender;
+
 	HiseEvent::ChannelFilterData activeChannels;
 	ModulatorSynthChainHandler handler;
 	int numVoices;
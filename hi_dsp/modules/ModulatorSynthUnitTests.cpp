@@ -0,0 +1,265 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class ParallelChildRenderingUnitTest : public UnitTest
+{
+public:
+
+	ParallelChildRenderingUnitTest() :
+		UnitTest("Testing the parallel child synth rendering")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testIdenticalOutput(4, 512);
+		testIdenticalOutput(7, 64);
+		testIdenticalOutput(2, 17);
+	}
+
+private:
+
+	enum
+	{
+		NumBlocks = 40
+	};
+
+	/** Creates a processor with sine generators that use different pitches so that every child synth produces another signal. */
+	static UnitTestAudioProcessor* createProcessor(int numChildSynths, bool renderInParallel, int blockSize)
+	{
+		auto p = new UnitTestAudioProcessor();
+
+		for (int i = 0; i < numChildSynths; i++)
+		{
+			auto s = new SineSynth(p, "Sine" + String(i + 1), NUM_POLYPHONIC_VOICES);
+
+			s->setAttribute(SineSynth::SemiTones, (float)(i * 5 % 12), dontSendNotification);
+			s->setAttribute(ModulatorSynth::Gain, 1.0f / (float)(i + 1), dontSendNotification);
+
+			p->addSynth(s);
+		}
+
+		p->getMainSynthChain()->setUseParallelChildRendering(renderInParallel);
+		p->prepareToPlay(44100.0, blockSize);
+
+		return p;
+	}
+
+	/** Adds note ons in the first blocks and note offs in the middle of the rendering. */
+	static void fillMidiBuffer(MidiBuffer& mb, int blockIndex, int blockSize)
+	{
+		mb.clear();
+
+		const int notes[] = { 60, 64, 67, 71 };
+
+		for (int i = 0; i < 4; i++)
+		{
+			if (blockIndex == i)
+				mb.addEvent(MidiMessage::noteOn(1, notes[i], (uint8)(127 - i * 20)), (i * 13) % blockSize);
+
+			if (blockIndex == NumBlocks / 2 + i)
+				mb.addEvent(MidiMessage::noteOff(1, notes[i]), (i * 7) % blockSize);
+		}
+	}
+
+	void testIdenticalOutput(int numChildSynths, int blockSize)
+	{
+		beginTest("Testing identical output with " + String(numChildSynths) + " child synths and " + String(blockSize) + " samples");
+
+		ScopedPointer<UnitTestAudioProcessor> serial = createProcessor(numChildSynths, false, blockSize);
+		ScopedPointer<UnitTestAudioProcessor> parallel = createProcessor(numChildSynths, true, blockSize);
+
+		if (!parallel->getRealtimeWorkerPool().isEnabled())
+			logMessage("The realtime worker pool has no threads, so the parallel processor renders the child synths serially");
+
+		AudioSampleBuffer serialOutput(2, blockSize);
+		AudioSampleBuffer parallelOutput(2, blockSize);
+		MidiBuffer serialMidi;
+		MidiBuffer parallelMidi;
+
+		float maxLevel = 0.0f;
+
+		for (int block = 0; block < NumBlocks; block++)
+		{
+			fillMidiBuffer(serialMidi, block, blockSize);
+			fillMidiBuffer(parallelMidi, block, blockSize);
+
+			serialOutput.clear();
+			parallelOutput.clear();
+
+			serial->processBlock(serialOutput, serialMidi);
+			parallel->processBlock(parallelOutput, parallelMidi);
+
+			for (int c = 0; c < 2; c++)
+			{
+				const float* s = serialOutput.getReadPointer(c);
+				const float* p = parallelOutput.getReadPointer(c);
+
+				for (int i = 0; i < blockSize; i++)
+				{
+					if (std::abs(s[i] - p[i]) > 1e-6f)
+					{
+						expectEquals<float>(p[i], s[i], "Sample " + String(i) + " in channel " + String(c) + " of block " + String(block));
+						return;
+					}
+				}
+			}
+
+			maxLevel = jmax<float>(maxLevel, serialOutput.getMagnitude(0, blockSize));
+		}
+
+		expect(maxLevel > 0.1f, "The child synths didn't produce any signal");
+	}
+};
+
+static ParallelChildRenderingUnitTest parallelChildRenderingUnitTest;
+
+
+class CoalescedRenderingUnitTest : public UnitTest
+{
+public:
+
+	CoalescedRenderingUnitTest() :
+		UnitTest("Testing the coalesced sub block rendering")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testIdenticalOutput(512);
+		testIdenticalOutput(64);
+		testIdenticalOutput(40);
+	}
+
+private:
+
+	enum
+	{
+		NumBlocks = 24
+	};
+
+	static UnitTestAudioProcessor* createProcessor(bool useCoalescedRendering, int blockSize)
+	{
+		auto p = new UnitTestAudioProcessor();
+
+		auto s = new SineSynth(p, "Sine", NUM_POLYPHONIC_VOICES);
+		s->setUseCoalescedRendering(useCoalescedRendering);
+
+		p->addSynth(s);
+		p->prepareToPlay(44100.0, blockSize);
+
+		return p;
+	}
+
+	/** Adds a note at the block start and pairs of notes close to each other and in the last raster of the block. */
+	static void fillMidiBuffer(MidiBuffer& mb, int blockIndex, int blockSize)
+	{
+		mb.clear();
+
+		const int positions[] = { 0, 13, 20, blockSize - 5, blockSize - 1 };
+
+		for (int i = 0; i < 5; i++)
+		{
+			const int noteNumber = 48 + i * 7;
+
+			if (blockIndex == 2 * ((i + 1) / 2))
+				mb.addEvent(MidiMessage::noteOn(1, noteNumber, (uint8)100), positions[i]);
+
+			if (blockIndex == 11 + 2 * ((i + 1) / 2))
+				mb.addEvent(MidiMessage::noteOff(1, noteNumber), positions[4 - i]);
+		}
+	}
+
+	void testIdenticalOutput(int blockSize)
+	{
+		beginTest("Testing identical output with " + String(blockSize) + " samples");
+
+		ScopedPointer<UnitTestAudioProcessor> normal = createProcessor(false, blockSize);
+		ScopedPointer<UnitTestAudioProcessor> coalesced = createProcessor(true, blockSize);
+
+		AudioSampleBuffer normalOutput(2, blockSize);
+		AudioSampleBuffer coalescedOutput(2, blockSize);
+		MidiBuffer normalMidi;
+		MidiBuffer coalescedMidi;
+
+		float maxLevel = 0.0f;
+
+		for (int block = 0; block < NumBlocks; block++)
+		{
+			fillMidiBuffer(normalMidi, block, blockSize);
+			fillMidiBuffer(coalescedMidi, block, blockSize);
+
+			normalOutput.clear();
+			coalescedOutput.clear();
+
+			normal->processBlock(normalOutput, normalMidi);
+			coalesced->processBlock(coalescedOutput, coalescedMidi);
+
+			for (int c = 0; c < 2; c++)
+			{
+				const float* n = normalOutput.getReadPointer(c);
+				const float* s = coalescedOutput.getReadPointer(c);
+
+				for (int i = 0; i < blockSize; i++)
+				{
+					if (std::abs(n[i] - s[i]) > 1e-6f)
+					{
+						expectEquals<float>(s[i], n[i], "Sample " + String(i) + " in channel " + String(c) + " of block " + String(block));
+						return;
+					}
+				}
+			}
+
+			maxLevel = jmax<float>(maxLevel, normalOutput.getMagnitude(0, blockSize));
+		}
+
+		expect(maxLevel > 0.1f, "The synth didn't produce any signal");
+	}
+};
+
+static CoalescedRenderingUnitTest coalescedRenderingUnitTest;
+
+} // namespace hise
+
+#endif
@@ -725,6 +725,31 @@ public:
     /** Checks if the Envelope is active for the given voice. Overwrite this and return true as long as you want the envelope to sound. */
 	virtual bool isPlaying(int voiceIndex) const = 0;
 
+	/** Overwrite this and return true if the envelope can calculate multiple voices at once with calculateVoiceBatch(). 
+	*
+	*	The ModulatorChain will then call calculateVoiceBatch() once for all active voices instead of calling renderNextBlock()
+	*	for every voice.
+	*/
+	virtual bool canCalculateVoiceBatch() const { return false; }
+
+	/** Calculates the raw envelope values of the given voices.
+	*
+	*	@param voiceIndexes the indexes of the voices that should be calculated.
+	*	@param numVoices the number of voices.
+	*	@param destinations an array with one pointer per voice where the values (without the intensity) will be written to.
+	*	@param numSamples the number of samples.
+	*/
+	virtual void calculateVoiceBatch(const int* /*voiceIndexes*/, int /*numVoices*/, float** /*destinations*/, int /*numSamples*/) { jassertfalse; }
+
+	/** Applies the values that were calculated with calculateVoiceBatch() to the destination using the intensity of this envelope. */
+	void applyVoiceBatchValues(float* calculatedValues, float* destination, int numSamples) const noexcept
+	{
+		if (getMode() == PitchMode)
+			applyPitchModulation(calculatedValues, destination, getIntensity(), numSamples);
+		else
+			applyGainModulation(calculatedValues, destination, getIntensity(), numSamples);
+	}
+
 	float getAttribute(int parameterIndex) const override
 	{
 		switch (parameterIndex)
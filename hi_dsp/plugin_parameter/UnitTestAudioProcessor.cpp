@@ -0,0 +1,76 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise { using namespace juce;
+
+#if HI_RUN_UNIT_TESTS
+
+UnitTestAudioProcessor::UnitTestAudioProcessor():
+	PluginParameterAudioProcessor("Unit Test Processor"),
+	MainController()
+{
+	synthChain = new ModulatorSynthChain(this, "Master Chain", NUM_POLYPHONIC_VOICES);
+
+	// The settings are written back when this processor is deleted, so they must be loaded like in the other processors
+	restoreGlobalSettings(this);
+	initData(this);
+}
+
+UnitTestAudioProcessor::~UnitTestAudioProcessor()
+{
+	getSampleManager().cancelAllJobs();
+
+	ScopedLock sl(getLock());
+
+	synthChain = nullptr;
+}
+
+void UnitTestAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+	setRateAndBufferSizeDetails(sampleRate, samplesPerBlock);
+
+	getDelayedRenderer().prepareToPlayWrapped(sampleRate, samplesPerBlock);
+}
+
+void UnitTestAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& midiMessages)
+{
+	getDelayedRenderer().processWrapped(buffer, midiMessages);
+}
+
+void UnitTestAudioProcessor::addSynth(ModulatorSynth* newSynth)
+{
+	synthChain->getHandler()->add(newSynth, nullptr);
+}
+
+#endif
+
+} // namespace hise
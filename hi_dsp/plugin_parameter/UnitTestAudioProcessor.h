@@ -0,0 +1,92 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#ifndef UNITTESTAUDIOPROCESSOR_H_INCLUDED
+#define UNITTESTAUDIOPROCESSOR_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+#if HI_RUN_UNIT_TESTS
+
+/** A minimal MainController without editor or audio device that can be used to render modules in unit tests.
+*
+*	Add the modules to the master chain, call prepareToPlay() and render the blocks with processBlock(). The audio goes through
+*	the same MainController::processBlockCommon() path as in the plugin, so the MIDI messages get their event IDs.
+*/
+class UnitTestAudioProcessor : public PluginParameterAudioProcessor,
+							   public GlobalSettingManager,
+							   public MainController
+{
+public:
+
+	UnitTestAudioProcessor();
+	~UnitTestAudioProcessor();
+
+	ModulatorSynthChain* getMainSynthChain() override { return synthChain; }
+	const ModulatorSynthChain* getMainSynthChain() const override { return synthChain; }
+
+	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+	void releaseResources() override {};
+	void processBlock(AudioSampleBuffer& buffer, MidiBuffer& midiMessages) override;
+
+	const String getName() const override { return "Unit Test Processor"; }
+	double getTailLengthSeconds() const override { return 0.0; }
+	bool acceptsMidi() const override { return true; }
+	bool producesMidi() const override { return false; }
+
+	AudioProcessorEditor* createEditor() override { return nullptr; }
+	bool hasEditor() const override { return false; }
+
+	int getNumPrograms() override { return 1; }
+	int getCurrentProgram() override { return 0; }
+	void setCurrentProgram(int /*index*/) override {};
+	const String getProgramName(int /*index*/) override { return String(); }
+	void changeProgramName(int /*index*/, const String& /*newName*/) override {};
+
+	void getStateInformation(MemoryBlock& /*destData*/) override {};
+	void setStateInformation(const void* /*data*/, int /*sizeInBytes*/) override {};
+
+	/** Adds the synth to the master chain. */
+	void addSynth(ModulatorSynth* newSynth);
+
+private:
+
+	ScopedPointer<ModulatorSynthChain> synthChain;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UnitTestAudioProcessor);
+};
+
+#endif
+
+} // namespace hise
+
+#endif  // UNITTESTAUDIOPROCESSOR_H_INCLUDED
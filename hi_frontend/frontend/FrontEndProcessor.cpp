@@ -85,7 +85,7 @@ void FrontendProcessor::handleControllersForMacroKnobs(const MidiBuffer &midiMes
 #endif
 #endif
 
-FrontendProcessor::FrontendProcessor(ValueTree &synthData, AudioDeviceManager* manager, AudioProcessorPlayer* callback_, ValueTree *imageData_/*=nullptr*/, ValueTree *impulseData/*=nullptr*/, ValueTree *externalFiles/*=nullptr*/, ValueTree *) :
+FrontendProcessor::FrontendProcessor(ValueTree &synthData, AudioDeviceManager* manager, AudioProcessorPlayer* callback_, ResourceArchive* imageArchive/*=nullptr*/, ResourceArchive* impulseArchive/*=nullptr*/, ValueTree *externalFiles/*=nullptr*/, ValueTree *) :
 MainController(),
 PluginParameterAudioProcessor(ProjectHandler::Frontend::getProjectName()),
 AudioProcessorDriver(manager, callback_),
@@ -120,7 +120,7 @@ unlockCounter(0)
     
 	LOG_START("Load images");
 
-	loadImages(imageData_);
+	loadImages(imageArchive);
 
 	if (externalFiles != nullptr)
 	{
@@ -130,16 +130,21 @@ unlockCounter(0)
 		sampleMaps = externalFiles->getChildWithName("SampleMaps");
 	}
     
-	if (impulseData != nullptr)
+	if (impulseArchive != nullptr)
 	{
-		getSampleManager().getAudioSampleBufferPool()->restoreFromValueTree(*impulseData);
+		getSampleManager().getAudioSampleBufferPool()->setResourceArchive(impulseArchive);
 	}
 	else
 	{
 		File audioResourceFile(ProjectHandler::Frontend::getAppDataDirectory().getChildFile("AudioResources.dat"));
 
-		if (audioResourceFile.existsAsFile())
+		if (auto archive = ResourceArchive::getOrCreate(audioResourceFile))
 		{
+			getSampleManager().getAudioSampleBufferPool()->setResourceArchive(archive);
+		}
+		else if (audioResourceFile.existsAsFile())
+		{
+			// Resource file from an older version
 			FileInputStream fis(audioResourceFile);
 
 			LOG_START("Load impulses");
@@ -228,7 +233,7 @@ void FrontendProcessor::setCurrentProgram(int /*index*/)
 	return;
 }
 
-void FrontendProcessor::loadImages(ValueTree *imageData)
+void FrontendProcessor::loadImages(ResourceArchive* imageArchive)
 {
 #if HISE_IOS
     
@@ -236,12 +241,17 @@ void FrontendProcessor::loadImages(ValueTree *imageData)
     return;
 #endif
     
-	if (imageData == nullptr)
+	if (imageArchive == nullptr)
 	{
 		File imageResources = ProjectHandler::Frontend::getAppDataDirectory().getChildFile("ImageResources.dat");
 
-		if (imageResources.existsAsFile())
+		if (auto archive = ResourceArchive::getOrCreate(imageResources))
+		{
+			getSampleManager().getImagePool()->setResourceArchive(archive);
+		}
+		else if (imageResources.existsAsFile())
 		{
+			// Resource file from an older version
 			FileInputStream fis(imageResources);
 
 			auto t = ValueTree::readFromStream(fis);
@@ -256,7 +266,7 @@ void FrontendProcessor::loadImages(ValueTree *imageData)
 	}
 	else
 	{
-		getSampleManager().getImagePool()->restoreFromValueTree(*imageData);
+		getSampleManager().getImagePool()->setResourceArchive(imageArchive);
 	}
 }
 
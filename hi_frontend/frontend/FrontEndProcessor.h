@@ -83,7 +83,7 @@ class FrontendProcessor: public PluginParameterAudioProcessor,
 						 public FrontendSampleManager
 {
 public:
-	FrontendProcessor(ValueTree &synthData, AudioDeviceManager* manager, AudioProcessorPlayer* callback_, ValueTree *imageData_ = nullptr, ValueTree *impulseData = nullptr, ValueTree *externalScriptData = nullptr, ValueTree *userPresets = nullptr);
+	FrontendProcessor(ValueTree &synthData, AudioDeviceManager* manager, AudioProcessorPlayer* callback_, ResourceArchive* imageArchive = nullptr, ResourceArchive* impulseArchive = nullptr, ValueTree *externalScriptData = nullptr, ValueTree *userPresets = nullptr);
 
 	const String getName(void) const override;
 
@@ -265,7 +265,7 @@ public:
 
 private:
 
-	void loadImages(ValueTree *imageData);
+	void loadImages(ResourceArchive* imageArchive);
 	
 	friend class FrontendProcessorEditor;
 	friend class DefaultFrontendBar;
@@ -112,15 +112,15 @@ ValueTree externalFiles = hise::PresetHandler::loadValueTreeFromData(PresetData:
 #define CREATE_PLUGIN_WITH_AUDIO_FILES(deviceManager, callback) {\
     LOG_START("Loading embedded instrument data")\
     ValueTree presetData = ValueTree::readFromData(PresetData::preset, PresetData::presetSize);\
-	LOG_START("Loading embedded image data")\
-	ValueTree imageData = hise::PresetHandler::loadValueTreeFromData(PresetData::images, PresetData::imagesSize, false);\
-	LOG_START("Loading embedded impulse responses")\
-	ValueTree impulseData = hise::PresetHandler::loadValueTreeFromData(PresetData::impulses, PresetData::impulsesSize, false); \
+	LOG_START("Opening embedded image data")\
+	auto imageArchive = hise::ResourceArchive::getOrCreate(PresetData::images, PresetData::imagesSize);\
+	LOG_START("Opening embedded impulse responses")\
+	auto impulseArchive = hise::ResourceArchive::getOrCreate(PresetData::impulses, PresetData::impulsesSize); \
 	LOG_START("Loading embedded other data")\
 	ValueTree externalFiles = hise::PresetHandler::loadValueTreeFromData(PresetData::externalFiles, PresetData::externalFilesSize, true);\
 	\
 	LOG_START("Creating Frontend Processor")\
-	auto fp = new hise::FrontendProcessor(presetData, deviceManager, callback, &imageData, &impulseData, &externalFiles, nullptr); \
+	auto fp = new hise::FrontendProcessor(presetData, deviceManager, callback, imageArchive.get(), impulseArchive.get(), &externalFiles, nullptr); \
     hise::UserPresetHelpers::extractUserPresets(PresetData::userPresets, PresetData::userPresetsSize);\
 	hise::AudioProcessorDriver::restoreSettings(fp);\
 	hise::GlobalSettingManager::restoreGlobalSettings(fp); \
@@ -101,7 +101,25 @@ If enabled, then the unit test suite will be compiled and added to all unit test
 #define HLAC_INCLUDE_TEST_SUITE 0
 #endif
 
+//=============================================================================
+/** Config: HLAC_USE_SIMD_DECODING
+
+If enabled, the decoder uses SSE2 / AVX2 kernels for the bit unpacking. The instruction set is chosen at runtime.
+*/
+#ifndef HLAC_USE_SIMD_DECODING
+#if JUCE_INTEL
+#define HLAC_USE_SIMD_DECODING 1
+#else
+#define HLAC_USE_SIMD_DECODING 0
+#endif
+#endif
+
+#if HLAC_USE_SIMD_DECODING
+#include <immintrin.h>
+#endif
+
 
+#include "hlac/SIMDDecoding.h"
 #include "hlac/BitCompressors.h"
 #include "hlac/CompressionHelpers.h"
 #include "hlac/SampleBuffer.h"
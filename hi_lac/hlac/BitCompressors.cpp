@@ -144,6 +144,19 @@ void unpackArrayOfInt16(int16* d, int /*numValues*/, uint8 bitDepth)
 }
 
 
+/** Decodes the vectorisable part with the SIMD kernels and advances the pointers to the remaining values. */
+void unpackWithSIMD(int16*& destination, const uint8*& data, int& numValues, int numBytes, int bitDepth, int valuesPerGroup, int bytesPerGroup)
+{
+	const int numUnpacked = SIMDDecoding::unpack(destination, data, numValues, numBytes, bitDepth);
+
+	jassert(numUnpacked % valuesPerGroup == 0);
+
+	destination += numUnpacked;
+	data += (numUnpacked / valuesPerGroup) * bytesPerGroup;
+	numValues -= numUnpacked;
+}
+
+
 int BitCompressors::ZeroBit::getAllowedBitRange() const
 {
 	return 0;
@@ -219,6 +232,8 @@ bool BitCompressors::OneBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::OneBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 1, 8, 1);
+
 	const uint8 masks[8] = { 0b00000001, 0b00000010, 0b00000100, 0b00001000,
 		0b00010000, 0b00100000, 0b01000000, 0b10000000 };
 
@@ -314,6 +329,8 @@ bool BitCompressors::TwoBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::TwoBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 2, 4, 1);
+
 	const uint8 signMasks[4] =  { 0b00000010, 0b00001000, 0b00100000, 0b10000000 };
 	const uint8 valueMasks[4] = { 0b00000001, 0b00000100, 0b00010000, 0b01000000 };
 
@@ -427,6 +444,8 @@ bool BitCompressors::FourBit::compress(uint8* destination, const int16* data, in
 
 bool BitCompressors::FourBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 4, 2, 1);
+
 	
 
 	const uint8 signMasks[2] =  { 0b00001000, 0b10000000 };
@@ -539,6 +558,8 @@ bool BitCompressors::SixBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::SixBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 6, 8, 6);
+
 #if HLAC_NO_SSE
 	while (numValuesToDecompress >= 8)
 	{
@@ -704,6 +725,8 @@ bool BitCompressors::EightBit::compress(uint8* destination, const int16* data, i
 
 bool BitCompressors::EightBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 8, 1, 1);
+
     while (--numValuesToDecompress >= 0)
 	{
 		const int8 value = *reinterpret_cast<const int8*>(data++);
@@ -791,6 +814,8 @@ bool BitCompressors::TenBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::TenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 10, 8, 10);
+
 	while (numValuesToDecompress >= 8)
 	{
 		decompress10Bit(reinterpret_cast<uint16*>(destination), (void*)data);
@@ -885,6 +910,8 @@ bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data
 
 #else
 
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 12, 8, 12);
+
 	int16* dst = destination;
 
 	while (numValuesToDecompress >= 4)
@@ -1003,6 +1030,8 @@ bool BitCompressors::FourteenBit::compress(uint8* destination, const int16* data
 
 bool BitCompressors::FourteenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	unpackWithSIMD(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 14, 8, 14);
+
 	while (numValuesToDecompress >= 8)
 	{
 		decompress14Bit(destination, data);
@@ -828,7 +828,11 @@ void CompressionHelpers::Diff::distributeFullSamples(AudioBufferInt16& dst, cons
 
 #if HLAC_NO_SSE
 
-	for (int i = 0; i < numSamples - 2; i++)
+	const int numVectorised = SIMDDecoding::distributeFullSamples(d, r, numSamples - 2);
+
+	d += 4 * numVectorised;
+
+	for (int i = numVectorised; i < numSamples - 2; i++)
 	{
 		thisValue = (int)r[i];
 		nextValue = (int)r[i + 1];
@@ -939,6 +943,12 @@ void CompressionHelpers::Diff::addErrorSignal(AudioBufferInt16& dst, const uint1
 
 #if HLAC_NO_SSE
 
+	const int numTriplets = SIMDDecoding::addErrorSignal(d, e, numSamples);
+
+	d += 4 * numTriplets;
+	e += 3 * numTriplets;
+	numSamples -= 3 * numTriplets;
+
 	while (numSamples > 2)
 	{
 		counter += 4;
@@ -1038,6 +1048,11 @@ uint32 CompressionHelpers::Misc::createChecksum()
 	r.setSeedRandomly();
 	r.setSeedRandomly();
 
+	return createChecksum(r);
+}
+
+uint32 CompressionHelpers::Misc::createChecksum(Random& r)
+{
 	uint16 randomNumber = (uint16)r.nextInt(Range<int>(2, UINT16_MAX));
 
 	uint8* d = reinterpret_cast<uint8*>(&randomNumber);
@@ -180,6 +180,9 @@ struct CompressionHelpers
 
 		static uint32 createChecksum();
 
+		/** Creates a checksum using the given random generator (so that the encoder output is reproducible). */
+		static uint32 createChecksum(Random& r);
+
 		static bool validateChecksum(uint32 data);
 	};
 
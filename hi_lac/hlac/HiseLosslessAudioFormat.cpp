@@ -295,7 +295,9 @@ bool HiseLosslessHeader::write(OutputStream* output)
 	if (headerByte1 < 2)
 		return true;
 
-	auto checkSum = CompressionHelpers::Misc::createChecksum();
+	// Use a fixed seed so that the same data always results in the same file
+	Random checksumGenerator(0);
+	auto checkSum = CompressionHelpers::Misc::createChecksum(checksumGenerator);
 
 	output->writeInt((int)checkSum);
 
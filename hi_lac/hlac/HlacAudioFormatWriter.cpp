@@ -54,6 +54,8 @@ bool HiseLosslessAudioFormatWriter::flush()
 	if (tempWasFlushed)
 		return true;
 
+	encodePendingBuffers();
+
 	if (!writeHeader())
 		return false;
 
@@ -72,6 +74,41 @@ void HiseLosslessAudioFormatWriter::setOptions(HlacEncoder::CompressorOptions& n
 	encoder.setOptions(newOptions);
 }
 
+void HiseLosslessAudioFormatWriter::setThreadPool(ThreadPool* newThreadPool)
+{
+	encodePendingBuffers();
+
+	threadPool = newThreadPool;
+	encoder.setThreadPool(newThreadPool);
+}
+
+void HiseLosslessAudioFormatWriter::encodePendingBuffers()
+{
+	if (pendingBuffers.isEmpty())
+		return;
+
+	Array<AudioSampleBuffer*> sources;
+
+	for (auto b : pendingBuffers)
+		sources.add(b);
+
+	encoder.compress(sources, *tempOutputStream, blockOffsets);
+
+	pendingBuffers.clear();
+	numPendingSamples = 0;
+}
+
+void HiseLosslessAudioFormatWriter::addPendingBuffer(const AudioSampleBuffer& b)
+{
+	// The buffer only references the data of the caller, so we need to copy it.
+	auto copy = new AudioSampleBuffer(b.getNumChannels(), b.getNumSamples());
+
+	for (int i = 0; i < b.getNumChannels(); i++)
+		copy->copyFrom(i, 0, b, i, 0, b.getNumSamples());
+
+	pendingBuffers.add(copy);
+}
+
 bool HiseLosslessAudioFormatWriter::write(const int** samplesToWrite, int numSamples)
 {
 	tempWasFlushed = false;
@@ -86,7 +123,10 @@ bool HiseLosslessAudioFormatWriter::write(const int** samplesToWrite, int numSam
 
 			AudioSampleBuffer b = AudioSampleBuffer(r, 2, numSamples);
 
-			encoder.compress(b, *tempOutputStream, blockOffsets);
+			if (threadPool != nullptr)
+				addPendingBuffer(b);
+			else
+				encoder.compress(b, *tempOutputStream, blockOffsets);
 		}
 		else
 		{
@@ -94,7 +134,21 @@ bool HiseLosslessAudioFormatWriter::write(const int** samplesToWrite, int numSam
 
 			AudioSampleBuffer b = AudioSampleBuffer(&r, 1, numSamples);
 
-			encoder.compress(b, *tempOutputStream, blockOffsets);
+			if (threadPool != nullptr)
+				addPendingBuffer(b);
+			else
+				encoder.compress(b, *tempOutputStream, blockOffsets);
+		}
+
+		if (threadPool != nullptr)
+		{
+			// Collect enough blocks so that all threads of the pool have something to do
+			const int maxPendingSamples = COMPRESSION_BLOCK_SIZE * 256;
+
+			numPendingSamples += numSamples;
+
+			if (numPendingSamples >= maxPendingSamples)
+				encodePendingBuffers();
 		}
 
 	}
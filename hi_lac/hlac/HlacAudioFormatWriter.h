@@ -56,16 +56,30 @@ public:
 
 	bool write(const int** samplesToWrite, int numSamples) override;
 
-	double getCompressionRatioForLastFile() { return encoder.getCompressionRatio(); }
+	double getCompressionRatioForLastFile()
+	{
+		encodePendingBuffers();
+		return encoder.getCompressionRatio();
+	}
 
 	/** You can use a temporary file instead of the memory buffer if you encode large files. */
 	void setTemporaryBufferType(bool shouldUseTemporaryFile);
 
+	/** Sets a thread pool that is used by the encoder.
+	*
+	*	The data passed into write() will be buffered and encoded in parallel. The output is identical to the serial encoding.
+	*/
+	void setThreadPool(ThreadPool* newThreadPool);
+
 private:
 
 	bool writeHeader();
 	bool writeDataFromTemp();
 
+	void encodePendingBuffers();
+
+	void addPendingBuffer(const AudioSampleBuffer& b);
+
 	void deleteTemp();
 
 	ScopedPointer<TemporaryFile> tempFile;
@@ -78,6 +92,11 @@ private:
 
 	HlacEncoder encoder;
 
+	ThreadPool* threadPool = nullptr;
+
+	OwnedArray<AudioSampleBuffer> pendingBuffers;
+	int numPendingSamples = 0;
+
 	EncodeMode mode;
 	HlacEncoder::CompressorOptions options;
 
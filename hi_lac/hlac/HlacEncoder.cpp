@@ -30,80 +30,121 @@
 
 namespace hlac { using namespace juce; 
 
+class HlacEncoder::ParallelEncodeJob : public ThreadPoolJob
+{
+public:
+
+	ParallelEncodeJob(const CompressorOptions& options, Array<BlockData>& blocks_, std::atomic<int>& nextBlockIndex_) :
+		ThreadPoolJob("HLAC Encoding"),
+		blocks(blocks_),
+		nextBlockIndex(nextBlockIndex_)
+	{
+		encoder.options = options;
+	}
+
+	JobStatus runJob() override
+	{
+		encoder.encodeBlocks(blocks, nextBlockIndex);
+		return jobHasFinished;
+	}
+
+	HlacEncoder encoder;
+
+private:
+
+	Array<BlockData>& blocks;
+	std::atomic<int>& nextBlockIndex;
+};
+
 void HlacEncoder::compress(AudioSampleBuffer& source, OutputStream& output, uint32* blockOffsetData)
 {
-	bool compressStereo = source.getNumChannels() == 2;
+	Array<AudioSampleBuffer*> sources;
+	sources.add(&source);
+
+	compress(sources, output, blockOffsetData);
+}
+
+void HlacEncoder::compress(const Array<AudioSampleBuffer*>& sources, OutputStream& output, uint32* blockOffsetData)
+{
+	Array<BlockData> blocks;
 
-	if (source.getNumSamples() == COMPRESSION_BLOCK_SIZE)
+	for (auto source : sources)
 	{
-		blockOffsetData[blockIndex] = numBytesWritten;
-		++blockIndex;
+		const int numChannelsToEncode = source->getNumChannels() == 2 ? 2 : 1;
+		const int numSamples = source->getNumSamples();
 
-		if (compressStereo)
+		for (int offset = 0; offset < numSamples; offset += COMPRESSION_BLOCK_SIZE)
 		{
-			auto l = CompressionHelpers::getPart(source, 0, 0, COMPRESSION_BLOCK_SIZE);
-			encodeBlock(l, output);
-			auto r = CompressionHelpers::getPart(source, 1, 0, COMPRESSION_BLOCK_SIZE);
-			encodeBlock(r, output);
-		}
-		else
-			encodeBlock(source, output);
+			const int numThisTime = jmin<int>(COMPRESSION_BLOCK_SIZE, numSamples - offset);
+
+			for (int c = 0; c < numChannelsToEncode; c++)
+			{
+				BlockData b;
 
-		return;
+				b.source = source->getReadPointer(c, offset);
+				b.numSamples = numThisTime;
+				b.isFirstChannel = c == 0;
+
+				blocks.add(b);
+			}
+		}
 	}
 
-	blockOffset = 0;
-	int32 numSamplesRemaining = source.getNumSamples();
+	std::atomic<int> nextBlockIndex(0);
 
-	while (numSamplesRemaining >= COMPRESSION_BLOCK_SIZE)
+	if (threadPool != nullptr && blocks.size() > 1)
 	{
-		blockOffsetData[blockIndex] = numBytesWritten;
-		++blockIndex;
+		OwnedArray<ParallelEncodeJob> jobs;
 
-		uint32 numTodo = jmin<int>(COMPRESSION_BLOCK_SIZE, source.getNumSamples());
+		const int numJobs = jmin<int>(threadPool->getNumThreads(), blocks.size() - 1);
 
-		if (compressStereo)
+		for (int i = 0; i < numJobs; i++)
 		{
-			auto l = CompressionHelpers::getPart(source, 0, blockOffset, numTodo);
-			encodeBlock(l, output);
-			auto r = CompressionHelpers::getPart(source, 1, blockOffset, numTodo);
-			encodeBlock(r, output);
-		}
-		else
-		{
-			auto b = CompressionHelpers::getPart(source, blockOffset, numTodo);
-			encodeBlock(b, output);
+			jobs.add(new ParallelEncodeJob(options, blocks, nextBlockIndex));
+			threadPool->addJob(jobs.getLast(), false);
 		}
 
+		// The calling thread takes part in the encoding too.
+		encodeBlocks(blocks, nextBlockIndex);
 
-		blockOffset += numTodo;
+		for (auto job : jobs)
+		{
+			threadPool->waitForJobToFinish(job, -1);
 
-		numSamplesRemaining -= numTodo;
+			numBytesUncompressed += job->encoder.numBytesUncompressed;
+			numTemplates += job->encoder.numTemplates;
+			numDeltas += job->encoder.numDeltas;
+		}
 	}
-
-	if (source.getNumSamples() - blockOffset > 0)
+	else
 	{
-		blockOffsetData[blockIndex] = numBytesWritten;
-		++blockIndex;
-
-		const int remaining = source.getNumSamples() - blockOffset;
+		encodeBlocks(blocks, nextBlockIndex);
+	}
 
-		if (compressStereo)
-		{
-			auto l = CompressionHelpers::getPart(source, 0, blockOffset, remaining);
-			encodeLastBlock(l, output);
-			auto r = CompressionHelpers::getPart(source, 1, blockOffset, remaining);
-			encodeLastBlock(r, output);
-		}
-		else
+	// The blocks are written in their original order, so the output is the same as with serial encoding.
+	for (const auto& b : blocks)
+	{
+		if (b.isFirstChannel)
 		{
-			auto b = CompressionHelpers::getPart(source, blockOffset, remaining);
-			encodeLastBlock(b, output);
+			blockOffsetData[blockIndex] = numBytesWritten;
+			++blockIndex;
 		}
 
+		writeBlockData(b.encodedData, output);
 	}
+}
 
-	
+void HlacEncoder::encodeBlocks(Array<BlockData>& blocks, std::atomic<int>& nextBlockIndex)
+{
+	for (int i = nextBlockIndex++; i < blocks.size(); i = nextBlockIndex++)
+	{
+		auto& b = blocks.getReference(i);
+
+		float* data = const_cast<float*>(b.source);
+		AudioSampleBuffer block(&data, 1, b.numSamples);
+
+		b.encodedData = createBlockData(block);
+	}
 }
 
 void HlacEncoder::reset()
@@ -121,6 +162,7 @@ void HlacEncoder::reset()
 	bitRateForCurrentCycle = 0;
 	firstCycleLength = -1;
 	ratio = 0.0f;
+	checksumGenerator.setSeed(0);
 }
 
 
@@ -137,36 +179,36 @@ float HlacEncoder::getCompressionRatio() const
 	return (float)(numBytesWritten) / (float)(numBytesUncompressed);
 }
 
-bool HlacEncoder::encodeBlock(AudioSampleBuffer& block, OutputStream& output)
+MemoryBlock HlacEncoder::createBlockData(AudioSampleBuffer& block)
 {
 	auto block16 = CompressionHelpers::AudioBufferInt16(block, 0, false);
 
-	return encodeBlock(block16, output);
-}
+	if (block16.size < COMPRESSION_BLOCK_SIZE)
+		return createLastBlockData(block16);
 
-bool HlacEncoder::encodeBlock(CompressionHelpers::AudioBufferInt16& block16, OutputStream& output)
-{
 	auto compressedBlock = createCompressedBlock(block16);
 
-	auto thisBlockSize = compressedBlock.getSize();
-
-	writeChecksumBytesForBlock(output);
-
-	if (thisBlockSize > 2 * COMPRESSION_BLOCK_SIZE)
+	if (compressedBlock.getSize() > 2 * COMPRESSION_BLOCK_SIZE)
 	{
-		writeCycleHeader(true, 16, COMPRESSION_BLOCK_SIZE, output);
+		MemoryOutputStream uncompressed;
 
-		numBytesWritten += sizeof(int16)*COMPRESSION_BLOCK_SIZE + 3;
+		writeUncompressed(block16, uncompressed);
 
-		return output.write(block16.getReadPointer(), sizeof(int16) * COMPRESSION_BLOCK_SIZE);
-	}
-	else
-	{
-		numBytesWritten += (uint32)compressedBlock.getSize();
-		return output.write(compressedBlock.getData(), compressedBlock.getSize());
+		uncompressed.flush();
+		return uncompressed.getMemoryBlock();
 	}
+
+	return compressedBlock;
 }
 
+bool HlacEncoder::writeBlockData(const MemoryBlock& blockData, OutputStream& output)
+{
+	if (!writeChecksumBytesForBlock(output))
+		return false;
+
+	numBytesWritten += (uint32)blockData.getSize();
+	return output.write(blockData.getData(), blockData.getSize());
+}
 
 MemoryBlock HlacEncoder::createCompressedBlock(CompressionHelpers::AudioBufferInt16& block16)
 {
@@ -326,7 +368,7 @@ uint8 HlacEncoder::getBitReductionAmountForMSEncoding(AudioSampleBuffer& block)
 bool HlacEncoder::writeChecksumBytesForBlock(OutputStream& output)
 {
 	
-	auto checkSum = CompressionHelpers::Misc::createChecksum();
+	auto checkSum = CompressionHelpers::Misc::createChecksum(checksumGenerator);
 
 	if (!output.writeInt((int)checkSum))
 		return false;
@@ -423,7 +465,7 @@ bool HlacEncoder::encodeDiff(CompressionHelpers::AudioBufferInt16& cycle, Output
 	if (numBytesForFull > 0)
 	{
 		MemoryBlock mbFull;
-		mbFull.setSize(numBytesForFull);
+		mbFull.setSize(numBytesForFull, true);
 		compressorFull->compress((uint8*)mbFull.getData(), packedBuffer.getReadPointer(), numFullValues);
 
 		if (!output.write(mbFull.getData(), numBytesForFull))
@@ -435,7 +477,7 @@ bool HlacEncoder::encodeDiff(CompressionHelpers::AudioBufferInt16& cycle, Output
 	if (numBytesForError > 0)
 	{
 		MemoryBlock mbError;
-		mbError.setSize(numBytesForError);
+		mbError.setSize(numBytesForError, true);
 		compressorError->compress((uint8*)mbError.getData(), packedErrorBuffer.getReadPointer(), numErrorValues);
 
 		
@@ -509,17 +551,13 @@ bool HlacEncoder::writeDiffHeader(int fullBitRate, int errorBitRate, int blockSi
 }
 
 
-void HlacEncoder::encodeLastBlock(AudioSampleBuffer& block, OutputStream& output)
+MemoryBlock HlacEncoder::createLastBlockData(CompressionHelpers::AudioBufferInt16& block16)
 {
-	writeChecksumBytesForBlock(output);
-
 	MemoryOutputStream lastTemp;
 
-	CompressionHelpers::AudioBufferInt16 a(block, 0, false);
+	encodeCycle(block16, lastTemp);
 
-	encodeCycle(a, lastTemp);
-
-	int numZerosToPad = COMPRESSION_BLOCK_SIZE - a.size;
+	int numZerosToPad = COMPRESSION_BLOCK_SIZE - block16.size;
 
 	jassert(numZerosToPad > 0);
 
@@ -528,10 +566,7 @@ void HlacEncoder::encodeLastBlock(AudioSampleBuffer& block, OutputStream& output
 	writeCycleHeader(true, 0, numZerosToPad, lastTemp);
 
 	lastTemp.flush();
-
-	output.write(lastTemp.getData(), lastTemp.getDataSize());
-
-	numBytesWritten += (uint32)lastTemp.getDataSize();
+	return lastTemp.getMemoryBlock();
 }
 
 
@@ -147,9 +147,22 @@ public:
 
 
 	void compress(AudioSampleBuffer& source, OutputStream& output, uint32* blockOffsetData);
+
+	/** Compresses the buffers one after another.
+	*
+	*	If a thread pool is set, the blocks of all buffers are encoded in parallel. They are written in
+	*	the original order, so the output is identical to calling compress() for each buffer.
+	*/
+	void compress(const Array<AudioSampleBuffer*>& sources, OutputStream& output, uint32* blockOffsetData);
 	
 	void reset();
 
+	/** Sets a thread pool that is used to encode independent blocks in parallel. Pass nullptr to encode on the calling thread. */
+	void setThreadPool(ThreadPool* newThreadPool)
+	{
+		threadPool = newThreadPool;
+	}
+
 	void setOptions(CompressorOptions& newOptions)
 	{
 		options = newOptions;
@@ -161,9 +174,24 @@ public:
 
 private:
 
-	bool encodeBlock(AudioSampleBuffer& block, OutputStream& output);
+	class ParallelEncodeJob;
+
+	/** A single channel of a block that can be encoded independently. */
+	struct BlockData
+	{
+		const float* source = nullptr;
+		int numSamples = 0;
+		bool isFirstChannel = true;
+		MemoryBlock encodedData;
+	};
+
+	void encodeBlocks(Array<BlockData>& blocks, std::atomic<int>& nextBlockIndex);
+
+	MemoryBlock createBlockData(AudioSampleBuffer& block);
 
-	bool encodeBlock(CompressionHelpers::AudioBufferInt16& block, OutputStream& output);
+	MemoryBlock createLastBlockData(CompressionHelpers::AudioBufferInt16& block16);
+
+	bool writeBlockData(const MemoryBlock& blockData, OutputStream& output);
 
 	MemoryBlock createCompressedBlock(CompressionHelpers::AudioBufferInt16& block);
 
@@ -181,7 +209,6 @@ private:
 	bool encodeCycle(CompressionHelpers::AudioBufferInt16& cycle, OutputStream& output);
 	bool encodeDiff(CompressionHelpers::AudioBufferInt16& cycle, OutputStream& output);
 	bool encodeCycleDelta(CompressionHelpers::AudioBufferInt16& nextCycle, OutputStream& output);
-	void  encodeLastBlock(AudioSampleBuffer& block, OutputStream& output);
 
 	bool writeCycleHeader(bool isTemplate, int bitDepth, int numSamples, OutputStream& output);
 	bool writeDiffHeader(int fullBitRate, int errorBitRate, int blockSize, OutputStream& output);
@@ -215,7 +242,9 @@ private:
 
 	CompressorOptions options;
 
-	
+	ThreadPool* threadPool = nullptr;
+
+	Random checksumGenerator;
 
 	float ratio = 0.0f;
 
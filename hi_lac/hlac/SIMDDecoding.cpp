@@ -0,0 +1,471 @@
+/*  HISE Lossless Audio Codec
+*	2017 Christoph Hart
+*
+*	Redistribution and use in source and binary forms, with or without modification,
+*	are permitted provided that the following conditions are met:
+*
+*	1. Redistributions of source code must retain the above copyright notice,
+*	   this list of conditions and the following disclaimer.
+*
+*	2. Redistributions in binary form must reproduce the above copyright notice,
+*	   this list of conditions and the following disclaimer in the documentation
+*	   and/or other materials provided with the distribution.
+*
+*	3. All advertising materials mentioning features or use of this software must
+*	   display the following acknowledgement:
+*	   This product includes software developed by Hart Instruments
+*
+*	4. Neither the name of the copyright holder nor the names of its contributors may be used
+*	   to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY CHRISTOPH HART "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+*	BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*	DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+*	SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+*	THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+*	ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*/
+
+namespace hlac { using namespace juce;
+
+#if HLAC_USE_SIMD_DECODING
+
+#if JUCE_MSVC
+#define HLAC_AVX2_FUNCTION
+#else
+#define HLAC_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+
+namespace SIMDKernels
+{
+
+/** The bit layout of the 6, 10, 12 and 14 bit formats.
+*
+*	These formats store eight values MSB first in bitDepth / 2 words, so every value is either
+*	contained in a single word or split across two neighbouring words. The lookup tables contain
+*	the word indexes and the multipliers that shift each part into place.
+*/
+struct PackedLayout
+{
+	PackedLayout(int bitDepth_) :
+		bitDepth(bitDepth_),
+		numBytes(bitDepth_),
+		rightShift(16 - bitDepth_),
+		offset((int16)((1 << (bitDepth_ - 1)) - 1))
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			const int startBit = i * bitDepth;
+			const int wordIndex = startBit / 16;
+			const int bitOffset = startBit % 16;
+			const int numBitsInNextWord = bitOffset + bitDepth - 16;
+
+			hiIndex[i] = wordIndex;
+			hiMultiplier[i] = (uint16)(1 << bitOffset);
+			hiShuffle[2 * i] = (uint8)(2 * wordIndex);
+			hiShuffle[2 * i + 1] = (uint8)(2 * wordIndex + 1);
+
+			if (numBitsInNextWord > 0)
+			{
+				loIndex[i] = wordIndex + 1;
+				loMultiplier[i] = (uint16)(1 << numBitsInNextWord);
+				loShuffle[2 * i] = (uint8)(2 * wordIndex + 2);
+				loShuffle[2 * i + 1] = (uint8)(2 * wordIndex + 3);
+			}
+			else
+			{
+				loIndex[i] = wordIndex;
+				loMultiplier[i] = 0;
+				loShuffle[2 * i] = 0x80;
+				loShuffle[2 * i + 1] = 0x80;
+			}
+		}
+	}
+
+	const int bitDepth;
+	const int numBytes;
+	const int rightShift;
+	const int16 offset;
+
+	int hiIndex[8];
+	int loIndex[8];
+	uint16 hiMultiplier[8];
+	uint16 loMultiplier[8];
+	uint8 hiShuffle[16];
+	uint8 loShuffle[16];
+};
+
+static const PackedLayout& getPackedLayout(int bitDepth)
+{
+	static const PackedLayout layouts[4] = { PackedLayout(6), PackedLayout(10), PackedLayout(12), PackedLayout(14) };
+
+	switch (bitDepth)
+	{
+	case 6:		return layouts[0];
+	case 10:	return layouts[1];
+	case 12:	return layouts[2];
+	default:	jassert(bitDepth == 14);
+				return layouts[3];
+	}
+}
+
+inline __m128i conditionalNegate(__m128i value, __m128i negateMask)
+{
+	return _mm_sub_epi16(_mm_xor_si128(value, negateMask), negateMask);
+}
+
+inline __m128i isBitSet(__m128i value, __m128i mask)
+{
+	return _mm_cmpeq_epi16(_mm_and_si128(value, mask), mask);
+}
+
+static int unpackOneBitSSE2(int16* destination, const uint8* data, int numValues)
+{
+	const __m128i masks = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		const __m128i x = _mm_set1_epi16(*data++);
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), _mm_srli_epi16(isBitSet(x, masks), 15));
+
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+static int unpackTwoBitSSE2(int16* destination, const uint8* data, int numValues)
+{
+	const __m128i valueMasks = _mm_setr_epi16(1, 4, 16, 64, 1, 4, 16, 64);
+	const __m128i signMasks = _mm_setr_epi16(2, 8, 32, 128, 2, 8, 32, 128);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		const __m128i x = _mm_unpacklo_epi64(_mm_set1_epi16(data[0]), _mm_set1_epi16(data[1]));
+
+		const __m128i value = _mm_srli_epi16(isBitSet(x, valueMasks), 15);
+		const __m128i sign = isBitSet(x, signMasks);
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), conditionalNegate(value, sign));
+
+		data += 2;
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+static int unpackFourBitSSE2(int16* destination, const uint8* data, int numValues)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i valueMask = _mm_set1_epi16(0b0111);
+	const __m128i lowSignMask = _mm_set1_epi16(0b00001000);
+	const __m128i highSignMask = _mm_set1_epi16(0b10000000);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 16)
+	{
+		const __m128i x = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)data), zero);
+
+		const __m128i low = conditionalNegate(_mm_and_si128(x, valueMask), isBitSet(x, lowSignMask));
+		const __m128i high = conditionalNegate(_mm_and_si128(_mm_srli_epi16(x, 4), valueMask), isBitSet(x, highSignMask));
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), _mm_unpacklo_epi16(low, high));
+		_mm_storeu_si128((__m128i*)(destination + numDone + 8), _mm_unpackhi_epi16(low, high));
+
+		data += 8;
+		numDone += 16;
+	}
+
+	return numDone;
+}
+
+static int unpackEightBitSSE2(int16* destination, const uint8* data, int numValues)
+{
+	int numDone = 0;
+
+	while (numValues - numDone >= 16)
+	{
+		const __m128i x = _mm_loadu_si128((const __m128i*)(data + numDone));
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8));
+		_mm_storeu_si128((__m128i*)(destination + numDone + 8), _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8));
+
+		numDone += 16;
+	}
+
+	return numDone;
+}
+
+static int unpackPackedSSE2(int16* destination, const uint8* data, int numValues, const PackedLayout& l)
+{
+	const __m128i hiMultiplier = _mm_loadu_si128((const __m128i*)l.hiMultiplier);
+	const __m128i loMultiplier = _mm_loadu_si128((const __m128i*)l.loMultiplier);
+	const __m128i shift = _mm_cvtsi32_si128(l.rightShift);
+	const __m128i offset = _mm_set1_epi16(l.offset);
+
+	const int* h = l.hiIndex;
+	const int* lo = l.loIndex;
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		const uint16* w = reinterpret_cast<const uint16*>(data);
+
+		const __m128i hiWords = _mm_setr_epi16(w[h[0]], w[h[1]], w[h[2]], w[h[3]], w[h[4]], w[h[5]], w[h[6]], w[h[7]]);
+		const __m128i loWords = _mm_setr_epi16(w[lo[0]], w[lo[1]], w[lo[2]], w[lo[3]], w[lo[4]], w[lo[5]], w[lo[6]], w[lo[7]]);
+
+		__m128i v = _mm_srl_epi16(_mm_mullo_epi16(hiWords, hiMultiplier), shift);
+		v = _mm_or_si128(v, _mm_mulhi_epu16(loWords, loMultiplier));
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), _mm_sub_epi16(v, offset));
+
+		data += l.numBytes;
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+HLAC_AVX2_FUNCTION static int unpackEightBitAVX2(int16* destination, const uint8* data, int numValues)
+{
+	int numDone = 0;
+
+	while (numValues - numDone >= 16)
+	{
+		const __m256i x = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(data + numDone)));
+
+		_mm256_storeu_si256((__m256i*)(destination + numDone), x);
+
+		numDone += 16;
+	}
+
+	return numDone;
+}
+
+HLAC_AVX2_FUNCTION static int unpackPackedAVX2(int16* destination, const uint8* data, int numValues, int numBytes, const PackedLayout& l)
+{
+	const __m128i hiShuffle128 = _mm_loadu_si128((const __m128i*)l.hiShuffle);
+	const __m128i loShuffle128 = _mm_loadu_si128((const __m128i*)l.loShuffle);
+	const __m128i hiMultiplier128 = _mm_loadu_si128((const __m128i*)l.hiMultiplier);
+	const __m128i loMultiplier128 = _mm_loadu_si128((const __m128i*)l.loMultiplier);
+
+	const __m256i hiShuffle = _mm256_inserti128_si256(_mm256_castsi128_si256(hiShuffle128), hiShuffle128, 1);
+	const __m256i loShuffle = _mm256_inserti128_si256(_mm256_castsi128_si256(loShuffle128), loShuffle128, 1);
+	const __m256i hiMultiplier = _mm256_inserti128_si256(_mm256_castsi128_si256(hiMultiplier128), hiMultiplier128, 1);
+	const __m256i loMultiplier = _mm256_inserti128_si256(_mm256_castsi128_si256(loMultiplier128), loMultiplier128, 1);
+	const __m128i shift = _mm_cvtsi32_si128(l.rightShift);
+	const __m256i offset = _mm256_set1_epi16(l.offset);
+
+	int numDone = 0;
+	int byteOffset = 0;
+
+	// Each 128 bit lane decodes one group, but the loads are 16 bytes wide so we
+	// must not run into the end of the data.
+	while (numValues - numDone >= 16 && byteOffset + l.numBytes + 16 <= numBytes)
+	{
+		const __m128i first = _mm_loadu_si128((const __m128i*)(data + byteOffset));
+		const __m128i second = _mm_loadu_si128((const __m128i*)(data + byteOffset + l.numBytes));
+		const __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1);
+
+		__m256i v = _mm256_srl_epi16(_mm256_mullo_epi16(_mm256_shuffle_epi8(x, hiShuffle), hiMultiplier), shift);
+		v = _mm256_or_si256(v, _mm256_mulhi_epu16(_mm256_shuffle_epi8(x, loShuffle), loMultiplier));
+
+		_mm256_storeu_si256((__m256i*)(destination + numDone), _mm256_sub_epi16(v, offset));
+
+		byteOffset += 2 * l.numBytes;
+		numDone += 16;
+	}
+
+	return numDone + unpackPackedSSE2(destination + numDone, data + byteOffset, numValues - numDone, l);
+}
+
+inline __m128i int16ToInt32(__m128i x)
+{
+	return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+}
+
+/** Integer divisions that round towards zero like the scalar code. */
+inline __m128i divideByFour(__m128i x)
+{
+	return _mm_srai_epi32(_mm_add_epi32(x, _mm_and_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(3))), 2);
+}
+
+inline __m128i divideByTwo(__m128i x)
+{
+	return _mm_srai_epi32(_mm_add_epi32(x, _mm_srli_epi32(x, 31)), 1);
+}
+
+static int distributeFullSamplesSSE2(int16* d, const int16* r, int numFullValues)
+{
+	int i = 0;
+
+	for (; i + 4 <= numFullValues; i += 4)
+	{
+		const __m128i a = int16ToInt32(_mm_loadl_epi64((const __m128i*)(r + i)));
+		const __m128i b = int16ToInt32(_mm_loadl_epi64((const __m128i*)(r + i + 1)));
+
+		const __m128i v2 = divideByFour(_mm_add_epi32(_mm_add_epi32(a, a), _mm_add_epi32(a, b)));
+		const __m128i v3 = divideByTwo(_mm_add_epi32(a, b));
+		const __m128i v4 = divideByFour(_mm_add_epi32(_mm_add_epi32(b, b), _mm_add_epi32(b, a)));
+
+		const __m128i p13 = _mm_packs_epi32(a, v3);
+		const __m128i p24 = _mm_packs_epi32(v2, v4);
+
+		const __m128i lo = _mm_unpacklo_epi16(p13, p24);
+		const __m128i hi = _mm_unpackhi_epi16(p13, p24);
+
+		_mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi32(lo, hi));
+		_mm_storeu_si128((__m128i*)(d + 8), _mm_unpackhi_epi32(lo, hi));
+
+		d += 16;
+	}
+
+	return i;
+}
+
+static int addErrorSignalSSE2(int16* d, const int16* e, int numErrorValues)
+{
+	int numTriplets = 0;
+
+	// The last load reads one value after the fourth triplet
+	while (numErrorValues > 12)
+	{
+		const __m128i e1 = _mm_slli_si128(_mm_loadl_epi64((const __m128i*)e), 2);
+		const __m128i e2 = _mm_slli_si128(_mm_loadl_epi64((const __m128i*)(e + 3)), 2);
+		const __m128i e3 = _mm_slli_si128(_mm_loadl_epi64((const __m128i*)(e + 6)), 2);
+		const __m128i e4 = _mm_slli_si128(_mm_loadl_epi64((const __m128i*)(e + 9)), 2);
+
+		const __m128i d1 = _mm_loadu_si128((const __m128i*)d);
+		const __m128i d2 = _mm_loadu_si128((const __m128i*)(d + 8));
+
+		_mm_storeu_si128((__m128i*)d, _mm_sub_epi16(d1, _mm_unpacklo_epi64(e1, e2)));
+		_mm_storeu_si128((__m128i*)(d + 8), _mm_sub_epi16(d2, _mm_unpacklo_epi64(e3, e4)));
+
+		d += 16;
+		e += 12;
+		numErrorValues -= 12;
+		numTriplets += 4;
+	}
+
+	return numTriplets;
+}
+
+} // namespace SIMDKernels
+
+#endif
+
+static std::atomic<int>& getInstructionSetFlag()
+{
+	static std::atomic<int> flag((int)SIMDDecoding::getBestAvailableInstructionSet());
+	return flag;
+}
+
+SIMDDecoding::InstructionSet SIMDDecoding::getInstructionSet()
+{
+	return (InstructionSet)getInstructionSetFlag().load(std::memory_order_relaxed);
+}
+
+SIMDDecoding::InstructionSet SIMDDecoding::getBestAvailableInstructionSet()
+{
+#if HLAC_USE_SIMD_DECODING
+	if (SystemStats::hasAVX2())
+		return InstructionSet::AVX2;
+
+	if (SystemStats::hasSSE2())
+		return InstructionSet::SSE2;
+#endif
+
+	return InstructionSet::Scalar;
+}
+
+void SIMDDecoding::setInstructionSet(InstructionSet newInstructionSet)
+{
+	const int s = jmin<int>((int)newInstructionSet, (int)getBestAvailableInstructionSet());
+	getInstructionSetFlag().store(s, std::memory_order_relaxed);
+}
+
+String SIMDDecoding::getInstructionSetName(InstructionSet s)
+{
+	switch (s)
+	{
+	case InstructionSet::Scalar:	return "Scalar";
+	case InstructionSet::SSE2:		return "SSE2";
+	case InstructionSet::AVX2:		return "AVX2";
+	case InstructionSet::numInstructionSets:
+	default:						return "";
+	}
+}
+
+int SIMDDecoding::unpack(int16* destination, const uint8* data, int numValues, int numBytes, int bitDepth)
+{
+#if HLAC_USE_SIMD_DECODING
+	const auto s = getInstructionSet();
+
+	if (s == InstructionSet::Scalar)
+		return 0;
+
+	const bool useAVX2 = s == InstructionSet::AVX2;
+
+	// The 1, 2 and 4 bit formats are too small to benefit from the wider registers.
+	switch (bitDepth)
+	{
+	case 1:		return SIMDKernels::unpackOneBitSSE2(destination, data, numValues);
+	case 2:		return SIMDKernels::unpackTwoBitSSE2(destination, data, numValues);
+	case 4:		return SIMDKernels::unpackFourBitSSE2(destination, data, numValues);
+	case 8:		return useAVX2 ? SIMDKernels::unpackEightBitAVX2(destination, data, numValues) :
+							     SIMDKernels::unpackEightBitSSE2(destination, data, numValues);
+	case 6:
+	case 10:
+	case 12:
+	case 14:
+	{
+		// The word gathering makes the SSE2 version slower than the scalar code for 12 bit
+		if (bitDepth == 12 && !useAVX2)
+			return 0;
+
+		const auto& layout = SIMDKernels::getPackedLayout(bitDepth);
+
+		return useAVX2 ? SIMDKernels::unpackPackedAVX2(destination, data, numValues, numBytes, layout) :
+						 SIMDKernels::unpackPackedSSE2(destination, data, numValues, layout);
+	}
+	default:	return 0;
+	}
+#else
+	ignoreUnused(destination, data, numValues, numBytes, bitDepth);
+	return 0;
+#endif
+}
+
+int SIMDDecoding::distributeFullSamples(int16* destination, const int16* fullValues, int numFullValues)
+{
+#if HLAC_USE_SIMD_DECODING
+	if (getInstructionSet() != InstructionSet::Scalar)
+		return SIMDKernels::distributeFullSamplesSSE2(destination, fullValues, numFullValues);
+#endif
+
+	ignoreUnused(destination, fullValues, numFullValues);
+	return 0;
+}
+
+int SIMDDecoding::addErrorSignal(int16* destination, const int16* errorValues, int numErrorValues)
+{
+#if HLAC_USE_SIMD_DECODING
+	if (getInstructionSet() != InstructionSet::Scalar)
+		return SIMDKernels::addErrorSignalSSE2(destination, errorValues, numErrorValues);
+#endif
+
+	ignoreUnused(destination, errorValues, numErrorValues);
+	return 0;
+}
+
+} // namespace hlac
@@ -0,0 +1,84 @@
+/*  HISE Lossless Audio Codec
+*	2017 Christoph Hart
+*
+*	Redistribution and use in source and binary forms, with or without modification,
+*	are permitted provided that the following conditions are met:
+*
+*	1. Redistributions of source code must retain the above copyright notice,
+*	   this list of conditions and the following disclaimer.
+*
+*	2. Redistributions in binary form must reproduce the above copyright notice,
+*	   this list of conditions and the following disclaimer in the documentation
+*	   and/or other materials provided with the distribution.
+*
+*	3. All advertising materials mentioning features or use of this software must
+*	   display the following acknowledgement:
+*	   This product includes software developed by Hart Instruments
+*
+*	4. Neither the name of the copyright holder nor the names of its contributors may be used
+*	   to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY CHRISTOPH HART "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+*	BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*	DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+*	SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+*	GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+*	THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+*	ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*/
+
+#ifndef SIMDDECODING_H_INCLUDED
+#define SIMDDECODING_H_INCLUDED
+
+namespace hlac { using namespace juce;
+
+/** Vectorised versions of the bit unpacking routines used by the decoder.
+*
+*	The instruction set is detected once at runtime and the fastest kernel that the CPU supports
+*	will be used. The kernels only decode the largest part of the data that fits into the vector
+*	registers and return the number of processed values, so the remainder has to be decoded
+*	with the scalar code. The output is bit-identical to the scalar code.
+*/
+struct SIMDDecoding
+{
+	enum class InstructionSet
+	{
+		Scalar = 0,
+		SSE2,
+		AVX2,
+		numInstructionSets
+	};
+
+	/** Returns the instruction set that is currently used for decoding. */
+	static InstructionSet getInstructionSet();
+
+	/** Returns the best instruction set that is supported by the CPU. */
+	static InstructionSet getBestAvailableInstructionSet();
+
+	/** Overrides the instruction set (eg. for benchmarking). It will be limited to the best available instruction set. */
+	static void setInstructionSet(InstructionSet newInstructionSet);
+
+	static String getInstructionSetName(InstructionSet s);
+
+	/** Decodes the bit packed data of the given compressor format.
+	*
+	*	numBytes must be the amount of valid bytes after data so that the kernel does not read past the end.
+	*	Returns the number of values that were decoded.
+	*/
+	static int unpack(int16* destination, const uint8* data, int numValues, int numBytes, int bitDepth);
+
+	/** Interpolates the full values of a diff block. Returns the number of processed full values.
+	*
+	*	This behaves exactly like the scalar loop in CompressionHelpers::Diff::distributeFullSamples()
+	*	so it writes four samples for each full value.
+	*/
+	static int distributeFullSamples(int16* destination, const int16* fullValues, int numFullValues);
+
+	/** Subtracts the error signal of a diff block. Returns the number of processed error triplets. */
+	static int addErrorSignal(int16* destination, const int16* errorValues, int numErrorValues);
+};
+
+} // namespace hlac
+
+#endif  // SIMDDECODING_H_INCLUDED
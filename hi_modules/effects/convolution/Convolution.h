@@ -103,122 +103,14 @@ private:
 	
 };
 
-class MultithreadedConvolver : public fftconvolver::TwoStageFFTConvolver
-{
-	class BackgroundThread : public Thread
-	{
-	public:
-
-		BackgroundThread(MultithreadedConvolver& parent_) :
-			Thread("Convolution Background Thread"),
-			parent(parent_)
-		{
-			
-		}
-
-		void run() override
-		{
-			while (!threadShouldExit())
-			{
-
-				if (active)
-				{
-					ScopedValueSetter<bool> svs(currentlyRendering, true);
-					parent.doBackgroundProcessing();
-					active = false;
-
-					if (threadShouldExit())
-						return;
-				}
-
-				wait(500);
-			}
-		};
-
-		void setSomethingTodo(bool shouldBeActive)
-		{
-			active = shouldBeActive;
-		}
-
-		bool isBusy() const { return currentlyRendering; }
-
-		bool currentlyRendering = false;
-		bool active = false;
-
-		MultithreadedConvolver& parent;
-	};
-
-
-public:
-
-	MultithreadedConvolver() :
-		TwoStageFFTConvolver(),
-		backgroundThread(*this)
-	{};
-
-	virtual ~MultithreadedConvolver()
-	{
-		backgroundThread.stopThread(1000);
-	};
-
-	void startBackgroundProcessing() override
-	{
-		if (useBackgroundThread)
-		{
-			backgroundThread.setSomethingTodo(true);
-			backgroundThread.notify();
-		}
-		else
-		{
-			doBackgroundProcessing();
-		}
-	}
-
-	void waitForBackgroundProcessing() override
-	{
-		if (useBackgroundThread)
-		{
-			while (backgroundThread.isBusy())
-				jassertfalse;
-		}
-	}
-
-	void setUseBackgroundThread(bool shouldBeUsingBackgroundThread)
-	{
-		if (useBackgroundThread != shouldBeUsingBackgroundThread)
-		{
-			useBackgroundThread = shouldBeUsingBackgroundThread;
-		
-			if (useBackgroundThread)
-				backgroundThread.startThread(9);
-			else
-			{
-				if(backgroundThread.isThreadRunning())
-					backgroundThread.stopThread(1000);
-			}
-				
-		}
-	}
-
-	bool isUsingBackgroundThread() const
-	{
-		return useBackgroundThread;
-	}
-
-private:
-
-	BackgroundThread backgroundThread;
-
-	bool useBackgroundThread = true;
-};
-
-
 /** @brief A convolution reverb using zero-latency convolution
 *	@ingroup effectTypes
 *
-*	This is a wrapper for the convolution engine found in WDL (the sole MIT licenced convolution engine available)
-*	It is not designed to replace real convolution reverbs (as the CPU usage for impulses > 0.6 seconds is unreasonable),
-*	but your early reflection impulses or other filter impulses will be thankful for this effect.
+*	The impulse response is rendered with a NonUniformConvolver, so the head is processed without latency and the
+*	long tail partitions can be rendered on a worker pool that is shared by all convolution instances.
+*
+*	If the impulse response file has four channels, it will be used as true stereo impulse response with the
+*	channel order L->L, L->R, R->L, R->R. The forward FFT of each input is shared by both paths.
 */
 class ConvolutionEffect: public MasterEffectProcessor,
 						 public AudioSampleProcessor
@@ -275,8 +167,7 @@ class ConvolutionEffect: public MasterEffectProcessor,
 
 			ScopedLock sl(parent.getImpulseLock());
 
-			parent.convolverL->reset();
-			parent.convolverR->reset();
+			parent.convolver->reset();
 
 			stopTimer();
 		}
@@ -300,7 +191,7 @@ public:
 		Latency, ///< you can change the latency (unused)
 		ImpulseLength, ///< the Impulse length (deprecated, use the SampleArea of the AudioSampleBufferComponent to change the impulse response)
 		ProcessInput, ///< if this attribute is set, the engine will fade out in a short time and reset itself.
-		UseBackgroundThread, ///< if true, then the tail of the impulse response will be rendered on a background thread to save cycles on the audio thread.
+		UseBackgroundThread, ///< if true, then the tail of the impulse response will be rendered on the shared convolution worker pool to save cycles on the audio thread.
 		Predelay, ///< delays the reverb tail by the given amount in milliseconds
 		HiCut, ///< applies a low pass filter to the impulse response
 		Damping, ///< applies a fade-out to the impulse response
@@ -339,6 +230,13 @@ public:
 
 	const CriticalSection& getFileLock() const override { return unusedFileLock; }
 
+#if USE_FFT_CONVOLVER
+
+	/** Returns the performance statistics of the convolution engine. */
+	NonUniformConvolver::Statistics getStatistics() const;
+
+#endif
+
 private:
 
 	SpinLock swapLock;
@@ -391,8 +289,7 @@ private:
 
 #if USE_FFT_CONVOLVER
 
-	ScopedPointer<MultithreadedConvolver> convolverL;
-	ScopedPointer<MultithreadedConvolver> convolverR;
+	ScopedPointer<NonUniformConvolver> convolver;
 
 #else
 
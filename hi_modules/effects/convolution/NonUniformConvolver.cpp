@@ -0,0 +1,692 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise { using namespace juce;
+
+bool ConvolutionWorkerPool::Job::tryToRun()
+{
+	int expected = Pending;
+
+	if (state.compare_exchange_strong(expected, Running))
+	{
+		run();
+		state.store(Idle);
+		return true;
+	}
+
+	return false;
+}
+
+bool ConvolutionWorkerPool::Job::finish(int64 maxWaitTicks)
+{
+	if (tryToRun())
+		return false;
+
+	if (state.load() == Running)
+	{
+		const int64 timeout = Time::getHighResolutionTicks() + maxWaitTicks;
+
+		// The worker is almost done, so we spin instead of sleeping...
+		while (state.load() == Running)
+		{
+			if (maxWaitTicks >= 0 && Time::getHighResolutionTicks() > timeout)
+				break;
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+ConvolutionWorkerPool::ConvolutionWorkerPool()
+{
+	for (int i = 0; i < HISE_NUM_CONVOLUTION_THREADS; i++)
+		threads.add(new WorkerThread(*this, i));
+}
+
+ConvolutionWorkerPool::~ConvolutionWorkerPool()
+{
+	// Remove all jobs before deleting the pool...
+	jassert(jobs.isEmpty());
+
+	for (auto t : threads)
+		t->signalThreadShouldExit();
+
+	for (auto t : threads)
+		t->stopThread(1000);
+}
+
+void ConvolutionWorkerPool::addJob(Job* j)
+{
+	ScopedWriteLock sl(jobLock);
+	jobs.addIfNotAlreadyThere(j);
+}
+
+void ConvolutionWorkerPool::removeJob(Job* j)
+{
+	// The write lock waits until all workers have finished their current job
+	ScopedWriteLock sl(jobLock);
+	jobs.removeAllInstancesOf(j);
+	j->state.store(Job::Idle);
+}
+
+void ConvolutionWorkerPool::startJob(Job* j)
+{
+	j->state.store(Job::Pending);
+
+	for (auto t : threads)
+		t->notify();
+}
+
+void ConvolutionWorkerPool::startThreads()
+{
+	ScopedLock sl(threadLock);
+
+	for (auto t : threads)
+	{
+		if (!t->isThreadRunning())
+			t->startThread(9);
+	}
+}
+
+bool ConvolutionWorkerPool::runNextJob()
+{
+	ScopedReadLock sl(jobLock);
+
+	Job* nextJob = nullptr;
+
+	for (auto j : jobs)
+	{
+		if (j->isPending() && (nextJob == nullptr || j->getDeadline() < nextJob->getDeadline()))
+			nextJob = j;
+	}
+
+	if (nextJob == nullptr)
+		return false;
+
+	const auto start = Time::getHighResolutionTicks();
+
+	if (nextJob->tryToRun())
+		nextJob->workerTicks += Time::getHighResolutionTicks() - start;
+
+	return true;
+}
+
+void ConvolutionWorkerPool::WorkerThread::run()
+{
+	while (!threadShouldExit())
+	{
+		if (!parent.runNextJob())
+			wait(500);
+	}
+}
+
+MultiChannelPartitionedConvolver::MultiChannelPartitionedConvolver()
+{
+
+}
+
+MultiChannelPartitionedConvolver::~MultiChannelPartitionedConvolver()
+{
+	reset();
+}
+
+static bool isSilent(const float* data, int numSamples)
+{
+	auto r = FloatVectorOperations::findMinAndMax(data, numSamples);
+	return r.getStart() == 0.0f && r.getEnd() == 0.0f;
+}
+
+bool MultiChannelPartitionedConvolver::init(int newBlockSize, int newNumInputs, int newNumOutputs, const float* const* irs, int irLength)
+{
+	reset();
+
+	if (newBlockSize <= 0 || newNumInputs <= 0 || newNumOutputs <= 0)
+		return false;
+
+	if (irLength <= 0)
+		return true;
+
+	blockSize = nextPowerOfTwo(newBlockSize);
+	numInputs = newNumInputs;
+	numOutputs = newNumOutputs;
+	numSegments = (irLength + blockSize - 1) / blockSize;
+
+	const int segmentSize = 2 * blockSize;
+	const int complexSize = (int)audiofft::AudioFFT::ComplexSize(segmentSize);
+
+	fft.init(segmentSize);
+	fftBuffer.resize(segmentSize);
+	convolved.resize(complexSize);
+
+	for (int i = 0; i < numInputs; i++)
+	{
+		inputBuffers.add(new SampleBuffer(blockSize));
+
+		for (int s = 0; s < numSegments; s++)
+			inputSegments.add(new SplitComplex(complexSize));
+	}
+
+	for (int i = 0; i < numInputs; i++)
+	{
+		for (int o = 0; o < numOutputs; o++)
+		{
+			const float* ir = irs[i * numOutputs + o];
+
+			for (int s = 0; s < numSegments; s++)
+			{
+				const int offset = s * blockSize;
+				const int numToCopy = jmin(blockSize, irLength - offset);
+
+				if (ir == nullptr || isSilent(ir + offset, numToCopy))
+				{
+					irSegments.add(nullptr);
+					continue;
+				}
+
+				auto segment = new SplitComplex(complexSize);
+				fftconvolver::CopyAndPad(fftBuffer, ir + offset, (size_t)numToCopy);
+				fft.fft(fftBuffer.data(), segment->re(), segment->im());
+				irSegments.add(segment);
+			}
+		}
+	}
+
+	for (int o = 0; o < numOutputs; o++)
+	{
+		preMultiplied.add(new SplitComplex(complexSize));
+		outputBuffers.add(new SampleBuffer(segmentSize));
+		overlaps.add(new SampleBuffer(blockSize));
+	}
+
+	currentSegment = 0;
+	inputBufferFill = 0;
+
+	return true;
+}
+
+void MultiChannelPartitionedConvolver::process(const float* const* inputs, float* const* outputs, int numSamples)
+{
+	if (numSegments == 0)
+	{
+		for (int o = 0; o < numOutputs; o++)
+			FloatVectorOperations::clear(outputs[o], numSamples);
+
+		return;
+	}
+
+	int processed = 0;
+
+	while (processed < numSamples)
+	{
+		const bool inputBufferWasEmpty = inputBufferFill == 0;
+		const int numThisTime = jmin(numSamples - processed, blockSize - inputBufferFill);
+
+		// Forward FFT (once per input)
+		for (int i = 0; i < numInputs; i++)
+		{
+			auto inputBuffer = inputBuffers[i];
+
+			memcpy(inputBuffer->data() + inputBufferFill, inputs[i] + processed, sizeof(float) * numThisTime);
+			fftconvolver::CopyAndPad(fftBuffer, inputBuffer->data(), (size_t)blockSize);
+
+			auto segment = getInputSegment(i, currentSegment);
+			fft.fft(fftBuffer.data(), segment->re(), segment->im());
+		}
+
+		for (int o = 0; o < numOutputs; o++)
+		{
+			// The older segments don't change until the next block, so we only need to add them once
+			if (inputBufferWasEmpty)
+			{
+				preMultiplied[o]->setZero();
+
+				for (int i = 0; i < numInputs; i++)
+				{
+					for (int s = 1; s < numSegments; s++)
+					{
+						if (auto irSegment = getIrSegment(i, o, s))
+							fftconvolver::ComplexMultiplyAccumulate(*preMultiplied[o], *irSegment, *getInputSegment(i, (currentSegment + s) % numSegments));
+					}
+				}
+			}
+
+			convolved.copyFrom(*preMultiplied[o]);
+
+			for (int i = 0; i < numInputs; i++)
+			{
+				if (auto irSegment = getIrSegment(i, o, 0))
+					fftconvolver::ComplexMultiplyAccumulate(convolved, *getInputSegment(i, currentSegment), *irSegment);
+			}
+
+			// Backward FFT (once per output)
+			auto outputBuffer = outputBuffers[o];
+			fft.ifft(outputBuffer->data(), convolved.re(), convolved.im());
+
+			fftconvolver::Sum(outputs[o] + processed, outputBuffer->data() + inputBufferFill, overlaps[o]->data() + inputBufferFill, (size_t)numThisTime);
+		}
+
+		inputBufferFill += numThisTime;
+
+		if (inputBufferFill == blockSize)
+		{
+			for (auto b : inputBuffers)
+				b->setZero();
+
+			inputBufferFill = 0;
+
+			for (int o = 0; o < numOutputs; o++)
+				memcpy(overlaps[o]->data(), outputBuffers[o]->data() + blockSize, sizeof(float) * blockSize);
+
+			currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numSegments - 1);
+		}
+
+		processed += numThisTime;
+	}
+}
+
+void MultiChannelPartitionedConvolver::reset()
+{
+	inputBuffers.clear();
+	inputSegments.clear();
+	irSegments.clear();
+	preMultiplied.clear();
+	outputBuffers.clear();
+	overlaps.clear();
+
+	fftBuffer.clear();
+	convolved.clear();
+	fft.init(0);
+
+	blockSize = 0;
+	numInputs = 0;
+	numOutputs = 0;
+	numSegments = 0;
+	currentSegment = 0;
+	inputBufferFill = 0;
+}
+
+void MultiChannelPartitionedConvolver::resetInput()
+{
+	for (auto b : inputBuffers)
+		b->setZero();
+
+	for (auto s : inputSegments)
+		s->setZero();
+
+	for (auto s : preMultiplied)
+		s->setZero();
+
+	for (auto b : overlaps)
+		b->setZero();
+
+	convolved.setZero();
+
+	currentSegment = 0;
+	inputBufferFill = 0;
+}
+
+/** A tail stage collects a full block of input and renders it in one go.
+*
+*	The result of a block is played back after the next block, so the rendering has a whole block of time to
+*	finish. This means that the stage must start at an offset of two blocks in the impulse response.
+*/
+class NonUniformConvolver::TailStage : public ConvolutionWorkerPool::Job
+{
+public:
+
+	TailStage(NonUniformConvolver& parent_, const Partition& p, const float* const* irs) :
+		parent(parent_),
+		blockSize(p.blockSize),
+		inputBuffer(parent_.numInputs, p.blockSize),
+		jobInput(parent_.numInputs, p.blockSize)
+	{
+		jassert(p.offset >= 2 * p.blockSize);
+
+		const float* offsetIrs[MaxNumChannels * MaxNumChannels];
+
+		for (int i = 0; i < parent.numInputs * parent.numOutputs; i++)
+			offsetIrs[i] = irs[i] != nullptr ? irs[i] + p.offset : nullptr;
+
+		convolver.init(p.blockSize, parent.numInputs, parent.numOutputs, offsetIrs, p.length);
+
+		for (auto& b : outputBuffers)
+			b.setSize(parent.numOutputs, p.blockSize);
+
+		clearBuffers();
+	}
+
+	void run() override
+	{
+		convolver.process(jobInput.getArrayOfReadPointers(), getJobOutput().getArrayOfWritePointers(), blockSize);
+	}
+
+	int64 getDeadline() const override { return deadline.load(); }
+
+	int getBlockSize() const { return blockSize; }
+
+	int getNumRemaining() const { return blockSize - position; }
+
+	/** Processes a chunk that must not cross the block boundary. */
+	void process(const float* const* inputs, float* const* outputs, int offset, int numSamples)
+	{
+		jassert(position + numSamples <= blockSize);
+
+		auto& playbackBuffer = outputBuffers[playbackIndex];
+
+		for (int o = 0; o < parent.numOutputs; o++)
+			FloatVectorOperations::add(outputs[o] + offset, playbackBuffer.getReadPointer(o, position), numSamples);
+
+		for (int i = 0; i < parent.numInputs; i++)
+			FloatVectorOperations::copy(inputBuffer.getWritePointer(i, position), inputs[i] + offset, numSamples);
+
+		position += numSamples;
+
+		if (position == blockSize)
+		{
+			position = 0;
+
+			// Don't wait longer than a quarter of the head block for a worker
+			const int64 maxWaitTicks = parent.waitForLateJobs ? -1 : parent.getDurationInTicks(parent.headBlockSize) / 4;
+
+			if (!finish(maxWaitTicks))
+				parent.numLateBlocks++;
+
+			if (isRunning())
+			{
+				// The worker still uses the job buffers, so this stage stays silent and drops its input
+				// until the job is done.
+				outputBuffers[playbackIndex].clear();
+				needsReset = true;
+				return;
+			}
+
+			if (needsReset)
+			{
+				// The result of the late job belongs to a dropped block, so the stage starts again with a clean pipeline
+				convolver.resetInput();
+				getJobOutput().clear();
+				needsReset = false;
+			}
+
+			playbackIndex = 1 - playbackIndex;
+
+			for (int i = 0; i < parent.numInputs; i++)
+				FloatVectorOperations::copy(jobInput.getWritePointer(i), inputBuffer.getReadPointer(i), blockSize);
+
+			// The result is played back when the next block of this stage starts
+			deadline.store(Time::getHighResolutionTicks() + parent.getDurationInTicks(blockSize));
+
+			if (parent.useBackgroundThread)
+				parent.pool->startJob(this);
+			else
+				run();
+		}
+	}
+
+	void cleanPipeline()
+	{
+		finish();
+		convolver.resetInput();
+		clearBuffers();
+	}
+
+private:
+
+	AudioSampleBuffer& getJobOutput() { return outputBuffers[1 - playbackIndex]; }
+
+	void clearBuffers()
+	{
+		inputBuffer.clear();
+		jobInput.clear();
+
+		for (auto& b : outputBuffers)
+			b.clear();
+
+		position = 0;
+		needsReset = false;
+	}
+
+	NonUniformConvolver& parent;
+
+	const int blockSize;
+	int position = 0;
+
+	MultiChannelPartitionedConvolver convolver;
+
+	AudioSampleBuffer inputBuffer;
+	AudioSampleBuffer jobInput;
+
+	// One buffer is played back while the job renders into the other one
+	AudioSampleBuffer outputBuffers[2];
+	int playbackIndex = 0;
+
+	std::atomic<int64> deadline = { 0 };
+	bool needsReset = false;
+};
+
+NonUniformConvolver::NonUniformConvolver(int numInputs_, int numOutputs_) :
+	numInputs(numInputs_),
+	numOutputs(numOutputs_)
+{
+	jassert(isPositiveAndNotGreaterThan(numInputs, (int)MaxNumChannels));
+	jassert(isPositiveAndNotGreaterThan(numOutputs, (int)MaxNumChannels));
+}
+
+NonUniformConvolver::~NonUniformConvolver()
+{
+	reset();
+}
+
+Array<NonUniformConvolver::Partition> NonUniformConvolver::calculatePartitions(int headBlockSize, int maxBlockSize, int irLength)
+{
+	Array<Partition> partitions;
+
+	if (irLength <= 0 || headBlockSize <= 0)
+		return partitions;
+
+	int blockSize = nextPowerOfTwo(headBlockSize);
+	maxBlockSize = jmax(blockSize, nextPowerOfTwo(maxBlockSize));
+
+	int offset = 0;
+
+	while (offset < irLength)
+	{
+		const int nextBlockSize = jmin(blockSize * 4, maxBlockSize);
+
+		// The next stage starts two of its blocks into the impulse response
+		const int end = (nextBlockSize == blockSize) ? irLength : jmin(irLength, 2 * nextBlockSize);
+
+		partitions.add({ blockSize, offset, end - offset });
+
+		offset = end;
+		blockSize = nextBlockSize;
+	}
+
+	return partitions;
+}
+
+bool NonUniformConvolver::init(int newHeadBlockSize, int newMaxBlockSize, const float* ir, int irLength)
+{
+	jassert(numInputs == 1 && numOutputs == 1);
+
+	return init(newHeadBlockSize, newMaxBlockSize, &ir, irLength);
+}
+
+bool NonUniformConvolver::init(int newHeadBlockSize, int newMaxBlockSize, const float* const* irs, int irLength)
+{
+	reset();
+
+	if (newHeadBlockSize <= 0 || newMaxBlockSize <= 0)
+		return false;
+
+	auto isSilent = [irs, this](int index)
+	{
+		for (int i = 0; i < numInputs * numOutputs; i++)
+		{
+			if (irs[i] != nullptr && std::abs(irs[i][index]) >= 0.000001f)
+				return false;
+		}
+
+		return true;
+	};
+
+	// Ignore zeros at the end of the impulse responses because they only waste computation time
+	while (irLength > 0 && isSilent(irLength - 1))
+		--irLength;
+
+	auto partitions = calculatePartitions(newHeadBlockSize, newMaxBlockSize, irLength);
+
+	if (partitions.isEmpty())
+		return true;
+
+	headBlockSize = partitions.getFirst().blockSize;
+
+	headConvolver.init(headBlockSize, numInputs, numOutputs, irs, partitions.getFirst().length);
+
+	for (int i = 1; i < partitions.size(); i++)
+	{
+		auto s = tailStages.add(new TailStage(*this, partitions[i], irs));
+		pool->addJob(s);
+	}
+
+	return true;
+}
+
+void NonUniformConvolver::process(const float* input, float* output, int numSamples)
+{
+	jassert(numInputs == 1 && numOutputs == 1);
+
+	process(&input, &output, numSamples);
+}
+
+void NonUniformConvolver::process(const float* const* inputs, float* const* outputs, int numSamples)
+{
+	if (headBlockSize == 0)
+	{
+		for (int o = 0; o < numOutputs; o++)
+			FloatVectorOperations::clear(outputs[o], numSamples);
+
+		return;
+	}
+
+	const auto start = Time::getHighResolutionTicks();
+
+	headConvolver.process(inputs, outputs, numSamples);
+
+	int processed = 0;
+
+	while (processed < numSamples && !tailStages.isEmpty())
+	{
+		// All block sizes are powers of two, so the smallest stage hits every block boundary
+		const int numThisTime = jmin(numSamples - processed, tailStages.getFirst()->getNumRemaining());
+
+		for (auto s : tailStages)
+			s->process(inputs, outputs, processed, numThisTime);
+
+		processed += numThisTime;
+	}
+
+	numProcessedSamples += numSamples;
+	audioThreadTicks += Time::getHighResolutionTicks() - start;
+}
+
+void NonUniformConvolver::reset()
+{
+	for (auto s : tailStages)
+		pool->removeJob(s);
+
+	tailStages.clear();
+	headConvolver.reset();
+
+	headBlockSize = 0;
+
+	numProcessedSamples = 0;
+	audioThreadTicks = 0;
+	numLateBlocks.store(0);
+}
+
+void NonUniformConvolver::cleanPipeline()
+{
+	headConvolver.resetInput();
+
+	for (auto s : tailStages)
+		s->cleanPipeline();
+}
+
+void NonUniformConvolver::setUseBackgroundThread(bool shouldBeUsingBackgroundThread)
+{
+	useBackgroundThread = shouldBeUsingBackgroundThread;
+
+	if (useBackgroundThread)
+		pool->startThreads();
+}
+
+void NonUniformConvolver::setSampleRate(double newSampleRate)
+{
+	if (newSampleRate > 0.0)
+		sampleRate = newSampleRate;
+}
+
+int64 NonUniformConvolver::getDurationInTicks(int numSamples) const
+{
+	return (int64)((double)numSamples / sampleRate * (double)Time::getHighResolutionTicksPerSecond());
+}
+
+NonUniformConvolver::Statistics NonUniformConvolver::getStatistics(double sampleRate) const
+{
+	Statistics s;
+
+	s.numStages = headBlockSize > 0 ? tailStages.size() + 1 : 0;
+	s.headBlockSize = headBlockSize;
+	s.maxBlockSize = tailStages.isEmpty() ? headBlockSize : tailStages.getLast()->getBlockSize();
+	s.numLateBlocks = numLateBlocks.load();
+
+	if (numProcessedSamples > 0 && sampleRate > 0.0)
+	{
+		const double realTime = (double)numProcessedSamples / sampleRate;
+
+		int64 workerTicks = 0;
+
+		for (auto t : tailStages)
+			workerTicks += t->getWorkerTicks();
+
+		s.audioThreadUsage = Time::highResolutionTicksToSeconds(audioThreadTicks) / realTime;
+		s.workerUsage = Time::highResolutionTicksToSeconds(workerTicks) / realTime;
+	}
+
+	return s;
+}
+
+} // namespace hise
@@ -0,0 +1,349 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#ifndef NONUNIFORMCONVOLVER_H_INCLUDED
+#define NONUNIFORMCONVOLVER_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** Config: HISE_NUM_CONVOLUTION_THREADS
+
+The number of worker threads that render the tail stages of all convolution instances.
+*/
+#ifndef HISE_NUM_CONVOLUTION_THREADS
+#define HISE_NUM_CONVOLUTION_THREADS 2
+#endif
+
+/** A process wide pool of worker threads that is shared by all convolution instances.
+*
+*	Use it with a SharedResourcePointer. The jobs are registered once (when the impulse response is loaded)
+*	and can then be triggered from the audio thread without any allocation. If multiple jobs are pending,
+*	the job with the shortest deadline will be picked first.
+*/
+class ConvolutionWorkerPool
+{
+public:
+
+	/** A job that can be added to the pool. */
+	class Job
+	{
+	public:
+
+		enum State
+		{
+			Idle = 0,
+			Pending,
+			Running
+		};
+
+		virtual ~Job() {};
+
+		/** Override this and render the job. */
+		virtual void run() = 0;
+
+		/** Returns the time (in high resolution ticks) when the result of the job is needed. Jobs with earlier deadlines are preferred. */
+		virtual int64 getDeadline() const = 0;
+
+		/** Runs the job on the calling thread if it hasn't been picked up by a worker yet. */
+		bool tryToRun();
+
+		/** Makes sure that the job is finished when this method returns. Returns false if the job was late.
+		*
+		*	If a worker is still running the job, it waits at most maxWaitTicks (or until the job is done if you pass -1).
+		*	Check isRunning() after this method to find out whether the wait timed out.
+		*/
+		bool finish(int64 maxWaitTicks=-1);
+
+		bool isPending() const { return state.load() == Pending; }
+
+		bool isRunning() const { return state.load() == Running; }
+
+		/** Returns the time that the worker threads spent on this job. */
+		int64 getWorkerTicks() const { return workerTicks.load(); }
+
+	private:
+
+		friend class ConvolutionWorkerPool;
+
+		std::atomic<int> state = { Idle };
+		std::atomic<int64> workerTicks = { 0 };
+	};
+
+	ConvolutionWorkerPool();
+	~ConvolutionWorkerPool();
+
+	/** Adds a job to the pool. Don't call this from the audio thread. */
+	void addJob(Job* j);
+
+	/** Removes the job from the pool. It waits until a running job is finished. */
+	void removeJob(Job* j);
+
+	/** Marks the job as pending and wakes up the worker threads. */
+	void startJob(Job* j);
+
+	/** Starts the worker threads. This is done lazily so that there are no idle threads if no convolution uses the pool. */
+	void startThreads();
+
+private:
+
+	class WorkerThread : public Thread
+	{
+	public:
+
+		WorkerThread(ConvolutionWorkerPool& parent_, int index) :
+			Thread("Convolution Worker Thread " + String(index + 1)),
+			parent(parent_)
+		{};
+
+		void run() override;
+
+		ConvolutionWorkerPool& parent;
+	};
+
+	/** Picks the pending job with the shortest deadline and runs it. Returns false if there was nothing to do. */
+	bool runNextJob();
+
+	ReadWriteLock jobLock;
+	Array<Job*> jobs;
+
+	CriticalSection threadLock;
+
+	// The threads are created in the constructor and never change so that startJob() can iterate them.
+	OwnedArray<WorkerThread> threads;
+
+	JUCE_DECLARE_NON_COPYABLE(ConvolutionWorkerPool);
+};
+
+/** A uniform partitioned convolution with multiple inputs and outputs.
+*
+*	Every input is transformed only once and the spectrum is shared by all impulse responses that read from
+*	this input. The paths are accumulated in the frequency domain, so there is only one inverse FFT per output.
+*	A true stereo convolution (4 impulse responses) therefore needs the same amount of FFTs as two independent
+*	mono convolutions.
+*
+*	Like the fftconvolver::FFTConvolver it has no latency and can process any buffer size.
+*/
+class MultiChannelPartitionedConvolver
+{
+public:
+
+	MultiChannelPartitionedConvolver();
+	~MultiChannelPartitionedConvolver();
+
+	/** Initialises the convolver.
+	*
+	*	@param blockSize	the partition size (will be rounded up to the next power of two).
+	*	@param irs			the impulse responses for every path, indexed with inputIndex * numOutputs + outputIndex.
+	*						Use nullptr for paths that are not connected.
+	*	@param irLength		the length of all impulse responses.
+	*/
+	bool init(int blockSize, int numInputs, int numOutputs, const float* const* irs, int irLength);
+
+	/** Convolves the inputs and writes the result into the outputs (the old content is overwritten). */
+	void process(const float* const* inputs, float* const* outputs, int numSamples);
+
+	/** Discards the impulse response. */
+	void reset();
+
+	/** Clears the internal buffers so that it resets the convolution pipeline. */
+	void resetInput();
+
+private:
+
+	typedef fftconvolver::SplitComplex SplitComplex;
+	typedef fftconvolver::SampleBuffer SampleBuffer;
+
+	SplitComplex* getInputSegment(int inputIndex, int segmentIndex) { return inputSegments[inputIndex * numSegments + segmentIndex]; }
+	SplitComplex* getIrSegment(int inputIndex, int outputIndex, int segmentIndex) { return irSegments[(inputIndex * numOutputs + outputIndex) * numSegments + segmentIndex]; }
+
+	int blockSize = 0;
+	int numInputs = 0;
+	int numOutputs = 0;
+	int numSegments = 0;
+	int currentSegment = 0;
+	int inputBufferFill = 0;
+
+	audiofft::AudioFFT fft;
+	SampleBuffer fftBuffer;
+	SplitComplex convolved;
+
+	OwnedArray<SampleBuffer> inputBuffers;
+	OwnedArray<SplitComplex> inputSegments;
+
+	// Segments that are silent (or paths that are not connected) are nullptr
+	OwnedArray<SplitComplex> irSegments;
+
+	OwnedArray<SplitComplex> preMultiplied;
+	OwnedArray<SampleBuffer> outputBuffers;
+	OwnedArray<SampleBuffer> overlaps;
+
+	JUCE_DECLARE_NON_COPYABLE(MultiChannelPartitionedConvolver);
+};
+
+/** A zero latency convolution engine with non-uniform partitions.
+*
+*	The impulse response is split into multiple stages with growing partition sizes:
+*
+*	- the head stage is a uniform partitioned convolution with the (small) head block size that is rendered
+*	  directly on the audio thread without latency.
+*	- every tail stage uses a partition size that is four times bigger than the previous one and renders
+*	  a complete block at once. The result is needed two blocks later, so the stages can be rendered on the
+*	  ConvolutionWorkerPool (if enabled) and the audio thread only has to wait if the pool is overloaded.
+*
+*	The output is identical whether the tail stages are rendered on the pool or on the audio thread as long as
+*	every tail job is finished in time. If a job is late, the stage is muted for one block unless
+*	setWaitForLateJobs() is enabled (which the ConvolutionEffect does for offline rendering).
+*
+*	Every stage is a MultiChannelPartitionedConvolver, so you can also use it for true stereo or multichannel
+*	impulse responses.
+*/
+class NonUniformConvolver
+{
+public:
+
+	/** The layout of a single stage. */
+	struct Partition
+	{
+		int blockSize;
+		int offset;
+		int length;
+	};
+
+	/** The performance statistics of a convolver. */
+	struct Statistics
+	{
+		int numStages = 0;
+		int headBlockSize = 0;
+		int maxBlockSize = 0;
+
+		/** The latency in samples (always zero, but it's here so that you don't need to ask). */
+		int latency = 0;
+
+		/** The CPU usage of the audio thread relative to the real time (1.0 = 100%). */
+		double audioThreadUsage = 0.0;
+
+		/** The CPU usage of the background rendering relative to the real time. */
+		double workerUsage = 0.0;
+
+		/** The number of tail blocks that were not ready when the audio thread needed them. */
+		int numLateBlocks = 0;
+	};
+
+	enum
+	{
+		MaxNumChannels = 8
+	};
+
+	/** Creates a convolver with the given amount of input and output channels. */
+	NonUniformConvolver(int numInputs=1, int numOutputs=1);
+	~NonUniformConvolver();
+
+	/** Calculates the partition layout. The first partition is the head stage. */
+	static Array<Partition> calculatePartitions(int headBlockSize, int maxBlockSize, int irLength);
+
+	/** Initialises the convolver with the given impulse response. Don't call this while processing.
+	*
+	*	The block sizes will be rounded up to the next power of two.
+	*/
+	bool init(int headBlockSize, int maxBlockSize, const float* ir, int irLength);
+
+	/** Initialises the convolver with an impulse response for every path.
+	*
+	*	The impulse responses are indexed with inputIndex * numOutputs + outputIndex, so for a true stereo convolution
+	*	the order is L->L, L->R, R->L, R->R. Use nullptr for paths that are not connected.
+	*/
+	bool init(int headBlockSize, int maxBlockSize, const float* const* irs, int irLength);
+
+	int getNumInputs() const { return numInputs; }
+	int getNumOutputs() const { return numOutputs; }
+
+	/** Convolves the input. The input and output buffers must not overlap. */
+	void process(const float* input, float* output, int numSamples);
+
+	/** Convolves the input channels and writes the result into the output channels. The buffers must not overlap. */
+	void process(const float* const* inputs, float* const* outputs, int numSamples);
+
+	/** Discards the impulse response. */
+	void reset();
+
+	/** Clears the internal buffers so that it resets the convolution pipeline. */
+	void cleanPipeline();
+
+	/** Renders the tail stages on the shared worker pool. */
+	void setUseBackgroundThread(bool shouldBeUsingBackgroundThread);
+
+	/** Sets the sample rate that is used to calculate the deadlines of the tail stages. */
+	void setSampleRate(double newSampleRate);
+
+	/** If this is true, the audio thread waits until a late tail job is done instead of muting the stage.
+	*
+	*	The default is false. Use this for offline rendering where the output must be complete.
+	*/
+	void setWaitForLateJobs(bool shouldWait) { waitForLateJobs = shouldWait; }
+
+	bool isUsingBackgroundThread() const { return useBackgroundThread; }
+
+	/** Returns the statistics since the last call to init(). */
+	Statistics getStatistics(double sampleRate) const;
+
+private:
+
+	class TailStage;
+
+	SharedResourcePointer<ConvolutionWorkerPool> pool;
+
+	int headBlockSize = 0;
+	const int numInputs;
+	const int numOutputs;
+
+	MultiChannelPartitionedConvolver headConvolver;
+	OwnedArray<TailStage> tailStages;
+
+	bool useBackgroundThread = false;
+	bool waitForLateJobs = false;
+
+	/** Converts the given amount of samples into high resolution ticks. */
+	int64 getDurationInTicks(int numSamples) const;
+
+	double sampleRate = 44100.0;
+
+	int64 numProcessedSamples = 0;
+	int64 audioThreadTicks = 0;
+	std::atomic<int> numLateBlocks = { 0 };
+
+	JUCE_DECLARE_NON_COPYABLE(NonUniformConvolver);
+};
+
+} // namespace hise
+
+#endif  // NONUNIFORMCONVOLVER_H_INCLUDED
@@ -0,0 +1,300 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class NonUniformConvolverUnitTest : public UnitTest
+{
+public:
+
+	NonUniformConvolverUnitTest() :
+		UnitTest("Testing the non uniform convolution")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testPartitions();
+
+		for (auto irLength : { 10, 300, 5000, 40000 })
+		{
+			testConvolution(irLength, false);
+			testConvolution(irLength, true);
+		}
+
+		testTrueStereo(5000, false);
+		testTrueStereo(20000, true);
+
+		testLateJobs();
+	}
+
+private:
+
+	void testPartitions()
+	{
+		beginTest("Testing partition layout");
+
+		auto partitions = NonUniformConvolver::calculatePartitions(64, 8192, 100000);
+
+		int offset = 0;
+
+		for (const auto& p : partitions)
+		{
+			expectEquals(p.offset, offset, "Gap in the partitions");
+
+			if (p.offset != 0)
+				expect(p.offset >= 2 * p.blockSize, "Stage starts before its latency");
+
+			offset += p.length;
+		}
+
+		expectEquals(offset, 100000, "Partitions don't cover the impulse response");
+		expectEquals(partitions.getLast().blockSize, 8192, "Wrong maximum block size");
+	}
+
+	/** Compares the output for random buffer sizes against a direct convolution. */
+	void testConvolution(int irLength, bool useBackgroundThread)
+	{
+		beginTest("Testing IR with " + String(irLength) + " samples" + (useBackgroundThread ? " on the worker pool" : ""));
+
+		const int numSamples = 60000;
+
+		HeapBlock<float> ir(irLength);
+		HeapBlock<float> input(numSamples);
+		HeapBlock<float> output(numSamples);
+
+		for (int i = 0; i < irLength; i++)
+			ir[i] = r.nextFloat() * 2.0f - 1.0f;
+
+		for (int i = 0; i < numSamples; i++)
+			input[i] = r.nextFloat() * 2.0f - 1.0f;
+
+		NonUniformConvolver convolver;
+		convolver.setUseBackgroundThread(useBackgroundThread);
+		convolver.setWaitForLateJobs(true);
+		convolver.init(64, 8192, ir, irLength);
+
+		int pos = 0;
+
+		while (pos < numSamples)
+		{
+			const int numThisTime = jmin(numSamples - pos, 1 + r.nextInt(700));
+			convolver.process(input + pos, output + pos, numThisTime);
+			pos += numThisTime;
+		}
+
+		// Checking every sample against the direct convolution would take too long...
+		for (int i = 0; i < numSamples; i += 13)
+		{
+			double expected = 0.0;
+
+			for (int k = 0; k < jmin(irLength, i + 1); k++)
+				expected += (double)ir[k] * (double)input[i - k];
+
+			if (std::abs(expected - (double)output[i]) > 1e-3)
+			{
+				expect(false, "Mismatch at " + String(i) + ": " + String(expected) + " vs. " + String(output[i]));
+				break;
+			}
+		}
+
+		const auto stats = convolver.getStatistics(44100.0);
+
+		logMessage("Stages: " + String(stats.numStages) + ", late blocks: " + String(stats.numLateBlocks) + 
+				   ", audio thread: " + String(stats.audioThreadUsage * 100.0, 2) + "%, worker: " + String(stats.workerUsage * 100.0, 2) + "%");
+	}
+
+	/** Checks that the cross paths are summed correctly. */
+	void testTrueStereo(int irLength, bool useBackgroundThread)
+	{
+		beginTest("Testing true stereo IR with " + String(irLength) + " samples" + (useBackgroundThread ? " on the worker pool" : ""));
+
+		const int numSamples = 30000;
+
+		AudioSampleBuffer irs(4, irLength);
+		AudioSampleBuffer input(2, numSamples);
+		AudioSampleBuffer output(2, numSamples);
+
+		fillWithNoise(irs);
+		fillWithNoise(input);
+
+		NonUniformConvolver convolver(2, 2);
+		convolver.setUseBackgroundThread(useBackgroundThread);
+		convolver.setWaitForLateJobs(true);
+		convolver.init(128, 8192, irs.getArrayOfReadPointers(), irLength);
+
+		int pos = 0;
+
+		while (pos < numSamples)
+		{
+			const int numThisTime = jmin(numSamples - pos, 1 + r.nextInt(700));
+
+			const float* inputs[2] = { input.getReadPointer(0, pos), input.getReadPointer(1, pos) };
+			float* outputs[2] = { output.getWritePointer(0, pos), output.getWritePointer(1, pos) };
+
+			convolver.process(inputs, outputs, numThisTime);
+			pos += numThisTime;
+		}
+
+		for (int o = 0; o < 2; o++)
+		{
+			for (int i = 0; i < numSamples; i += 13)
+			{
+				double expected = 0.0;
+
+				for (int in = 0; in < 2; in++)
+				{
+					for (int k = 0; k < jmin(irLength, i + 1); k++)
+						expected += (double)irs.getSample(in * 2 + o, k) * (double)input.getSample(in, i - k);
+				}
+
+				if (std::abs(expected - (double)output.getSample(o, i)) > 1e-3)
+				{
+					expect(false, "Mismatch in channel " + String(o) + " at " + String(i));
+					return;
+				}
+			}
+		}
+	}
+
+	/** Occupies a worker thread until it is released. */
+	struct BlockingJob : public ConvolutionWorkerPool::Job
+	{
+		void run() override { release.wait(); }
+
+		int64 getDeadline() const override { return 0; }
+
+		WaitableEvent release;
+	};
+
+	/** Blocks all worker threads and checks that the audio thread renders the late tail stages correctly. */
+	void testLateJobs()
+	{
+		beginTest("Testing late tail jobs");
+
+		const int irLength = 5000;
+		const int numSamples = 30000;
+
+		AudioSampleBuffer ir(1, irLength);
+		AudioSampleBuffer input(1, numSamples);
+		AudioSampleBuffer output(1, numSamples);
+
+		fillWithNoise(ir);
+		fillWithNoise(input);
+
+		NonUniformConvolver convolver;
+		convolver.setUseBackgroundThread(true);
+		convolver.init(64, 8192, ir.getReadPointer(0), irLength);
+
+		SharedResourcePointer<ConvolutionWorkerPool> pool;
+		OwnedArray<BlockingJob> blockingJobs;
+
+		// Adding a job waits for the running jobs, so they must be added before the first one starts
+		for (int i = 0; i < HISE_NUM_CONVOLUTION_THREADS; i++)
+			pool->addJob(blockingJobs.add(new BlockingJob()));
+
+		for (auto j : blockingJobs)
+			pool->startJob(j);
+
+		auto allBlocked = [&blockingJobs]()
+		{
+			for (auto j : blockingJobs)
+			{
+				if (!j->isRunning())
+					return false;
+			}
+
+			return true;
+		};
+
+		while (!allBlocked())
+			Thread::sleep(1);
+
+		int pos = 0;
+
+		while (pos < numSamples)
+		{
+			const int numThisTime = jmin(numSamples - pos, 1 + r.nextInt(700));
+			convolver.process(input.getReadPointer(0, pos), output.getWritePointer(0, pos), numThisTime);
+			pos += numThisTime;
+		}
+
+		for (auto j : blockingJobs)
+			j->release.signal();
+
+		for (auto j : blockingJobs)
+			pool->removeJob(j);
+
+		expect(convolver.getStatistics(44100.0).numLateBlocks > 0, "No late blocks");
+
+		for (int i = 0; i < numSamples; i += 13)
+		{
+			double expected = 0.0;
+
+			for (int k = 0; k < jmin(irLength, i + 1); k++)
+				expected += (double)ir.getSample(0, k) * (double)input.getSample(0, i - k);
+
+			if (std::abs(expected - (double)output.getSample(0, i)) > 1e-3)
+			{
+				expect(false, "Mismatch at " + String(i));
+				break;
+			}
+		}
+	}
+
+	void fillWithNoise(AudioSampleBuffer& b)
+	{
+		for (int c = 0; c < b.getNumChannels(); c++)
+		{
+			for (int i = 0; i < b.getNumSamples(); i++)
+				b.setSample(c, i, r.nextFloat() * 2.0f - 1.0f);
+		}
+	}
+
+	Random r;
+};
+
+static NonUniformConvolverUnitTest nonUniformConvolverUnitTest;
+
+} // namespace hise
+
+#endif
@@ -152,6 +152,17 @@ public:
 
 		dryMeter->setPeak(d.inL, d.inR);
 		wetMeter->setPeak(d.outL, d.outR);
+
+#if USE_FFT_CONVOLVER
+		const auto stats = dynamic_cast<ConvolutionEffect*>(getProcessor())->getStatistics();
+
+		String tooltip;
+		tooltip << "Audio thread: " << String(stats.audioThreadUsage * 100.0, 1) << "%";
+		tooltip << ", worker threads: " << String(stats.workerUsage * 100.0, 1) << "%";
+		tooltip << ", late blocks: " << stats.numLateBlocks;
+
+		backgroundButton->setTooltip(tooltip);
+#endif
 	}
 
 	int getBodyHeight() const override
@@ -21,11 +21,6 @@
 
 namespace hise { using namespace juce;
 
-#if JUCE_IOS
-#else
-#include "../fx/dustfft.c"
-#endif
-
 //[/Headers]
 
 #include "CurveEqEditor.h"
@@ -460,28 +455,32 @@ void FilterDragOverlay::timerCallback()
 		return;
 	}
 
-#if JUCE_IOS
-    
-#else
-    
 	const int size = FFT_SIZE_FOR_EQ;
 	const int half = size / 2;
 
 	for(int i = 0; i < half; i++)
 	{
-		fftData[i] = std::complex<double>(d[i] * (double)i / (double)(half), 0.0);
+		fftData[i] = (float)(d[i] * (double)i / (double)(half));
 	}
 
 	for(int i = half; i < size; i++)
 	{
-		fftData[i] = std::complex<double>(d[i] * (1.0 - (double)(i - half) / (double)half), 0.0);
+		fftData[i] = (float)(d[i] * (1.0 - (double)(i - half) / (double)half));
 	}
 
-	DustFFT_fwdD(reinterpret_cast<double*>(fftData), size);
+	fft.realFFTInplace(fftData);
 
-	for(int i = 0; i < size; i++)
+	// The spectrum of a real signal is symmetric, so the upper half is mirrored
+	fftAmpData[0] = std::abs((double)fftData[0]) / (double)FFT_SIZE_FOR_EQ;
+	fftAmpData[half] = std::abs((double)fftData[1]) / (double)FFT_SIZE_FOR_EQ;
+
+	for(int i = 1; i < half; i++)
 	{
-		fftAmpData[i] = sqrt(fftData[i].imag() * fftData[i].imag() + fftData[i].real() * fftData[i].real()) / (double)FFT_SIZE_FOR_EQ;
+		const double re = (double)fftData[2 * i];
+		const double im = (double)fftData[2 * i + 1];
+
+		fftAmpData[i] = sqrt(re * re + im * im) / (double)FFT_SIZE_FOR_EQ;
+		fftAmpData[size - i] = fftAmpData[i];
 	}
 
 	for(int i = 0; i < size; i++)
@@ -560,8 +559,6 @@ void FilterDragOverlay::timerCallback()
 
 		repaint();
 	}
-    
-#endif
 }
 
 void FilterDragOverlay::paint(Graphics &g)
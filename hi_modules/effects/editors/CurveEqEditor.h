@@ -258,7 +258,8 @@ class FilterDragOverlay: public Component,
 public:
 
 	FilterDragOverlay():
-		fftRange(-80)
+		fftRange(-80),
+		fft(FFT_SIZE_FOR_EQ)
 	{
 		constrainer = new ComponentBoundsConstrainer();
 
@@ -453,7 +454,9 @@ private:
 
 	double fftRange;
 
-	std::complex<double> fftData[FFT_SIZE_FOR_EQ];
+	HiseFFT fft;
+
+	float fftData[FFT_SIZE_FOR_EQ];
 
 	double fftAmpData[FFT_SIZE_FOR_EQ];
 
@@ -261,8 +261,6 @@ void FFTDisplay::paint(Graphics& g)
 {
 	g.fillAll(getColourForAnalyser(AudioAnalyserComponent::bgColour));
 
-#if USE_IPP
-    
 	auto an = getAnalyser();
 
 	ScopedReadLock sl(an->getBufferLock());
@@ -271,7 +269,8 @@ void FFTDisplay::paint(Graphics& g)
 
 	int size = b.getNumSamples();
 
-	
+	if (size < 4 || !isPowerOfTwo(size))
+		return;
 
 	if (windowBuffer.getNumSamples() == 0 || windowBuffer.getNumSamples() != size)
 	{
@@ -281,6 +280,8 @@ void FFTDisplay::paint(Graphics& g)
 		fftBuffer.clear();
 
 		icstdsp::VectorFunctions::blackman(windowBuffer.getWritePointer(0), size);
+
+		fftObject = new HiseFFT(size);
 	}
 
 	AudioSampleBuffer b2(2, b.getNumSamples());
@@ -304,7 +305,7 @@ void FFTDisplay::paint(Graphics& g)
 	
 	auto sampleRate = getAnalyser()->getSampleRate();
 
-	fftObject.realFFTInplace(data, size);
+	fftObject->realFFTInplace(data);
 
 	for (int i = 2; i < size; i+= 2)
 	{
@@ -407,14 +408,6 @@ void FFTDisplay::paint(Graphics& g)
 	
 	g.setColour(getColourForAnalyser(AudioAnalyserComponent::fillColour));
 	g.fillPath(lPath);
-    
-#else
-    
-    g.setColour(getColourForAnalyser(AudioAnalyserComponent::fillColour));
-    g.setFont(GLOBAL_BOLD_FONT());
-    g.drawText("You need IPP for the FFT Analyser", 0.0f, 0.0f, (float)getWidth(), (float)getHeight(), Justification::centred, false);
-    
-#endif
 }
 
 Component* AudioAnalyserComponent::Panel::createContentComponent(int index)
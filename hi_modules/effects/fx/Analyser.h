@@ -257,21 +257,14 @@ class FFTDisplay : public AudioAnalyserComponent
 public:
 
 	FFTDisplay(Processor* p) :
-#if USE_IPP
-        AudioAnalyserComponent(p),
-		fftObject(IppFFT::DataType::RealFloat)
-#else
        AudioAnalyserComponent(p)
-#endif
 	{};
 
 	void paint(Graphics& g) override;
 
 private:
 
-#if USE_IPP
-	IppFFT fftObject;
-#endif
+	ScopedPointer<HiseFFT> fftObject;
 
 	Path lPath;
 	Path rPath;
@@ -113,6 +113,7 @@ namespace wdl
 #include "effects/fx/Phaser.cpp"
 #include "effects/fx/GainCollector.cpp"
 #include "effects/convolution/AtkConvolution.cpp"
+#include "effects/convolution/NonUniformConvolver.cpp"
 #include "effects/convolution/Convolution.cpp"
 #include "effects/mda/mdaLimiter.cpp"
 #include "effects/mda/mdaDegrade.cpp"
@@ -152,6 +152,7 @@ END_JUCE_MODULE_DECLARATION
 #include "effects/fx/Phaser.h"
 #include "effects/fx/GainCollector.h"
 #include "effects/convolution/AtkConvolution.h"
+#include "effects/convolution/NonUniformConvolver.h"
 #include "effects/convolution/Convolution.h"
 #include "effects/mda/mdaLimiter.h"
 #include "effects/mda/mdaDegrade.h"
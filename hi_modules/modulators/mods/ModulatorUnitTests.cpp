@@ -0,0 +1,217 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class EnvelopeVoiceBatchUnitTest : public UnitTest
+{
+public:
+
+	EnvelopeVoiceBatchUnitTest() :
+		UnitTest("Testing the envelope voice batch")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testIdenticalOutput(LinearEnvelopeVoiceBatch::MaxLanes, 64);
+		testIdenticalOutput(7, 61);
+		testIdenticalOutput(1, 3);
+
+		testPerformance(1);
+		testPerformance(16);
+		testPerformance(128);
+		testPerformance(256);
+	}
+
+private:
+
+	using EnvelopeState = SimpleEnvelope::SimpleEnvelopeState;
+
+	static constexpr float ReleaseDelta = 0.003f;
+
+	/** Creates the states of random voices in all polyphonic states. */
+	static void createVoiceStates(OwnedArray<EnvelopeState>& voiceStates, Random& r, int numVoices)
+	{
+		voiceStates.clear();
+
+		for (int i = 0; i < numVoices; i++)
+		{
+			auto s = voiceStates.add(new EnvelopeState(i));
+
+			const EnvelopeState::EnvelopeState polyStates[] = { EnvelopeState::ATTACK, EnvelopeState::SUSTAIN, EnvelopeState::RELEASE, EnvelopeState::IDLE };
+
+			s->current_state = polyStates[r.nextInt(4)];
+			s->current_value = s->current_state == EnvelopeState::IDLE ? 0.0f : (s->current_state == EnvelopeState::SUSTAIN ? 1.0f : r.nextFloat());
+			s->attackDelta = 0.0001f + r.nextFloat() * 0.05f;
+		}
+	}
+
+	/** Adds the voices to the batch the same way as SimpleEnvelope::calculateVoiceBatch(). */
+	static void fillBatch(LinearEnvelopeVoiceBatch& batch, const OwnedArray<EnvelopeState>& voiceStates, AudioSampleBuffer& destination)
+	{
+		batch.clear();
+		batch.setReleaseDelta(ReleaseDelta);
+
+		for (int i = 0; i < voiceStates.size(); i++)
+		{
+			auto s = voiceStates[i];
+			batch.addLane(s->current_value, s->attackDelta, getLaneState(*s), destination.getWritePointer(i));
+		}
+	}
+
+	/** Renders the voices one after another with the calculation that SimpleEnvelope::calculateBlock() uses in linear mode. */
+	static void renderVoicesSeparately(OwnedArray<EnvelopeState>& voiceStates, AudioSampleBuffer& destination, int numSamples)
+	{
+		for (int i = 0; i < voiceStates.size(); i++)
+		{
+			auto s = voiceStates[i];
+			float* d = destination.getWritePointer(i);
+
+			for (int j = 0; j < numSamples; j++)
+				d[j] = SimpleEnvelope::calculateNewLinearValue(*s, ReleaseDelta);
+		}
+	}
+
+	static LinearEnvelopeVoiceBatch::LaneState getLaneState(const EnvelopeState& s)
+	{
+		switch (s.current_state)
+		{
+		case EnvelopeState::ATTACK:		return LinearEnvelopeVoiceBatch::Attack;
+		case EnvelopeState::SUSTAIN:	return LinearEnvelopeVoiceBatch::Sustain;
+		case EnvelopeState::RELEASE:	return LinearEnvelopeVoiceBatch::Release;
+		default:						return LinearEnvelopeVoiceBatch::Idle;
+		}
+	}
+
+	void testIdenticalOutput(int numVoices, int numSamples)
+	{
+		beginTest("Testing identical output with " + String(numVoices) + " voices and " + String(numSamples) + " samples");
+
+		OwnedArray<EnvelopeState> voiceStates;
+		Random r(getRandom().nextInt64());
+
+		createVoiceStates(voiceStates, r, numVoices);
+
+		LinearEnvelopeVoiceBatch vectorBatch;
+		LinearEnvelopeVoiceBatch scalarBatch;
+
+		AudioSampleBuffer vectorOutput(numVoices, numSamples);
+		AudioSampleBuffer scalarOutput(numVoices, numSamples);
+		AudioSampleBuffer envelopeOutput(numVoices, numSamples);
+
+		fillBatch(vectorBatch, voiceStates, vectorOutput);
+		fillBatch(scalarBatch, voiceStates, scalarOutput);
+
+		// Run multiple blocks so that the states are carried over
+		for (int block = 0; block < 20; block++)
+		{
+			vectorBatch.process(numSamples);
+			scalarBatch.processScalar(numSamples);
+			renderVoicesSeparately(voiceStates, envelopeOutput, numSamples);
+
+			for (int i = 0; i < numVoices; i++)
+			{
+				const bool vectorEqual = memcmp(vectorOutput.getReadPointer(i), envelopeOutput.getReadPointer(i), sizeof(float) * numSamples) == 0;
+				const bool scalarEqual = memcmp(scalarOutput.getReadPointer(i), envelopeOutput.getReadPointer(i), sizeof(float) * numSamples) == 0;
+
+				expect(vectorEqual, "Values of voice " + String(i) + " in block " + String(block));
+				expect(scalarEqual, "Scalar values of voice " + String(i) + " in block " + String(block));
+				expectEquals<int>(vectorBatch.getState(i), getLaneState(*voiceStates[i]), "State of voice " + String(i));
+				expectEquals<float>(vectorBatch.getValue(i), voiceStates[i]->current_value, "Value of voice " + String(i));
+
+				if (!vectorEqual || !scalarEqual)
+					return;
+			}
+		}
+	}
+
+	void testPerformance(int numVoices)
+	{
+		numVoices = jmin<int>(numVoices, LinearEnvelopeVoiceBatch::MaxLanes);
+
+		beginTest("Benchmarking " + String(numVoices) + " voices");
+
+		const int numSamples = 64;
+		const int numBlocks = 10000;
+
+		OwnedArray<EnvelopeState> voiceStates;
+		LinearEnvelopeVoiceBatch batch;
+		AudioSampleBuffer output(numVoices, numSamples);
+		Random r(numVoices);
+
+		createVoiceStates(voiceStates, r, numVoices);
+
+		double start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numBlocks; i++)
+			renderVoicesSeparately(voiceStates, output, numSamples);
+
+		const double perVoiceTime = Time::getMillisecondCounterHiRes() - start;
+
+		createVoiceStates(voiceStates, r, numVoices);
+		fillBatch(batch, voiceStates, output);
+
+		start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numBlocks; i++)
+			batch.processScalar(numSamples);
+
+		const double scalarTime = Time::getMillisecondCounterHiRes() - start;
+
+		fillBatch(batch, voiceStates, output);
+
+		start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numBlocks; i++)
+			batch.process(numSamples);
+
+		const double vectorTime = Time::getMillisecondCounterHiRes() - start;
+
+		logMessage("Per voice: " + String(perVoiceTime, 2) + " ms, Scalar batch: " + String(scalarTime, 2) + " ms, SSE batch: " + String(vectorTime, 2) + " ms");
+	}
+};
+
+static EnvelopeVoiceBatchUnitTest envelopeVoiceBatchUnitTest;
+
+} // namespace hise
+
+#endif
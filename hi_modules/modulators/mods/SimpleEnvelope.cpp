@@ -323,6 +323,55 @@ void SimpleEnvelope::calculateBlock(int startSample, int numSamples)
 	
 }
 
+void SimpleEnvelope::calculateVoiceBatch(const int* voiceIndexes, int numVoices, float** destinations, int numSamples)
+{
+	jassert(canCalculateVoiceBatch());
+
+	voiceBatch.clear();
+	voiceBatch.setReleaseDelta(release_delta);
+
+	for (int i = 0; i < numVoices; i++)
+	{
+		auto s = static_cast<SimpleEnvelopeState*>(states[voiceIndexes[i]]);
+
+		LinearEnvelopeVoiceBatch::LaneState laneState;
+
+		switch (s->current_state)
+		{
+		case SimpleEnvelopeState::ATTACK:	laneState = LinearEnvelopeVoiceBatch::Attack; break;
+		case SimpleEnvelopeState::SUSTAIN:	laneState = LinearEnvelopeVoiceBatch::Sustain; break;
+		case SimpleEnvelopeState::RELEASE:	laneState = LinearEnvelopeVoiceBatch::Release; break;
+		case SimpleEnvelopeState::IDLE:		laneState = LinearEnvelopeVoiceBatch::Idle; break;
+		default:							jassertfalse; laneState = LinearEnvelopeVoiceBatch::Sustain; break; // retrigger is monophonic only
+		}
+
+		voiceBatch.addLane(s->current_value, s->attackDelta, laneState, destinations[i]);
+	}
+
+	voiceBatch.process(numSamples);
+
+	const int lastStartedVoice = polyManager.getLastStartedVoice();
+
+	for (int i = 0; i < numVoices; i++)
+	{
+		auto s = static_cast<SimpleEnvelopeState*>(states[voiceIndexes[i]]);
+
+		s->current_value = voiceBatch.getValue(i);
+
+		switch (voiceBatch.getState(i))
+		{
+		case LinearEnvelopeVoiceBatch::Attack:	s->current_state = SimpleEnvelopeState::ATTACK; break;
+		case LinearEnvelopeVoiceBatch::Sustain:	s->current_state = SimpleEnvelopeState::SUSTAIN; break;
+		case LinearEnvelopeVoiceBatch::Release:	s->current_state = SimpleEnvelopeState::RELEASE; break;
+		case LinearEnvelopeVoiceBatch::Idle:	s->current_state = SimpleEnvelopeState::IDLE; break;
+		default:								jassertfalse; break;
+		}
+
+		if (voiceIndexes[i] == lastStartedVoice)
+			setOutputValue(destinations[i][0]);
+	}
+}
+
 void SimpleEnvelope::handleHiseEvent(const HiseEvent &m)
 {
 	EnvelopeModulator::handleHiseEvent(m);
@@ -375,41 +424,46 @@ float SimpleEnvelope::calcCoefficient(float time, float targetRatio/*=1.0f*/) co
 
 float SimpleEnvelope::calculateNewValue()
 {
-	switch (state->current_state)
+	return calculateNewLinearValue(*state, release_delta);
+}
+
+float SimpleEnvelope::calculateNewLinearValue(SimpleEnvelopeState& s, float releaseDelta) noexcept
+{
+	switch (s.current_state)
 	{
 	
 	case SimpleEnvelopeState::SUSTAIN: break;
 	case SimpleEnvelopeState::IDLE: break;
 	case SimpleEnvelopeState::ATTACK:
-		state->current_value += state->attackDelta;
-		if (state->current_value >= 1.0f)
+		s.current_value += s.attackDelta;
+		if (s.current_value >= 1.0f)
 		{
-			state->current_value = 1.0f;
-			state->current_state = SimpleEnvelopeState::SUSTAIN;
+			s.current_value = 1.0f;
+			s.current_state = SimpleEnvelopeState::SUSTAIN;
 		}
 		break;
 	case SimpleEnvelopeState::RETRIGGER:
 	{
-		state->current_value -= 0.005f;
-		if (state->current_value <= 0.0f)
+		s.current_value -= 0.005f;
+		if (s.current_value <= 0.0f)
 		{
-			state->current_value = 0.0f;
-			state->current_state = SimpleEnvelopeState::ATTACK;
+			s.current_value = 0.0f;
+			s.current_state = SimpleEnvelopeState::ATTACK;
 		}
 		break;
 	}
 	case SimpleEnvelopeState::RELEASE:
-		state->current_value -= release_delta;
-		if (state->current_value <= 0.0f)
+		s.current_value -= releaseDelta;
+		if (s.current_value <= 0.0f)
 		{
-			state->current_value = 0.0f;
-			state->current_state = SimpleEnvelopeState::IDLE;
+			s.current_value = 0.0f;
+			s.current_state = SimpleEnvelopeState::IDLE;
 		}
 		break;
 	default:					    jassertfalse; break;
 	}
 
-	return state->current_value;
+	return s.current_value;
 }
 
 float SimpleEnvelope::calculateNewExpValue()
@@ -515,4 +569,165 @@ void SimpleEnvelope::setReleaseRate(float rate)
 	}
 }
 
+LinearEnvelopeVoiceBatch::LinearEnvelopeVoiceBatch()
+{
+	zeromem(values, sizeof(values));
+	zeromem(attackDeltas, sizeof(attackDeltas));
+	zeromem(states, sizeof(states));
+	zeromem(destinations, sizeof(destinations));
+}
+
+int LinearEnvelopeVoiceBatch::addLane(float currentValue, float attackDelta, LaneState state, float* destination) noexcept
+{
+	jassert(numLanes < MaxLanes);
+
+	values[numLanes] = currentValue;
+	attackDeltas[numLanes] = attackDelta;
+	states[numLanes] = (int)state;
+	destinations[numLanes] = destination;
+
+	return numLanes++;
+}
+
+void LinearEnvelopeVoiceBatch::processScalar(int numSamples) noexcept
+{
+	processLanes(0, numLanes, numSamples);
+}
+
+void LinearEnvelopeVoiceBatch::processLanes(int startLane, int endLane, int numSamples) noexcept
+{
+	for (int l = startLane; l < endLane; l++)
+	{
+		float v = values[l];
+		int state = states[l];
+		float* d = destinations[l];
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			if (state == Attack)
+			{
+				v += attackDeltas[l];
+
+				if (v >= 1.0f)
+				{
+					v = 1.0f;
+					state = Sustain;
+				}
+			}
+			else if (state == Release)
+			{
+				v -= releaseDelta;
+
+				if (v <= 0.0f)
+				{
+					v = 0.0f;
+					state = Idle;
+				}
+			}
+
+			d[i] = v;
+		}
+
+		values[l] = v;
+		states[l] = state;
+	}
+}
+
+void LinearEnvelopeVoiceBatch::process(int numSamples) noexcept
+{
+#if JUCE_USE_SSE_INTRINSICS
+
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 rd = _mm_set1_ps(releaseDelta);
+	const __m128i attackState = _mm_set1_epi32(Attack);
+	const __m128i releaseState = _mm_set1_epi32(Release);
+	const __m128i sustainState = _mm_set1_epi32(Sustain);
+	const __m128i idleState = _mm_set1_epi32(Idle);
+
+	const int numVectorLanes = numLanes & ~3;
+
+	for (int l = 0; l < numVectorLanes; l += 4)
+	{
+		__m128 v = _mm_loadu_ps(values + l);
+		const __m128 ad = _mm_loadu_ps(attackDeltas + l);
+		const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(states + l));
+
+		const __m128 attackAtStart = _mm_castsi128_ps(_mm_cmpeq_epi32(s, attackState));
+		const __m128 releaseAtStart = _mm_castsi128_ps(_mm_cmpeq_epi32(s, releaseState));
+
+		__m128 attackMask = attackAtStart;
+		__m128 releaseMask = releaseAtStart;
+
+		// Adding / subtracting zero for the inactive phases keeps the result identical to the scalar code
+		auto tick = [&]()
+		{
+			v = _mm_sub_ps(_mm_add_ps(v, _mm_and_ps(attackMask, ad)), _mm_and_ps(releaseMask, rd));
+
+			const __m128 attackDone = _mm_and_ps(attackMask, _mm_cmpge_ps(v, one));
+			v = _mm_or_ps(_mm_andnot_ps(attackDone, v), _mm_and_ps(attackDone, one));
+			attackMask = _mm_andnot_ps(attackDone, attackMask);
+
+			const __m128 releaseDone = _mm_and_ps(releaseMask, _mm_cmple_ps(v, zero));
+			v = _mm_andnot_ps(releaseDone, v);
+			releaseMask = _mm_andnot_ps(releaseDone, releaseMask);
+
+			return v;
+		};
+
+		float* d0 = destinations[l];
+		float* d1 = destinations[l + 1];
+		float* d2 = destinations[l + 2];
+		float* d3 = destinations[l + 3];
+
+		int i = 0;
+
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			__m128 r0 = tick();
+			__m128 r1 = tick();
+			__m128 r2 = tick();
+			__m128 r3 = tick();
+
+			// rows are samples, columns are voices
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			_mm_storeu_ps(d0 + i, r0);
+			_mm_storeu_ps(d1 + i, r1);
+			_mm_storeu_ps(d2 + i, r2);
+			_mm_storeu_ps(d3 + i, r3);
+		}
+
+		for (; i < numSamples; i++)
+		{
+			float tmp[4];
+			_mm_storeu_ps(tmp, tick());
+
+			d0[i] = tmp[0];
+			d1[i] = tmp[1];
+			d2[i] = tmp[2];
+			d3[i] = tmp[3];
+		}
+
+		_mm_storeu_ps(values + l, v);
+
+		// Lanes that left the attack phase are sustaining, lanes that left the release phase are idle
+		const __m128i attackFinished = _mm_castps_si128(_mm_andnot_ps(attackMask, attackAtStart));
+		const __m128i releaseFinished = _mm_castps_si128(_mm_andnot_ps(releaseMask, releaseAtStart));
+
+		__m128i newStates = _mm_or_si128(_mm_andnot_si128(attackFinished, s), _mm_and_si128(attackFinished, sustainState));
+		newStates = _mm_or_si128(_mm_andnot_si128(releaseFinished, newStates), _mm_and_si128(releaseFinished, idleState));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(states + l), newStates);
+	}
+
+	processLanes(numVectorLanes, numLanes, numSamples);
+
+#else
+
+	processScalar(numSamples);
+
+#endif
+}
+
 } // namespace hise
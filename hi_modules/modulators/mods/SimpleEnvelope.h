@@ -40,6 +40,65 @@ class ExponentialStateCalculator
 
 };
 
+/** Calculates the linear attack / release ramps of multiple voices at once.
+*
+*	The state of each voice is stored in a lane of a structure of arrays, so that four voices can be
+*	calculated with one SSE instruction. The values are exactly the same as the scalar calculation in
+*	SimpleEnvelope::calculateNewValue().
+*/
+class LinearEnvelopeVoiceBatch
+{
+public:
+
+	enum LaneState
+	{
+		Idle = 0,
+		Attack,
+		Sustain,
+		Release,
+		numLaneStates
+	};
+
+	LinearEnvelopeVoiceBatch();
+
+	/** Removes all lanes. */
+	void clear() noexcept { numLanes = 0; }
+
+	/** Adds a voice and returns the lane index. The values of this lane will be written to the destination. */
+	int addLane(float currentValue, float attackDelta, LaneState state, float* destination) noexcept;
+
+	void setReleaseDelta(float newReleaseDelta) noexcept { releaseDelta = newReleaseDelta; }
+
+	/** Calculates the given amount of samples for all lanes. */
+	void process(int numSamples) noexcept;
+
+	/** Calculates the lanes one after another. This is used as reference for the vectorised version. */
+	void processScalar(int numSamples) noexcept;
+
+	int getNumLanes() const noexcept { return numLanes; }
+
+	float getValue(int laneIndex) const noexcept { return values[laneIndex]; }
+
+	LaneState getState(int laneIndex) const noexcept { return (LaneState)states[laneIndex]; }
+
+	/** The maximum number of lanes (rounded up to a multiple of the vector size). */
+	static constexpr int MaxLanes = (NUM_POLYPHONIC_VOICES + 3) & ~3;
+
+private:
+
+	void processLanes(int startLane, int endLane, int numSamples) noexcept;
+
+	float values[MaxLanes];
+	float attackDeltas[MaxLanes];
+	int states[MaxLanes];
+	float* destinations[MaxLanes];
+
+	float releaseDelta = 0.0f;
+	int numLanes = 0;
+
+	JUCE_DECLARE_NON_COPYABLE(LinearEnvelopeVoiceBatch)
+};
+
 /** @ingroup modulatorTypes
 
 ### Simple Envelope
@@ -107,6 +166,11 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 	void calculateBlock(int startSample, int numSamples) override;
+
+	/** The linear mode can be calculated for all voices at once. */
+	bool canCalculateVoiceBatch() const override { return linearMode && !isMonophonic; }
+
+	void calculateVoiceBatch(const int* voiceIndexes, int numVoices, float** destinations, int numSamples) override;
 	void handleHiseEvent(const HiseEvent& m) override;
 	
 	ProcessorEditorBody *createEditor(ProcessorEditor *parentEditor)  override;
@@ -153,6 +217,9 @@ public:
 
 	ModulatorState *createSubclassedState(int voiceIndex) const override {return new SimpleEnvelopeState(voiceIndex); };
 
+	/** Advances the linear envelope of the given state by one sample and returns the new value. */
+	static float calculateNewLinearValue(SimpleEnvelopeState& s, float releaseDelta) noexcept;
+
 private:
 
 	float calcCoefficient(float time, float targetRatio=1.0f) const;
@@ -184,6 +251,8 @@ private:
 
 	ScopedPointer<ModulatorChain> attackChain;
 
+	LinearEnvelopeVoiceBatch voiceBatch;
+
 	SimpleEnvelopeState *state;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimpleEnvelope)
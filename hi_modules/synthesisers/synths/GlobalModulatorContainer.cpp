@@ -215,21 +215,44 @@ juce::ValueTree GlobalModulatorContainer::exportModulatedParameters() const
 }
 
 void GlobalModulatorContainer::restoreModulatedParameters(const ValueTree& v)
+{
+	PreparedModulatedParameters p;
+	prepareModulatedParameters(v, p);
+
+	ScopedLock sl(getMainController()->getLock());
+	swapModulatedParameters(p);
+}
+
+void GlobalModulatorContainer::prepareModulatedParameters(const ValueTree& v, PreparedModulatedParameters& p) const
 {
 	for (const auto& c : v)
 	{
-		auto pId = c.getProperty("id");
+		auto pId = c.getProperty("id").toString();
 
 		for (auto d : data)
 		{
 			if (pId == d->getProcessor()->getId())
 			{
-				d->restoreParameterConnections(c);
+				auto item = p.items.add(new PreparedModulatedParameters::Item());
+				item->modulatorId = pId;
+				GlobalModulatorData::createParameterConnections(c, item->connections);
 			}
 		}
 	}
 }
 
+void GlobalModulatorContainer::swapModulatedParameters(PreparedModulatedParameters& p)
+{
+	for (auto item : p.items)
+	{
+		for (auto d : data)
+		{
+			if (item->modulatorId == d->getProcessor()->getId())
+				d->swapParameterConnections(item->connections);
+		}
+	}
+}
+
 void GlobalModulatorContainer::refreshList()
 {
 	// Delete all old datas
@@ -170,16 +170,28 @@ public:
 
 	void restoreParameterConnections(const ValueTree& v)
 	{
-		connectedParameters.clear();
+		OwnedArray<ParameterConnection> newConnections;
+		createParameterConnections(v, newConnections);
+		swapParameterConnections(newConnections);
+	}
 
+	/** Creates the connections from the given ValueTree without changing the current ones. */
+	static void createParameterConnections(const ValueTree& v, OwnedArray<ParameterConnection>& connections)
+	{
 		for (const auto& c : v)
 		{
 			auto p = new ParameterConnection(nullptr, -1, {});
 			p->restoreFromValueTree(c);
-			connectedParameters.add(p);
+			connections.add(p);
 		}
 	}
 
+	/** Swaps the connections. The old connections will be deleted with the given array. */
+	void swapParameterConnections(OwnedArray<ParameterConnection>& connections)
+	{
+		connectedParameters.swapWith(connections);
+	}
+
 	void handleTimeVariantControlledParameters(int startSample, int numThisTime) const;
 private:
 
@@ -220,6 +232,9 @@ public:
 	void preStartVoice(int voiceIndex, int noteNumber);
 	void postVoiceRendering(int startSample, int numThisTime);
 
+	/** The container calculates its modulators in postVoiceRendering(), so it needs the sub blocks. */
+	bool supportsCoalescedRendering() const override { return false; }
+
 	void addProcessorsWhenEmpty() override {};
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
@@ -239,6 +254,24 @@ public:
 
 	void restoreModulatedParameters(const ValueTree& v);
 
+	/** The parameter connections of a user preset that are created before they are swapped in. */
+	struct PreparedModulatedParameters
+	{
+		struct Item
+		{
+			String modulatorId;
+			OwnedArray<GlobalModulatorData::ParameterConnection> connections;
+		};
+
+		OwnedArray<Item> items;
+	};
+
+	/** Creates the parameter connections from the given ValueTree without changing the current state. */
+	void prepareModulatedParameters(const ValueTree& v, PreparedModulatedParameters& p) const;
+
+	/** Swaps the prepared connections with the current ones. This doesn't allocate, so you can call it on the audio thread. */
+	void swapModulatedParameters(PreparedModulatedParameters& p);
+
 private:
 
 	friend class GlobalModulatorContainerVoice;
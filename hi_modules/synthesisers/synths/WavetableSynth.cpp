@@ -89,6 +89,53 @@ void WavetableSynth::getWaveformTableValues(int /*displayIndex*/, float const**
 	}
 }
 
+void WavetableSynth::loadWaveTable(const ValueTree& v, const File& mipMapCacheFile)
+{
+	clearSounds();
+
+	jassert(v.isValid());
+
+	ValueTree mipMapCache;
+
+	if (mipMapCacheFile.existsAsFile())
+	{
+		FileInputStream fis(mipMapCacheFile);
+
+		mipMapCache = ValueTree::readFromStream(fis);
+	}
+
+	bool cacheNeedsUpdate = false;
+
+	for (int i = 0; i < v.getNumChildren(); i++)
+	{
+		auto child = v.getChild(i);
+		auto cachedMipMaps = mipMapCache.getChildWithProperty("hash", WavetableSound::getDataHash(child));
+
+		cacheNeedsUpdate |= !cachedMipMaps.isValid();
+
+		auto s = new WavetableSound(child, cachedMipMaps);
+
+		s->calculatePitchRatio(getSampleRate());
+
+		addSound(s);
+	}
+
+	if (cacheNeedsUpdate && mipMapCacheFile != File())
+	{
+		ValueTree newCache("mipmaps");
+
+		for (int i = 0; i < sounds.size(); i++)
+			newCache.addChild(static_cast<WavetableSound*>(getSound(i))->exportMipMaps(), -1, nullptr);
+
+		mipMapCacheFile.deleteFile();
+
+		FileOutputStream fos(mipMapCacheFile);
+
+		if (fos.openedOk())
+			newCache.writeToStream(fos);
+	}
+}
+
 ProcessorEditorBody* WavetableSynth::createEditor(ProcessorEditor *parentEditor)
 {
 #if USE_BACKEND
@@ -129,29 +176,63 @@ void WavetableSynthVoice::calculateBlock(int startSample, int numSamples)
 	const float *modValues = getVoiceGainValues(startSample, numSamples);
 	const float *tableValues = getTableModulationValues(startSample, numSamples);
 
+	// The highest pitch of this block decides which band limited tables can be used
+	double maxUptimeDelta = uptimeDelta;
+
+	if (voicePitchValues != nullptr)
+		maxUptimeDelta *= (double)FloatVectorOperations::findMaximum(voicePitchValues + startSample, numSamples);
+
+	const int mipMapLevel = currentSound->getMipMapLevel(maxUptimeDelta);
+
 	if (hqMode)
 	{
-		while (--numSamples >= 0)
-		{
-			// Get the two indexes for the table position
+		calculateHqBlock(voicePitchValues, tableValues, startSample, numSamples, mipMapLevel);
+	}
+	else
+	{
+		calculateSmoothedBlock(voicePitchValues, tableValues, startSample, numSamples, mipMapLevel);
+	}
+
+	// Stereo mode assumed
+	FloatVectorOperations::copy(voiceBuffer.getWritePointer(1, startIndex), voiceBuffer.getReadPointer(0, startIndex), samplesToCopy);
 
+	// Update the slider pack display once per block
+	getGainValue(tableValues[startIndex + samplesToCopy - 1]);
 
+	getOwnerSynth()->effectChain->renderVoice(voiceIndex, voiceBuffer, startIndex, samplesToCopy);
 
-			int index = (int)voiceUptime;
+	FloatVectorOperations::multiply(voiceBuffer.getWritePointer(0, startIndex), modValues + startIndex, samplesToCopy);
+	FloatVectorOperations::multiply(voiceBuffer.getWritePointer(1, startIndex), modValues + startIndex, samplesToCopy);
+
+	if (getOwnerSynth()->getLastStartedVoice() == this)
+	{
+		static_cast<WavetableSynth*>(getOwnerSynth())->triggerWaveformUpdate();
+	}
+}
 
-			const int i1 = index % (tableSize);
+void WavetableSynthVoice::calculateHqBlock(const float* voicePitchValues, const float* tableValues, int startSample, int numSamples, int mipMapLevel)
+{
+	const float* lowerTables[KernelChunkSize];
+	const float* upperTables[KernelChunkSize];
+	int indexes[KernelChunkSize];
+	float alphas[KernelChunkSize];
+	float tableDeltas[KernelChunkSize];
+	float gainValues[KernelChunkSize];
 
-			int i2 = i1 + 1;
+	const int mipMapSize = currentSound->getMipMapSize(mipMapLevel);
+	const int mask = mipMapSize - 1;
+	const double positionFactor = (double)mipMapSize / (double)tableSize;
+	const float normalizeGain = 1.0f / currentSound->getUnnormalizedMaximum();
 
-			if (i2 >= tableSize)
-			{
-				const float tableModValue = tableValues[startSample];
-				currentTableIndex = roundToInt(tableModValue * 63);
+	float* output = voiceBuffer.getWritePointer(0);
 
-				i2 = 0;
-			}
+	while (numSamples > 0)
+	{
+		const int numThisTime = jmin<int>(numSamples, KernelChunkSize);
 
-			const float tableModValue = tableValues[startSample];
+		for (int i = 0; i < numThisTime; i++)
+		{
+			const float tableModValue = tableValues[startSample + i];
 
 			const float tableValue = jlimit<float>(0.0f, 1.0f, tableModValue) * 63.0f;
 
@@ -160,173 +241,201 @@ void WavetableSynthVoice::calculateBlock(int startSample, int numSamples)
 			const float tableDelta = tableValue - (float)lowerTableIndex;
 			jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
 
-			lowerTable = currentSound->getWaveTableData(lowerTableIndex);
-			upperTable = currentSound->getWaveTableData(upperTableIndex);
+			lowerTables[i] = currentSound->getMipMapData(mipMapLevel, lowerTableIndex);
+			upperTables[i] = currentSound->getMipMapData(mipMapLevel, upperTableIndex);
+			tableDeltas[i] = tableDelta;
 
 			float tableGainValue = tableGainInterpolator.interpolateLinear(currentSound->getUnnormalizedGainValue(lowerTableIndex), currentSound->getUnnormalizedGainValue(upperTableIndex), tableDelta);
 
-			tableGainValue *= getGainValue(tableModValue);
-
-			float u1 = upperTable[i1];
-			float u2 = upperTable[i2];
+			tableGainValue *= wavetableSynth->getGainValueFromTableSilently(tableModValue);
 
-			float l1 = lowerTable[i1];
-			float l2 = lowerTable[i2];
+			gainValues[i] = tableGainValue * normalizeGain;
 
-			const float alpha = float(voiceUptime) - (float)index;
-			//const float invAlpha = 1.0f - alpha;
+			const double position = voiceUptime * positionFactor;
+			const int index = (int)position;
 
-			const float upperSample = tableGainInterpolator.interpolateLinear(u1, u2, alpha);
+			indexes[i] = index;
+			alphas[i] = (float)(position - (double)index);
 
-			const float lowerSample = tableGainInterpolator.interpolateLinear(l1, l2, alpha);
+			jassert(voicePitchValues == nullptr || voicePitchValues[startSample + i] > 0.0f);
 
-			float sample = lowerTableIndex != upperTableIndex ? tableGainInterpolator.interpolateLinear(lowerSample, upperSample, tableDelta) : lowerSample;
+			voiceUptime += (voicePitchValues == nullptr) ? uptimeDelta : (uptimeDelta * voicePitchValues[startSample + i]);
+		}
 
-			sample *= tableGainValue;
+		WavetableOscillatorKernel::process(output + startSample, lowerTables, upperTables, indexes, alphas, tableDeltas, gainValues, mask, numThisTime);
 
-			sample *= 1.0f / currentSound->getUnnormalizedMaximum();
+		startSample += numThisTime;
+		numSamples -= numThisTime;
+	}
 
-			// Stereo mode assumed
-			voiceBuffer.setSample(0, startSample, sample);
-			voiceBuffer.setSample(1, startSample, sample);
+	currentTableIndex = roundToInt(jlimit<float>(0.0f, 1.0f, tableValues[startSample - 1]) * 63.0f);
+}
 
-			jassert(voicePitchValues == nullptr || voicePitchValues[startSample] > 0.0f);
+void WavetableSynthVoice::calculateSmoothedBlock(const float* voicePitchValues, const float* tableValues, int startSample, int numSamples, int mipMapLevel)
+{
+	const int mipMapSize = currentSound->getMipMapSize(mipMapLevel);
+	const int mask = mipMapSize - 1;
+	const double positionFactor = (double)mipMapSize / (double)tableSize;
+	const float normalizeGain = 1.0f / currentSound->getUnnormalizedMaximum();
 
-			const double delta = (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample]));
+	// The crossfade spans one cycle of the table of the current level
+	smoothSize = mipMapSize;
 
-			voiceUptime += delta;
+	// The mip map level might have changed since the last block
+	currentTable = currentSound->getMipMapData(mipMapLevel, currentTableIndex);
+	nextTable = currentSound->getMipMapData(mipMapLevel, nextTableIndex);
 
-			++startSample;
+	float* output = voiceBuffer.getWritePointer(0);
 
-		}
-	}
-	else
+	while (--numSamples >= 0)
 	{
+		const double position = voiceUptime * positionFactor;
+		const int index = (int)position;
 
+		const int i1 = index & mask;
+		const int i2 = (i1 + 1) & mask;
 
-		while (--numSamples >= 0)
+		if (index == 0 || i2 == 0)
 		{
-			int index = (int)voiceUptime;
+			const float tableModValue = tableValues[startSample];
 
-			const int i1 = index % (tableSize);
+			currentTableIndex = nextTableIndex;
+			nextTableIndex = roundToInt(tableModValue * 63);
 
-			int i2 = i1 + 1;
+			currentTable = nextTable;
+			nextTable = currentSound->getMipMapData(mipMapLevel, nextTableIndex);
+		}
 
-			if (i2 >= tableSize)
-			{
-				i2 = 0;
-			}
+		const float tableModValue = tableValues[startSample];
 
-			//const int i2 = (index +1) % (tableSize);
+		const int tableGainLowIndex = (int)(tableModValue * 63);
+		const int tableGainHighIndex = jmin(63, tableGainLowIndex + 1);
+		const float tableGainAlpha = tableModValue * 63 - tableGainLowIndex;
 
-			const int smoothIndex = index % smoothSize;
+		float tableGainValue = tableGainInterpolator.interpolateLinear(currentSound->getUnnormalizedGainValue(tableGainLowIndex), currentSound->getUnnormalizedGainValue(tableGainHighIndex), tableGainAlpha);
 
-			if (index == 0 || i2 == 0)
-			{
-				const float tableModValue = tableValues[startSample];
+		tableGainValue *= wavetableSynth->getGainValueFromTableSilently(tableModValue);
 
-				currentTableIndex = nextTableIndex;
-				nextTableIndex = roundToInt(tableModValue * 63);
+		const float alpha = (float)(position - (double)index);
 
-				//DBG(nextTableIndex);
+		const float currentSample = tableGainInterpolator.interpolateLinear(currentTable[i1], currentTable[i2], alpha);
+		const float nextSample = tableGainInterpolator.interpolateLinear(nextTable[i1], nextTable[i2], alpha);
 
-				currentGainValue = nextGainValue;
-				nextGainValue = getGainValue(tableModValue);
+		// The smooth size is the table size, so the crossfade position is the read position within the cycle
+		const float tableAlpha = (float)i1 / (float)(smoothSize - 1);
 
-				currentTable = nextTable;
-				nextTable = currentSound->getWaveTableData(nextTableIndex);
-			}
+		float sample = tableGainInterpolator.interpolateLinear(currentSample, nextSample, tableAlpha);
 
+		sample *= tableGainValue;
+		sample *= normalizeGain;
 
-			const float tableModValue = tableValues[startSample];
+		output[startSample] = sample;
 
+		const double delta = (voicePitchValues != nullptr) ? (uptimeDelta * voicePitchValues[startSample]) : uptimeDelta;
 
+		voiceUptime += delta;
+
+		++startSample;
+	}
+}
 
-			const int tableGainLowIndex = (int)(tableModValue * 63);
-			const int tableGainHighIndex = jmin(63, tableGainLowIndex + 1);
-			const float tableGainAlpha = tableModValue * 63 - tableGainLowIndex;
+const float *WavetableSynthVoice::getTableModulationValues(int startSample, int numSamples)
+{
+	dynamic_cast<WavetableSynth*>(getOwnerSynth())->calculateTableModulationValuesForVoice(voiceIndex, startSample, numSamples);
 
-			float tableGainValue = tableGainInterpolator.interpolateLinear(currentSound->getUnnormalizedGainValue(tableGainLowIndex), currentSound->getUnnormalizedGainValue(tableGainHighIndex), tableGainAlpha);
+	return dynamic_cast<WavetableSynth*>(getOwnerSynth())->getTableModValues(voiceIndex);
+}
 
-			tableGainValue *= getGainValue(tableModValue);
+void WavetableSynthVoice::stopNote(float velocity, bool allowTailoff)
+{
 
-			float v1 = currentTable[i1];
-			float v2 = currentTable[i2];
+	ModulatorSynthVoice::stopNote(velocity, allowTailoff);
 
-			float n1 = nextTable[i1];
-			float n2 = nextTable[i2];
+	ModulatorChain *c = static_cast<ModulatorChain*>(getOwnerSynth()->getChildProcessor(WavetableSynth::TableIndexModulation));
 
-			const float alpha = float(voiceUptime) - (float)index;
-			//const float invAlpha = 1.0f - alpha;
+	c->stopVoice(voiceIndex);
+}
 
-			const float currentSample = tableGainInterpolator.interpolateLinear(v1, v2, alpha);
+int WavetableSynthVoice::getSmoothSize() const
+{
+	return wavetableSynth->getMorphSmoothing();
+}
 
-			const float nextSample = tableGainInterpolator.interpolateLinear(n1, n2, alpha);
 
-			const float tableAlpha = (float)smoothIndex / (float)(smoothSize - 1);
 
+void WavetableOscillatorKernel::process(float* destination, const float* const* lowerTables, const float* const* upperTables, const int* indexes, const float* alphas, const float* tableDeltas, const float* gainValues, int mask, int numSamples) noexcept
+{
+#if JUCE_USE_SSE_INTRINSICS
 
-			currentGainValue = 1.0f;
-			nextGainValue = 1.0f;
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128i m = _mm_set1_epi32(mask);
+	const __m128i increment = _mm_set1_epi32(1);
 
-			float sample = tableGainInterpolator.interpolateLinear(currentSample, nextSample, tableAlpha);
+	int i = 0;
 
-			sample *= tableGainValue;
+	for (; i + 4 <= numSamples; i += 4)
+	{
+		alignas(16) int i1[4];
+		alignas(16) int i2[4];
 
-			sample *= 1.0f / currentSound->getUnnormalizedMaximum();
+		const __m128i index = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indexes + i)), m);
 
-			// Stereo mode assumed
-			voiceBuffer.setSample(0, startSample, sample);
-			voiceBuffer.setSample(1, startSample, sample);
+		_mm_store_si128(reinterpret_cast<__m128i*>(i1), index);
+		_mm_store_si128(reinterpret_cast<__m128i*>(i2), _mm_and_si128(_mm_add_epi32(index, increment), m));
 
-			const double delta = (voicePitchValues != nullptr) ? (uptimeDelta * voicePitchValues[startSample]) : uptimeDelta;
+		const float* const* l = lowerTables + i;
+		const float* const* u = upperTables + i;
 
-			voiceUptime += delta;
+		// There is no gather instruction in SSE2, so the table values are loaded one by one
+		const __m128 l1 = _mm_setr_ps(l[0][i1[0]], l[1][i1[1]], l[2][i1[2]], l[3][i1[3]]);
+		const __m128 l2 = _mm_setr_ps(l[0][i2[0]], l[1][i2[1]], l[2][i2[2]], l[3][i2[3]]);
+		const __m128 u1 = _mm_setr_ps(u[0][i1[0]], u[1][i1[1]], u[2][i1[2]], u[3][i1[3]]);
+		const __m128 u2 = _mm_setr_ps(u[0][i2[0]], u[1][i2[1]], u[2][i2[2]], u[3][i2[3]]);
 
+		const __m128 alpha = _mm_loadu_ps(alphas + i);
+		const __m128 invAlpha = _mm_sub_ps(one, alpha);
 
+		const __m128 lowerSample = _mm_add_ps(_mm_mul_ps(invAlpha, l1), _mm_mul_ps(alpha, l2));
+		const __m128 upperSample = _mm_add_ps(_mm_mul_ps(invAlpha, u1), _mm_mul_ps(alpha, u2));
 
+		const __m128 tableDelta = _mm_loadu_ps(tableDeltas + i);
+		const __m128 invTableDelta = _mm_sub_ps(one, tableDelta);
 
-			++startSample;
-		}
+		const __m128 sample = _mm_add_ps(_mm_mul_ps(invTableDelta, lowerSample), _mm_mul_ps(tableDelta, upperSample));
 
+		_mm_storeu_ps(destination + i, _mm_mul_ps(sample, _mm_loadu_ps(gainValues + i)));
 	}
 
-	getOwnerSynth()->effectChain->renderVoice(voiceIndex, voiceBuffer, startIndex, samplesToCopy);
+	processScalar(destination + i, lowerTables + i, upperTables + i, indexes + i, alphas + i, tableDeltas + i, gainValues + i, mask, numSamples - i);
 
-	FloatVectorOperations::multiply(voiceBuffer.getWritePointer(0, startIndex), modValues + startIndex, samplesToCopy);
-	FloatVectorOperations::multiply(voiceBuffer.getWritePointer(1, startIndex), modValues + startIndex, samplesToCopy);
-
-	if (getOwnerSynth()->getLastStartedVoice() == this)
-	{
-		static_cast<WavetableSynth*>(getOwnerSynth())->triggerWaveformUpdate();
-	}
-}
+#else
 
-const float *WavetableSynthVoice::getTableModulationValues(int startSample, int numSamples)
-{
-	dynamic_cast<WavetableSynth*>(getOwnerSynth())->calculateTableModulationValuesForVoice(voiceIndex, startSample, numSamples);
+	processScalar(destination, lowerTables, upperTables, indexes, alphas, tableDeltas, gainValues, mask, numSamples);
 
-	return dynamic_cast<WavetableSynth*>(getOwnerSynth())->getTableModValues(voiceIndex);
+#endif
 }
 
-void WavetableSynthVoice::stopNote(float velocity, bool allowTailoff)
+void WavetableOscillatorKernel::processScalar(float* destination, const float* const* lowerTables, const float* const* upperTables, const int* indexes, const float* alphas, const float* tableDeltas, const float* gainValues, int mask, int numSamples) noexcept
 {
+	for (int i = 0; i < numSamples; i++)
+	{
+		const int i1 = indexes[i] & mask;
+		const int i2 = (i1 + 1) & mask;
 
-	ModulatorSynthVoice::stopNote(velocity, allowTailoff);
+		const float alpha = alphas[i];
+		const float invAlpha = 1.0f - alpha;
 
-	ModulatorChain *c = static_cast<ModulatorChain*>(getOwnerSynth()->getChildProcessor(WavetableSynth::TableIndexModulation));
+		const float lowerSample = invAlpha * lowerTables[i][i1] + alpha * lowerTables[i][i2];
+		const float upperSample = invAlpha * upperTables[i][i1] + alpha * upperTables[i][i2];
 
-	c->stopVoice(voiceIndex);
-}
+		const float tableDelta = tableDeltas[i];
+		const float invTableDelta = 1.0f - tableDelta;
 
-int WavetableSynthVoice::getSmoothSize() const
-{
-	return wavetableSynth->getMorphSmoothing();
+		destination[i] = (invTableDelta * lowerSample + tableDelta * upperSample) * gainValues[i];
+	}
 }
 
-
-
-WavetableSound::WavetableSound(const ValueTree &wavetableData)
+WavetableSound::WavetableSound(const ValueTree &wavetableData, const ValueTree& mipMapCache)
 {
 	jassert(wavetableData.getType() == Identifier("wavetable"));
 
@@ -357,6 +466,222 @@ WavetableSound::WavetableSound(const ValueTree &wavetableData)
 	normalizeTables();
 
 	pitchRatio = 1.0;
+
+	dataHash = getDataHash(wavetableData);
+
+	if (!restoreMipMaps(mipMapCache))
+		calculateMipMaps();
+}
+
+String WavetableSound::getDataHash(const ValueTree& wavetableData)
+{
+	if (auto mb = wavetableData.getProperty("data", var::undefined()).getBinaryData())
+		return MD5(mb->getData(), mb->getSize()).toHexString();
+
+	return String();
+}
+
+const float* WavetableSound::getMipMapData(int level, int wavetableIndex) const
+{
+	jassert(isPositiveAndBelow(level, numMipMapLevels));
+
+	if (wavetableIndex < wavetableAmount)
+	{
+		return mipMaps.getReadPointer(0, mipMapOffsets[level] + wavetableIndex * mipMapSizes[level]);
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+int WavetableSound::getMipMapLevel(double uptimeDelta) const
+{
+	// Every level halves the bandwidth, so it can be played back one octave higher
+	int level = 0;
+	double maxUptimeDelta = 1.0;
+
+	while (maxUptimeDelta < uptimeDelta && level < numMipMapLevels - 1)
+	{
+		maxUptimeDelta *= 2.0;
+		level++;
+	}
+
+	return level;
+}
+
+int WavetableSound::initMipMapLevels(int numLevels)
+{
+	jassert(isPositiveAndBelow(numLevels - 1, MaxNumMipMapLevels));
+
+	numMipMapLevels = jlimit<int>(1, MaxNumMipMapLevels, numLevels);
+
+	const int fullSize = jmax<int>(4, nextPowerOfTwo(wavetableSize));
+	const int minimumSize = jmin<int>(fullSize, MinimumMipMapSize);
+
+	int numSamples = 0;
+
+	for (int level = 0; level < numMipMapLevels; level++)
+	{
+		// The upper octave is removed in every level, so half the size is enough to store the remaining harmonics
+		mipMapSizes[level] = jmax<int>(minimumSize, fullSize >> level);
+		mipMapOffsets[level] = numSamples;
+
+		numSamples += wavetableAmount * mipMapSizes[level];
+	}
+
+	return numSamples;
+}
+
+void WavetableSound::calculateMipMaps()
+{
+	// The harmonic at the Nyquist frequency of an even sized table is omitted because its phase is ambiguous
+	const int numHarmonics = jmax<int>(1, (wavetableSize - 1) / 2);
+
+	int numLevels = 1;
+
+	while ((numHarmonics >> numLevels) > 0)
+		numLevels++;
+
+	mipMaps.setSize(1, initMipMapLevels(numLevels));
+
+	const int mipMapSize = mipMapSizes[0];
+	const int numBins = mipMapSize / 2 + 1;
+
+	HeapBlock<float> re(numBins);
+	HeapBlock<float> im(numBins);
+	HeapBlock<float> spectrumRe(numHarmonics + 1);
+	HeapBlock<float> spectrumIm(numHarmonics + 1);
+
+	OwnedArray<audiofft::AudioFFT> ffts;
+
+	for (int level = 0; level < numMipMapLevels; level++)
+	{
+		auto fft = ffts.add(new audiofft::AudioFFT());
+		fft->init((size_t)mipMapSizes[level]);
+	}
+
+	// The tables are resampled to a power of two size, so the original spectrum needs a DFT for other sizes
+	const bool useFFTForAnalysis = wavetableSize == mipMapSize;
+
+	HeapBlock<double> cosTable;
+	HeapBlock<double> sinTable;
+
+	if (!useFFTForAnalysis)
+	{
+		cosTable.malloc(wavetableSize);
+		sinTable.malloc(wavetableSize);
+
+		for (int i = 0; i < wavetableSize; i++)
+		{
+			const double phase = 2.0 * double_Pi * (double)i / (double)wavetableSize;
+
+			cosTable[i] = std::cos(phase);
+			sinTable[i] = std::sin(phase);
+		}
+	}
+
+	for (int t = 0; t < wavetableAmount; t++)
+	{
+		const float* data = getWaveTableData(t);
+
+		if (useFFTForAnalysis)
+		{
+			ffts[0]->fft(data, re, im);
+
+			FloatVectorOperations::copy(spectrumRe, re, numHarmonics + 1);
+			FloatVectorOperations::copy(spectrumIm, im, numHarmonics + 1);
+		}
+		else
+		{
+			for (int k = 0; k <= numHarmonics; k++)
+			{
+				double sumRe = 0.0;
+				double sumIm = 0.0;
+				int phaseIndex = 0;
+
+				for (int i = 0; i < wavetableSize; i++)
+				{
+					sumRe += (double)data[i] * cosTable[phaseIndex];
+					sumIm -= (double)data[i] * sinTable[phaseIndex];
+
+					phaseIndex += k;
+
+					if (phaseIndex >= wavetableSize)
+						phaseIndex -= wavetableSize;
+				}
+
+				spectrumRe[k] = (float)sumRe;
+				spectrumIm[k] = (float)sumIm;
+			}
+		}
+
+		for (int level = 0; level < numMipMapLevels; level++)
+		{
+			const int numHarmonicsInLevel = numHarmonics >> level;
+			const int levelSize = mipMapSizes[level];
+
+			jassert(numHarmonicsInLevel < levelSize / 2);
+
+			// The inverse FFT divides by its size, so this keeps the amplitude of the original table
+			const float resampleFactor = (float)levelSize / (float)wavetableSize;
+
+			FloatVectorOperations::clear(re, levelSize / 2 + 1);
+			FloatVectorOperations::clear(im, levelSize / 2 + 1);
+
+			FloatVectorOperations::copyWithMultiply(re, spectrumRe, resampleFactor, numHarmonicsInLevel + 1);
+			FloatVectorOperations::copyWithMultiply(im, spectrumIm, resampleFactor, numHarmonicsInLevel + 1);
+
+			ffts[level]->ifft(mipMaps.getWritePointer(0, mipMapOffsets[level] + t * levelSize), re, im);
+		}
+	}
+}
+
+ValueTree WavetableSound::exportMipMaps() const
+{
+	ValueTree v("mipmap");
+
+	v.setProperty("hash", dataHash, nullptr);
+	v.setProperty("size", mipMapSizes[0], nullptr);
+	v.setProperty("minimumSize", mipMapSizes[numMipMapLevels - 1], nullptr);
+	v.setProperty("levels", numMipMapLevels, nullptr);
+
+	MemoryBlock mb(mipMaps.getReadPointer(0), sizeof(float) * (size_t)mipMaps.getNumSamples());
+
+	v.setProperty("data", var(mb), nullptr);
+
+	return v;
+}
+
+bool WavetableSound::restoreMipMaps(const ValueTree& mipMapCache)
+{
+	if (!mipMapCache.isValid() || mipMapCache.getProperty("hash").toString() != dataHash)
+		return false;
+
+	const int cachedSize = mipMapCache.getProperty("size", 0);
+	const int cachedMinimumSize = mipMapCache.getProperty("minimumSize", 0);
+	const int cachedLevels = mipMapCache.getProperty("levels", 0);
+
+	auto mb = mipMapCache.getProperty("data").getBinaryData();
+
+	if (mb == nullptr || !isPositiveAndBelow(cachedLevels - 1, MaxNumMipMapLevels))
+		return false;
+
+	const int numSamples = initMipMapLevels(cachedLevels);
+
+	// Caches with a different layout (eg. from a version that didn't shrink the levels) will be recalculated
+	if (cachedSize != mipMapSizes[0] || cachedMinimumSize != mipMapSizes[numMipMapLevels - 1] ||
+		mb->getSize() != sizeof(float) * (size_t)numSamples)
+	{
+		numMipMapLevels = 0;
+		return false;
+	}
+
+	mipMaps.setSize(1, numSamples);
+
+	FloatVectorOperations::copy(mipMaps.getWritePointer(0), static_cast<const float*>(mb->getData()), numSamples);
+
+	return true;
 }
 
 const float * WavetableSound::getWaveTableData(int wavetableIndex) const
@@ -41,6 +41,26 @@ namespace hise { using namespace juce;
 
 class WavetableSynth;
 
+/** The inner loop of the wavetable oscillator.
+*
+*	For every sample it interpolates between two adjacent samples of two adjacent wavetables and applies a gain factor.
+*	The tables must have a power of two size so that the index can be wrapped with a bit mask.
+*	The SSE version processes four samples per iteration and produces the same output as the scalar code.
+*/
+struct WavetableOscillatorKernel
+{
+	/** Renders numSamples into destination.
+	*
+	*	@param lowerTables, upperTables	the two tables that are crossfaded with tableDeltas.
+	*	@param indexes					the (unwrapped) integer read positions.
+	*	@param alphas					the fractional part of the read positions.
+	*/
+	static void process(float* destination, const float* const* lowerTables, const float* const* upperTables, const int* indexes, const float* alphas, const float* tableDeltas, const float* gainValues, int mask, int numSamples) noexcept;
+
+	/** The scalar version of process(). */
+	static void processScalar(float* destination, const float* const* lowerTables, const float* const* upperTables, const int* indexes, const float* alphas, const float* tableDeltas, const float* gainValues, int mask, int numSamples) noexcept;
+};
+
 class WavetableSound: public ModulatorSynthSound
 {
 public:
@@ -54,8 +74,10 @@ public:
 	*	- 'noteNumber' the noteNumber
 	*	- 'sampleRate' the sample rate
 	*
+	*	If you pass in a mip map cache that was created with exportMipMaps(), the band limited tables will be restored
+	*	from there instead of being calculated.
 	*/
-	WavetableSound(const ValueTree &wavetableData);;
+	WavetableSound(const ValueTree &wavetableData, const ValueTree& mipMapCache=ValueTree());
 
 	bool appliesToNote (int midiNoteNumber) override   { return midiNotes[midiNoteNumber]; }
     bool appliesToChannel (int /*midiChannel*/) override   { return true; }
@@ -100,8 +122,58 @@ public:
 		return unnormalizedGainValues[tableIndex];
 	}
 
+	/** Returns a hash of the wavetable data that is used to identify the mip map cache. */
+	static String getDataHash(const ValueTree& wavetableData);
+
+	/** Returns the band limited copy of the wavetable with the given index.
+	*
+	*	Level 0 contains all harmonics of the original table and every following level removes the upper octave.
+	*	The tables of each level are resampled to getMipMapSize(level), so you have to scale the read position accordingly.
+	*/
+	const float* getMipMapData(int level, int wavetableIndex) const;
+
+	/** Returns the lowest mip map level that can be played back with the given uptime delta without aliasing. */
+	int getMipMapLevel(double uptimeDelta) const;
+
+	/** Returns the size of the band limited tables of the given level. 
+	*
+	*	This is always a power of two. Every level has half the size of the previous level until it reaches MinimumMipMapSize.
+	*/
+	int getMipMapSize(int level) const 
+	{ 
+		jassert(isPositiveAndBelow(level, numMipMapLevels));
+		return mipMapSizes[level]; 
+	}
+
+	int getNumMipMapLevels() const { return numMipMapLevels; }
+
+	/** Exports the band limited tables so that they don't need to be recalculated the next time. */
+	ValueTree exportMipMaps() const;
+
 private:
 
+	/** The higher levels are not shrinked below this size so that the linear interpolation stays accurate. */
+	static constexpr int MinimumMipMapSize = 64;
+
+	static constexpr int MaxNumMipMapLevels = 32;
+
+	/** Creates the band limited tables by removing the harmonics of the upper octaves in the frequency domain. */
+	void calculateMipMaps();
+
+	bool restoreMipMaps(const ValueTree& mipMapCache);
+
+	/** Calculates the size and position of every level and returns the number of samples for all levels. */
+	int initMipMapLevels(int numLevels);
+
+	String dataHash;
+
+	/** The tables of all levels. The tables of one level are stored next to each other. */
+	AudioSampleBuffer mipMaps;
+
+	int mipMapSizes[MaxNumMipMapLevels];
+	int mipMapOffsets[MaxNumMipMapLevels];
+	int numMipMapLevels = 0;
+
 	float maximum;
 	float unnormalizedMaximum;
 	float unnormalizedGainValues[64];
@@ -142,7 +214,7 @@ public:
 		currentSound = static_cast<WavetableSound*>(s);
         voiceUptime = 0.0;
         
-		lowerTable = currentSound->getWaveTableData(0);
+		lowerTable = currentSound->getMipMapData(0, 0);
 		upperTable = lowerTable;
 
 		nextTable = lowerTable;
@@ -151,7 +223,7 @@ public:
 		currentTableIndex = 0;
 
 		tableSize = currentSound->getTableSize();
-		smoothSize = tableSize;
+		smoothSize = currentSound->getMipMapSize(0);
 		uptimeDelta = currentSound->getPitchRatio();
         uptimeDelta *= getOwnerSynth()->getMainController()->getGlobalPitchFactor();
     };
@@ -172,21 +244,17 @@ public:
 	void setHqMode(bool useHqMode)
 	{
 		hqMode = useHqMode;
-
-		if(hqMode)
-		{
-			lowerTable = currentTable;
-			nextTable = upperTable;
-		}
-		{
-			currentTable = lowerTable;
-			nextTable = upperTable;
-		}
-
 	};
 
 private:
 
+	void calculateHqBlock(const float* voicePitchValues, const float* tableValues, int startSample, int numSamples, int mipMapLevel);
+
+	void calculateSmoothedBlock(const float* voicePitchValues, const float* tableValues, int startSample, int numSamples, int mipMapLevel);
+
+	/** The number of samples that are prepared on the stack for the oscillator kernel. */
+	static constexpr int KernelChunkSize = 64;
+
 	WavetableSynth *wavetableSynth;
 
 	int octaveTransposeFactor;
@@ -248,24 +316,12 @@ public:
 
 	WavetableSynth(MainController *mc, const String &id, int numVoices);;
 
-	void loadWaveTable(const ValueTree& v)
-	{
-		clearSounds();
-        
-		jassert(v.isValid());
-        
-		for(int i = 0; i < v.getNumChildren(); i++)
-		{
-			auto s = new WavetableSound(v.getChild(i));
-
-			s->calculatePitchRatio(getSampleRate());
-
-			addSound(s);
-		}
-        
-		
-
-	}
+	/** Loads the wavetables from the given ValueTree.
+	*
+	*	If you supply a cache file, the band limited tables will be read from this file and written back
+	*	if they had to be recalculated.
+	*/
+	void loadWaveTable(const ValueTree& v, const File& mipMapCacheFile=File());
 
 	int getNumSliderPacks() const override
 	{
@@ -294,6 +350,15 @@ public:
 		return pack->getValue(index);
 	}
 
+	/** Same as getGainValueFromTable() but without updating the slider pack display. */
+	float getGainValueFromTableSilently(float level) const
+	{
+		int index = roundToInt((float)pack->getNumSliders() * level);
+		index = jlimit<int>(0, 127, index);
+
+		return pack->getValue(index);
+	}
+
 	
 	void restoreFromValueTree(const ValueTree &v) override
 	{
@@ -514,7 +579,7 @@ public:
 
 			ValueTree v = ValueTree::readFromStream(fis);
 
-			loadWaveTable(v);
+			loadWaveTable(v, wavetables[index-1].withFileExtension("hwm"));
 		}
 		else
 		{
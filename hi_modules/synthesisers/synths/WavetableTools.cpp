@@ -187,12 +187,11 @@ struct ResynthesisHelpers
 	{
 		
 
-#if USE_IPP
-		if (pitch != 0.0)
-		{
-			int size = buffer.getNumSamples();
+		int size = buffer.getNumSamples();
 
-			IppFFT fft(IppFFT::DataType::RealFloat, 16);
+		if (pitch != 0.0 && size >= 4 && isPowerOfTwo(size))
+		{
+			HiseFFT fft(size);
 
 			float* dl = (float*)alloca(sizeof(float)*size);
 			float* dr = (float*)alloca(sizeof(float)*size);
@@ -220,8 +219,8 @@ struct ResynthesisHelpers
 			FloatVectorOperations::multiply(dl, w, size);
 			FloatVectorOperations::multiply(dr, w, size);
 
-			fft.realFFTInplace(dl, size);
-			fft.realFFTInplace(dr, size);
+			fft.realFFTInplace(dl);
+			fft.realFFTInplace(dr);
 
 			float* magL = (float*)alloca(sizeof(float)*size / 2);
 			float* magR = (float*)alloca(sizeof(float)*size / 2);
@@ -289,9 +288,6 @@ struct ResynthesisHelpers
 		{
 			return false;
 		}
-#else
-		return false;
-#endif
 	}
 
 	static int getWavetableLength(int noteNumber, double sampleRate)
@@ -84,6 +84,9 @@ SET_DOCUMENTATION(ModulatorSampler)
 
     ADD_PARAMETER_DOC(UseStaticMatrix,
         "If this is true, then the routing matrix will not be resized when you load a sample map with another mic position amount.");
+
+	ADD_PARAMETER_DOC(Interpolation,
+		"The interpolation algorithm for pitched samples: `0` = Linear, `1` = Hermite (4-point), `2` = Sinc (16-point). The higher modes alias less but need more CPU.");
     
 	ADD_CHAIN_DOC(SampleStartModulation, "Sample Start", 
 		"Allows modification of the sample start if the sound allows this. The modulation range is depending on the *SampleStartMod* value of each sample.");
@@ -117,7 +120,8 @@ numChannels(1),
 deactivateUIUpdate(false),
 samplePreloadPending(false),
 temporaryVoiceBuffer(true, 2, 0),
-samplePropertyUpdater(this)
+samplePropertyUpdater(this),
+lookupIndexUpdater(this)
 {
 #if USE_BACKEND
 	sampleEditHandler = new SampleEditHandler(this);
@@ -141,6 +145,7 @@ samplePropertyUpdater(this)
 	parameterNames.add("Purged");
 	parameterNames.add("Reversed");
     parameterNames.add("UseStaticMatrix");
+	parameterNames.add("Interpolation");
 
 	editorStateIdentifiers.add("SampleStartChainShown");
 	editorStateIdentifiers.add("SettingsShown");
@@ -183,6 +188,8 @@ samplePropertyUpdater(this)
 
 ModulatorSampler::~ModulatorSampler()
 {
+	lookupIndexUpdater.stopTimer();
+
 	sampleMap = nullptr;
 	deleteAllSounds();
 }
@@ -210,6 +217,19 @@ void ModulatorSampler::refreshRRMap()
 	}
 }
 
+void ModulatorSampler::setInterpolationMode(SampleInterpolators::Mode newMode)
+{
+	if (interpolationMode != newMode)
+	{
+		interpolationMode = newMode;
+
+		for (auto i = 0; i < getNumVoices(); i++)
+		{
+			static_cast<ModulatorSamplerVoice*>(getVoice(i))->setInterpolationMode(newMode);
+		}
+	}
+}
+
 void ModulatorSampler::setReversed(bool shouldBeReversed)
 {
     if (reversed != shouldBeReversed)
@@ -333,6 +353,7 @@ void ModulatorSampler::restoreFromValueTree(const ValueTree &v)
 	setVoiceAmount(v.getProperty("VoiceAmount", voiceAmount));
 	
 	loadAttribute(Reversed, "Reversed");
+	loadAttribute(Interpolation, "Interpolation");
 
 	loadAttribute(SamplerRepeatMode, "SamplerRepeatMode");
 	loadAttribute(Purged, "Purged");
@@ -366,6 +387,7 @@ ValueTree ModulatorSampler::exportAsValueTree() const
 	saveAttribute(Reversed, "Reversed");
 	v.setProperty("NumChannels", numChannels, nullptr);
     saveAttribute(UseStaticMatrix, "UseStaticMatrix");
+	saveAttribute(Interpolation, "Interpolation");
 
 	ValueTree channels("channels");
 
@@ -407,6 +429,7 @@ float ModulatorSampler::getAttribute(int parameterIndex) const
 	case Purged:			return purged ? 1.0f : 0.0f;
 	case Reversed:			return reversed ? 1.0f : 0.0f;
     case UseStaticMatrix:   return useStaticMatrix ? 1.0f : 0.0f;
+	case Interpolation:		return (float)interpolationMode;
 	default:				jassertfalse; return -1.0f;
 	}
 }
@@ -437,6 +460,7 @@ void ModulatorSampler::setInternalAttribute(int parameterIndex, float newValue)
 	case CrossfadeGroups:	crossfadeGroups = newValue > 0.5f; refreshCrossfadeTables(); break;
 	case Purged:			purgeAllSamples(newValue > 0.5f); break;
 	case UseStaticMatrix:   setUseStaticMatrix(newValue > 0.5f); break;
+	case Interpolation:		setInterpolationMode((SampleInterpolators::Mode)jlimit<int>(0, SampleInterpolators::numModes - 1, (int)newValue)); break;
 	default:				jassertfalse; break;
 	}
 }
@@ -484,12 +508,35 @@ void ModulatorSampler::prepareToPlay(double newSampleRate, int samplesPerBlock)
 		ProcessorHelpers::increaseBufferIfNeeded(crossfadeBuffer, samplesPerBlock);
 
 		StreamingSamplerVoice::initTemporaryVoiceBuffer(&temporaryVoiceBuffer, samplesPerBlock);
+		StreamingSamplerVoice::initInterpolationBuffer(&interpolationBuffer, samplesPerBlock);
+
+		prepareWorkerBuffers(samplesPerBlock);
 
 		sampleStartChain->prepareToPlay(newSampleRate, samplesPerBlock);
 		crossFadeChain->prepareToPlay(newSampleRate, samplesPerBlock);
 	}
 }
 
+void ModulatorSampler::prepareWorkerBuffers(int samplesPerBlock)
+{
+	if (samplesPerBlock <= 0)
+		return;
+
+	const int numWorkerThreads = getMainController()->getRealtimeWorkerPool().getNumThreads() - 1;
+
+	while (workerTemporaryVoiceBuffers.size() < numWorkerThreads)
+		workerTemporaryVoiceBuffers.add(new hlac::HiseSampleBuffer(temporaryVoiceBuffer.isFloatingPoint(), 2, 0));
+
+	while (workerInterpolationBuffers.size() < numWorkerThreads)
+		workerInterpolationBuffers.add(new AudioSampleBuffer(2, 0));
+
+	for (int i = 0; i < numWorkerThreads; i++)
+	{
+		StreamingSamplerVoice::initTemporaryVoiceBuffer(workerTemporaryVoiceBuffers[i], samplesPerBlock);
+		StreamingSamplerVoice::initInterpolationBuffer(workerInterpolationBuffers[i], samplesPerBlock);
+	}
+}
+
 ProcessorEditorBody* ModulatorSampler::createEditor(ProcessorEditor *parentEditor)
 {
 #if USE_BACKEND
@@ -557,6 +604,10 @@ void ModulatorSampler::deleteSound(ModulatorSamplerSound *s)
 	}
 
 	s->removeAllChangeListeners();
+	s->setMappingRevisionCounter(nullptr);
+
+	// The index keeps a reference to the sound
+	setLookupIndex(nullptr);
 
 	const int deletedIndex = s->getProperty(ModulatorSamplerSound::ID);
 
@@ -583,8 +634,14 @@ void ModulatorSampler::deleteAllSounds()
 		static_cast<ModulatorSamplerVoice*>(getVoice(i))->resetVoice();
 	}
 
+	setLookupIndex(nullptr);
+
 	if(getNumSounds() != 0)
 	{
+		// The sounds might outlive the sampler (eg. in the undo history)
+		for (auto s : sounds)
+			static_cast<ModulatorSamplerSound*>(s)->setMappingRevisionCounter(nullptr);
+
 		clearSounds();
 
 		getMainController()->getSampleManager().getModulatorSamplerSoundPool()->clearUnreferencedMonoliths();
@@ -644,6 +701,10 @@ void ModulatorSampler::refreshMemoryUsage()
 
 		StreamingSamplerVoice::initTemporaryVoiceBuffer(&temporaryVoiceBuffer, getBlockSize());
 
+		workerTemporaryVoiceBuffers.clear();
+		workerInterpolationBuffers.clear();
+		prepareWorkerBuffers(getBlockSize());
+
 		for (auto i = 0; i < getNumVoices(); i++)
 		{
 			static_cast<ModulatorSamplerVoice*>(getVoice(i))->setStreamingBufferDataType(temporaryBufferShouldBeFloatingPoint);
@@ -674,7 +735,16 @@ void ModulatorSampler::refreshMemoryUsage()
 		(sampleMap->isMonolith() ? 2 : 4) *  // bytes per sample
 		2 * numChannels;				// number of channels
 
-	memoryUsage = actualPreloadSize + streamBufferSizePerVoice * getNumVoices();
+	// The scratch buffers of the RealtimeWorkerPool threads
+	int64 workerBufferSize = 0;
+
+	for (auto b : workerTemporaryVoiceBuffers)
+		workerBufferSize += (int64)b->getNumSamples() * b->getNumChannels() * (b->isFloatingPoint() ? 4 : 2);
+
+	for (auto b : workerInterpolationBuffers)
+		workerBufferSize += (int64)b->getNumSamples() * b->getNumChannels() * (int64)sizeof(float);
+
+	memoryUsage = actualPreloadSize + streamBufferSizePerVoice * getNumVoices() + workerBufferSize;
 
 	sendChangeMessage();
 	getMainController()->getSampleManager().getModulatorSamplerSoundPool()->sendChangeMessage();
@@ -720,6 +790,7 @@ void ModulatorSampler::setVoiceAmountInternal()
 			}
 
 			dynamic_cast<ModulatorSamplerVoice*>(voices.getLast())->setStreamingBufferDataType(temporaryVoiceBuffer.isFloatingPoint());
+			dynamic_cast<ModulatorSamplerVoice*>(voices.getLast())->setInterpolationMode(interpolationMode);
 
 			if (Processor::getSampleRate() != -1.0)
 			{
@@ -893,6 +964,7 @@ ModulatorSamplerSound* ModulatorSampler::addSamplerSound(const ValueTree &descri
 
 	if (newSound != nullptr)
 	{
+		newSound->setMappingRevisionCounter(&mappingRevision);
 		newSound->restoreFromValueTree(description);
 
 		sounds.add(newSound);
@@ -923,6 +995,7 @@ void ModulatorSampler::addSamplerSounds(OwnedArray<ModulatorSamplerSound>& monol
 	{
 		ModulatorSamplerSound* newSound = monolithicSounds.removeAndReturn(0);
 
+		newSound->setMappingRevisionCounter(&mappingRevision);
 		sounds.add(newSound);
 
 		newSound->setPurged(purged);
@@ -1006,6 +1079,60 @@ bool ModulatorSampler::soundCanBePlayed(ModulatorSynthSound *sound, int midiChan
 	return true;
 }
 
+const Array<ModulatorSynthSound*>* ModulatorSampler::getSoundsForNoteOn(const HiseEvent& m)
+{
+	if (lookupIndex == nullptr || !lookupIndex->isUpToDate(mappingRevision.load(), sounds.size(), rrGroupAmount, crossfadeGroups))
+		return nullptr;
+
+	// Use the same velocity conversion as ModulatorSynth::soundCanBePlayed()
+	const int velocity = (int)(m.getFloatVelocity() * 127);
+
+	return &lookupIndex->getSounds(m.getNoteNumber() + m.getTransposeAmount(), velocity, currentRRGroupIndex);
+}
+
+void ModulatorSampler::rebuildLookupIndex()
+{
+	// Don't block the message thread while samples are loaded, it will be tried again later
+	ScopedTryLock sl(getMainController()->getSampleManager().getSamplerSoundLock());
+
+	if (!sl.isLocked())
+		return;
+
+	// Read the revision first so that a change while the index is built triggers another rebuild
+	const uint32 revision = mappingRevision.load();
+
+	// The sample editor changes the sound array while holding the audio lock
+	ReferenceCountedArray<SynthesiserSound> soundList;
+
+	{
+		ScopedLock audioLock(getMainController()->getLock());
+		soundList = sounds;
+	}
+
+	setLookupIndex(new SampleLookupIndex(soundList, revision, rrGroupAmount, crossfadeGroups));
+}
+
+void ModulatorSampler::setLookupIndex(SampleLookupIndex* newIndex)
+{
+	ScopedPointer<SampleLookupIndex> oldIndex = newIndex;
+
+	{
+		ScopedLock sl(getMainController()->getLock());
+		lookupIndex.swapWith(oldIndex);
+	}
+}
+
+void ModulatorSampler::LookupIndexUpdater::timerCallback()
+{
+	if (sampler->sampleMapLoadingPending)
+		return;
+
+	auto index = sampler->lookupIndex.get();
+
+	if (index == nullptr || !index->isUpToDate(sampler->mappingRevision.load(), sampler->sounds.size(), sampler->rrGroupAmount, sampler->crossfadeGroups))
+		sampler->rebuildLookupIndex();
+}
+
 void ModulatorSampler::handleRetriggeredNote(ModulatorSynthVoice *voice)
 {
 	switch (repeatMode)
@@ -1308,46 +1435,54 @@ bool ModulatorSampler::preloadAllSamples()
 
 	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
 
-	while (auto sound = sIter.getNextSound())
+	if (auto preloadPool = getMainController()->getSampleManager().getPreloadThreadPool())
 	{
-		if (threadPool->threadShouldExit())
+		if (!preloadAllSamplesInParallel(preloadPool, preloadSizeToUse))
 			return false;
-
-		sound->checkFileReference();
-
-		if (getNumMicPositions() == 1)
+	}
+	else
+	{
+		while (auto sound = sIter.getNextSound())
 		{
-			auto s = sound->getReferenceToSound();
+			if (threadPool->threadShouldExit())
+				return false;
 
-			progress = (double)currentIndex++ / (double)numToLoad;
+			sound->checkFileReference();
 
-			if (!preloadSample(s, preloadSizeToUse))
-				return false;
-		}
-		else
-		{
-			for (int j = 0; j < getNumMicPositions(); j++)
+			if (getNumMicPositions() == 1)
 			{
-				const bool isEnabled = getChannelData(j).enabled;
-
-				auto s = sound->getReferenceToSound(j);
+				auto s = sound->getReferenceToSound();
 
 				progress = (double)currentIndex++ / (double)numToLoad;
 
-				if (s != nullptr)
+				if (!preloadSample(s, preloadSizeToUse))
+					return false;
+			}
+			else
+			{
+				for (int j = 0; j < getNumMicPositions(); j++)
 				{
-					if (isEnabled)
+					const bool isEnabled = getChannelData(j).enabled;
+
+					auto s = sound->getReferenceToSound(j);
+
+					progress = (double)currentIndex++ / (double)numToLoad;
+
+					if (s != nullptr)
 					{
-						if (!preloadSample(s, preloadSizeToUse))
-							return false;
+						if (isEnabled)
+						{
+							if (!preloadSample(s, preloadSizeToUse))
+								return false;
+						}
+						else
+							s->setPurged(true);
 					}
-					else
-						s->setPurged(true);
 				}
 			}
-		}
 
-		sound->setReversed(isReversed);
+			sound->setReversed(isReversed);
+		}
 	}
 
 	refreshMemoryUsage();
@@ -1359,6 +1494,77 @@ bool ModulatorSampler::preloadAllSamples()
 }
 
 
+bool ModulatorSampler::preloadAllSamplesInParallel(ThreadPool* preloadPool, const int preloadSizeToUse)
+{
+	const bool isReversed = getAttribute(ModulatorSampler::Reversed) > 0.5f;
+
+	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
+
+	// The caller holds the sampler sound lock, so the sounds stay alive without a reference here.
+	ModulatorSampler::SoundIterator sIter(this, false);
+
+	Array<ModulatorSamplerSound*> samplerSounds;
+	Array<StreamingSamplerSound*> soundsToPreload;
+
+	samplerSounds.ensureStorageAllocated(sounds.size());
+	soundsToPreload.ensureStorageAllocated(sounds.size() * getNumMicPositions());
+
+	while (auto sound = sIter.getNextSound())
+	{
+		if (threadPool->threadShouldExit())
+			return false;
+
+		sound->checkFileReference();
+
+		samplerSounds.add(sound.get());
+
+		for (int j = 0; j < getNumMicPositions(); j++)
+		{
+			if (auto s = sound->getReferenceToSound(j))
+			{
+				if (getNumMicPositions() == 1 || getChannelData(j).enabled)
+					soundsToPreload.add(s);
+				else
+					s->setPurged(true);
+			}
+		}
+	}
+
+	// A sound can be used multiple times if it was reused from the pool, but it must not be loaded by two threads at once.
+	soundsToPreload.sort();
+
+	for (int i = soundsToPreload.size() - 1; i > 0; i--)
+	{
+		if (soundsToPreload.getUnchecked(i) == soundsToPreload.getUnchecked(i - 1))
+			soundsToPreload.remove(i);
+	}
+
+	String errorMessage;
+
+	auto& progress = getMainController()->getSampleManager().getPreloadProgress();
+
+	if (!StreamingHelpers::preloadSamplesInParallel(preloadPool, soundsToPreload, preloadSizeToUse, progress, threadPool, errorMessage))
+	{
+		if (errorMessage.isNotEmpty())
+		{
+			getMainController()->getDebugLogger().logMessage(errorMessage);
+
+#if USE_FRONTEND
+			getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, errorMessage);
+#else
+			debugError(this, errorMessage);
+#endif
+		}
+
+		return false;
+	}
+
+	for (auto sound : samplerSounds)
+		sound->setReversed(isReversed);
+
+	return true;
+}
+
 bool ModulatorSampler::preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse)
 {
 	jassert(s != nullptr);
@@ -151,6 +151,7 @@ public:
 		Purged, 
 		Reversed,
         UseStaticMatrix,
+		Interpolation,
 		numModulatorSamplerParameters
 	};
 
@@ -306,6 +307,12 @@ public:
 	void preVoiceRendering(int startSample, int numThisTime) override;
 	void soundsChanged() {};
 	bool soundCanBePlayed(ModulatorSynthSound *sound, int midiChannel, int midiNoteNumber, float velocity) override;;
+
+	/** Returns the candidates from the SampleLookupIndex or nullptr if the index is not up to date. */
+	const Array<ModulatorSynthSound*>* getSoundsForNoteOn(const HiseEvent& m) override;
+
+	/** Rebuilds the SampleLookupIndex. This is called periodically on the message thread when the mapping has changed. */
+	void rebuildLookupIndex();
 	void handleRetriggeredNote(ModulatorSynthVoice *voice) override;
 
 	/** Overwrites the base class method and ignores the note off event if Parameters::OneShot is enabled. */
@@ -333,6 +340,9 @@ public:
 
 	bool preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse);
 
+	/** Opens the files and fills the preload buffers of all sounds using the given thread pool. */
+	bool preloadAllSamplesInParallel(ThreadPool* preloadPool, const int preloadSizeToUse);
+
 	void saveSampleMap() const;
 
 	void saveSampleMapAs();
@@ -536,7 +546,22 @@ public:
 		return saveString;
 	}
 
-	hlac::HiseSampleBuffer* getTemporaryVoiceBuffer() { return &temporaryVoiceBuffer; }
+	/** Returns the scratch buffer for the streaming voices. Every thread of the RealtimeWorkerPool has its own buffer. */
+	hlac::HiseSampleBuffer* getTemporaryVoiceBuffer(int threadIndex=0) 
+	{ 
+		return threadIndex == 0 ? &temporaryVoiceBuffer : workerTemporaryVoiceBuffers[threadIndex - 1]; 
+	}
+
+	AudioSampleBuffer* getInterpolationBuffer(int threadIndex=0) 
+	{ 
+		return threadIndex == 0 ? &interpolationBuffer : workerInterpolationBuffers[threadIndex - 1]; 
+	}
+
+	bool supportsParallelVoiceRendering() const override { return true; }
+
+	SampleInterpolators::Mode getInterpolationMode() const noexcept { return interpolationMode; }
+
+	void setInterpolationMode(SampleInterpolators::Mode newMode);
 
 	bool checkAndLogIsSoftBypassed(DebugLogger::Location location) const;
 
@@ -616,6 +641,21 @@ private:
 	
 
 
+	struct LookupIndexUpdater : public Timer
+	{
+		LookupIndexUpdater(ModulatorSampler* s) :
+			sampler(s)
+		{
+			startTimer(300);
+		};
+
+		void timerCallback() override;
+
+	private:
+
+		ModulatorSampler* sampler;
+	};
+
 	struct AsyncPurger : public AsyncUpdater,
 						 public Timer
 	{
@@ -650,6 +690,16 @@ private:
 
 	RoundRobinMap roundRobinMap;
 
+	/** Swaps in the new index while holding the audio lock and deletes the old one afterwards. */
+	void setLookupIndex(SampleLookupIndex* newIndex);
+
+	ScopedPointer<SampleLookupIndex> lookupIndex;
+
+	/** Increased by the sounds of this sampler whenever their mapping changes. */
+	std::atomic<uint32> mappingRevision { 0 };
+
+	LookupIndexUpdater lookupIndexUpdater;
+
 	bool reversed = false;
 
 	bool useGlobalFolder;
@@ -684,6 +734,15 @@ private:
 
 	hlac::HiseSampleBuffer temporaryVoiceBuffer;
 
+	AudioSampleBuffer interpolationBuffer;
+
+	void prepareWorkerBuffers(int samplesPerBlock);
+
+	OwnedArray<hlac::HiseSampleBuffer> workerTemporaryVoiceBuffers;
+	OwnedArray<AudioSampleBuffer> workerInterpolationBuffers;
+
+	SampleInterpolators::Mode interpolationMode = SampleInterpolators::Linear;
+
 	float groupGainValues[8];
 
 	ChannelData channelData[NUM_MIC_POSITIONS];
@@ -763,6 +763,101 @@ int RoundRobinMap::getRRGroupsForMessage(int noteNumber, int velocity)
 	
 }
 
+SampleLookupIndex::SampleLookupIndex(const ReferenceCountedArray<SynthesiserSound>& sounds, uint32 mappingRevision_, int numGroups_, bool ignoreGroups_) :
+	soundReferences(sounds),
+	mappingRevision(mappingRevision_),
+	numGroups(numGroups_),
+	ignoreGroups(ignoreGroups_)
+{
+	const int numSlots = 128 * (ignoreGroups ? 1 : numGroups + 1);
+
+	Array<SoundList> candidates;
+	candidates.insertMultiple(0, SoundList(), numSlots);
+
+	for (int i = 0; i < soundReferences.size(); i++)
+	{
+		auto sound = static_cast<ModulatorSamplerSound*>(soundReferences.getUnchecked(i).get());
+
+		const int group = ignoreGroups ? 0 : sound->getRRGroup();
+
+		if (!isPositiveAndNotGreaterThan(group, ignoreGroups ? 0 : numGroups))
+			continue;
+
+		const auto noteRange = sound->getNoteRange().getIntersectionWith(Range<int>(0, 128));
+
+		for (int n = noteRange.getStart(); n < noteRange.getEnd(); n++)
+			candidates.getReference(group * 128 + n).add(sound);
+	}
+
+	zones.insertMultiple(0, ZoneList(), numSlots);
+
+	for (int i = 0; i < numSlots; i++)
+	{
+		const auto& list = candidates.getReference(i);
+
+		if (list.isEmpty())
+			continue;
+
+		// Split the velocity range at every start and end of a sound's velocity range
+		SortedSet<int> boundaries;
+
+		for (auto s : list)
+		{
+			const auto r = static_cast<ModulatorSamplerSound*>(s)->getVelocityRange().getIntersectionWith(Range<int>(0, 128));
+
+			if (!r.isEmpty())
+			{
+				boundaries.add(r.getStart());
+				boundaries.add(r.getEnd());
+			}
+		}
+
+		auto& zoneList = zones.getReference(i);
+
+		for (int j = 0; j < boundaries.size() - 1; j++)
+		{
+			VelocityZone z;
+			z.velocityRange = Range<int>(boundaries[j], boundaries[j + 1]);
+
+			for (auto s : list)
+			{
+				if (static_cast<ModulatorSamplerSound*>(s)->getVelocityRange().contains(z.velocityRange.getStart()))
+					z.sounds.add(s);
+			}
+
+			if (!z.sounds.isEmpty())
+				zoneList.add(z);
+		}
+	}
+}
+
+const SampleLookupIndex::SoundList& SampleLookupIndex::getSounds(int noteNumber, int velocity, int group) const noexcept
+{
+	if (ignoreGroups)
+		group = 0;
+	else if (!isPositiveAndNotGreaterThan(group, numGroups))
+		return emptyList;
+
+	if (!isPositiveAndBelow(noteNumber, 128))
+		return emptyList;
+
+	for (const auto& z : zones.getReference(group * 128 + noteNumber))
+	{
+		if (z.velocityRange.contains(velocity))
+			return z.sounds;
+	}
+
+	return emptyList;
+}
+
+bool SampleLookupIndex::isUpToDate(uint32 mappingRevision_, int numSounds, int numGroups_, bool ignoreGroups_) const noexcept
+{
+	return mappingRevision == mappingRevision_ &&
+		   soundReferences.size() == numSounds &&
+		   numGroups == numGroups_ &&
+		   ignoreGroups == ignoreGroups_;
+}
+
 MonolithExporter::MonolithExporter(SampleMap* sampleMap_) :
 	DialogWindowWithBackgroundThread("Exporting samples as monolith"),
 	AudioFormatWriter(nullptr, "", 0.0, 0, 1),
@@ -960,7 +1055,14 @@ void MonolithExporter::writeFiles(int channelIndex, bool overwriteExistingData)
 
 		ScopedPointer<AudioFormatWriter> writer = hlac.createWriterFor(hlacOutput, sampleRate, isMono ? 1 : 2, 16, empty, 5);
 
-		dynamic_cast<hlac::HiseLosslessAudioFormatWriter*>(writer.get())->setOptions(options);
+		auto hlacWriter = dynamic_cast<hlac::HiseLosslessAudioFormatWriter*>(writer.get());
+
+		hlacWriter->setOptions(options);
+
+		// The blocks of all samples are independent, so we can encode them on all cores.
+		ThreadPool encoderPool(jmax<int>(1, SystemStats::getNumCpus() - 1));
+
+		hlacWriter->setThreadPool(&encoderPool);
 
 		for (int i = 0; i < channelList->size(); i++)
 		{
@@ -283,6 +283,58 @@ private:
 
 };
 
+/** A lookup table that contains the sounds that can be played by a note on message.
+*
+*	ModulatorSynth::noteOn() would have to check every sound of the sampler, which gets expensive with big sample maps.
+*	This index stores a list of candidates for every notenumber / round robin group combination, split into velocity zones
+*	with the same sounds so that a note on only needs to look at the sounds that are actually mapped to the message.
+*
+*	It is built on the message thread by the ModulatorSampler and swapped in while holding the audio lock.
+*	The candidates are still checked with ModulatorSampler::soundCanBePlayed(), so purged or missing samples can stay in the index.
+*/
+class SampleLookupIndex
+{
+public:
+
+	using SoundList = Array<ModulatorSynthSound*>;
+
+	/** Creates the index for the given sounds.
+	*
+	*	If ignoreGroups is true (eg. if the sampler uses crossfade groups), all sounds are stored in one group.
+	*	The mapping revision is the state of the sampler's counter before the sounds were copied.
+	*/
+	SampleLookupIndex(const ReferenceCountedArray<SynthesiserSound>& sounds, uint32 mappingRevision, int numGroups, bool ignoreGroups);
+
+	/** Returns the sounds for the given message sorted by their index. This doesn't allocate and can be used on the audio thread. */
+	const SoundList& getSounds(int noteNumber, int velocity, int group) const noexcept;
+
+	/** Checks if the index matches the current state of the sampler. */
+	bool isUpToDate(uint32 mappingRevision, int numSounds, int numGroups, bool ignoreGroups) const noexcept;
+
+private:
+
+	struct VelocityZone
+	{
+		Range<int> velocityRange;
+		SoundList sounds;
+	};
+
+	using ZoneList = Array<VelocityZone>;
+
+	/** Keeps the sounds alive as long as the index exists. */
+	ReferenceCountedArray<SynthesiserSound> soundReferences;
+
+	Array<ZoneList> zones;
+
+	SoundList emptyList;
+
+	const uint32 mappingRevision;
+	const int numGroups;
+	const bool ignoreGroups;
+
+	JUCE_DECLARE_NON_COPYABLE(SampleLookupIndex)
+};
+
 
 class MonolithExporter : public DialogWindowWithBackgroundThread,
 						 public AudioFormatWriter
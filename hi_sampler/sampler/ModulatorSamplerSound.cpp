@@ -428,6 +428,8 @@ void ModulatorSamplerSound::setMappingData(MappingData newData)
 	midiNotes.setRange(newData.loKey, newData.hiKey - newData.loKey + 1, true);
 	rrGroup = newData.rrGroup;
 
+	mappingChanged();
+
 	setProperty(SampleStart, newData.sampleStart, dontSendNotification);
 	setProperty(SampleEnd, newData.sampleEnd, dontSendNotification);
 	setProperty(SampleStartMod, newData.sampleStartMod, dontSendNotification);
@@ -660,6 +662,15 @@ void ModulatorSamplerSound::setPropertyInternal(Property p, int newValue)
 	default:			jassertfalse; break;
 	}
 
+	switch (p)
+	{
+	case VeloHigh:
+	case VeloLow:
+	case KeyHigh:
+	case KeyLow:
+	case RRGroup:		mappingChanged(); break;
+	default:			break;
+	}
 }
 
 void ModulatorSamplerSound::setPreloadPropertyInternal(Property p, int newValue)
@@ -783,7 +794,7 @@ bool ModulatorSamplerSoundPool::loadMonolithicData(const ValueTree &sampleMap, c
 		{
 			String fileName = sample.getProperty("FileName").toString().fromFirstOccurrenceOf("{PROJECT_FOLDER}", false, false);
 			StreamingSamplerSound* sound = new StreamingSamplerSound(hmaf, 0, i);
-			pool.add(sound);
+			addToPool(sound);
 			sounds.add(new ModulatorSamplerSound(mc, sound, i));
 		}
 		else
@@ -793,7 +804,7 @@ bool ModulatorSamplerSoundPool::loadMonolithicData(const ValueTree &sampleMap, c
 			for (int j = 0; j < sample.getNumChildren(); j++)
 			{
 				StreamingSamplerSound* sound = new StreamingSamplerSound(hmaf, j, i);
-				pool.add(sound);
+				addToPool(sound);
 				multiMicArray.add(sound);
 			}
 
@@ -826,9 +837,49 @@ void ModulatorSamplerSoundPool::clearUnreferencedSamplesInternal()
 	}
 
 	pool.swapWith(currentList);
+	rebuildPoolIndex();
+
 	if (updatePool) sendChangeMessage();
 }
 
+void ModulatorSamplerSoundPool::rebuildPoolIndex()
+{
+	hashIndex.clear();
+	fileNames.clearQuick();
+	fileNames.ensureStorageAllocated(pool.size());
+
+	for (int i = 0; i < pool.size(); i++)
+	{
+		if (auto s = pool[i].get())
+		{
+			const int64 hash = s->getHashCode();
+
+			if (!hashIndex.contains(hash))
+				hashIndex.set(hash, i);
+
+			fileNames.add(s->getFileName(true));
+		}
+		else
+		{
+			fileNames.add(String());
+		}
+	}
+}
+
+void ModulatorSamplerSoundPool::addToPool(StreamingSamplerSound* s)
+{
+	const int64 hash = s->getHashCode();
+
+	auto existing = hashIndex.contains(hash) ? pool[hashIndex[hash]].get() : nullptr;
+
+	// Only the first living instance will be indexed (this mimics the order of the old linear search).
+	if (existing == nullptr || existing->getHashCode() != hash)
+		hashIndex.set(hash, pool.size());
+
+	pool.add(s);
+	fileNames.add(s->getFileName(true));
+}
+
 
 
 int ModulatorSamplerSoundPool::getNumSoundsInPool() const noexcept
@@ -961,6 +1012,8 @@ public:
 		}
 
 		remainingSounds -= foundThisTime;
+
+		pool->rebuildPoolIndex();
 		
 		showStatusMessage("Replacing references");
 
@@ -1076,9 +1129,12 @@ StringArray ModulatorSamplerSoundPool::getFileNameList() const
 {
 	StringArray sa;
 
+	jassert(fileNames.size() == pool.size());
+
 	for (int i = 0; i < pool.size(); i++)
 	{
-		sa.add(pool[i]->getFileName(true));
+		if (pool[i].get() != nullptr)
+			sa.add(fileNames[i]);
 	}
 
 	return sa;
@@ -1160,18 +1216,27 @@ int ModulatorSamplerSoundPool::getSoundIndexFromPool(int64 hashCode, int64 other
 {
 	if (!searchPool) return -1;
 
-	for (int i = 0; i < pool.size(); i++)
-	{
-		StreamingSamplerSound::Ptr s = pool[i].get();
-		
-		if (s == nullptr)
-			return -1;
+	const int index = getIndexForHashCode(hashCode);
 
-		if (s->getHashCode() == hashCode) return i;
+	if (index != -1 || otherPossibleHashCode == -1)
+		return index;
 
-		if (otherPossibleHashCode != -1 && s->getHashCode() == otherPossibleHashCode)
-			return i;
-	}
+	return getIndexForHashCode(otherPossibleHashCode);
+}
+
+int ModulatorSamplerSoundPool::getIndexForHashCode(int64 hashCode) const
+{
+	if (!hashIndex.contains(hashCode))
+		return -1;
+
+	const int index = hashIndex[hashCode];
+
+	StreamingSamplerSound::Ptr s = pool[index].get();
+
+	// If the indexed sound was deleted since the last cleanup, it will be treated as not found
+	// (a scan for another instance would make switching sample maps quadratic again).
+	if (s != nullptr && s->getHashCode() == hashCode)
+		return index;
 
 	return -1;
 }
@@ -1226,7 +1291,7 @@ ModulatorSamplerSound * ModulatorSamplerSoundPool::addSoundWithSingleMic(const V
         
 		StreamingSamplerSound::Ptr s = new StreamingSamplerSound(fileName, this);
 
-		pool.add(s.get());
+		addToPool(s.get());
 
 		if(updatePool) sendChangeMessage();
 
@@ -1279,7 +1344,7 @@ ModulatorSamplerSound * ModulatorSamplerSoundPool::addSoundWithMultiMic(const Va
 					StreamingSamplerSound::Ptr s = new StreamingSamplerSound(fileName, this);
 
 					multiMicArray.add(s);
-					pool.add(s.get());
+					addToPool(s.get());
 					continue;
 				}
             }
@@ -1288,7 +1353,7 @@ ModulatorSamplerSound * ModulatorSamplerSoundPool::addSoundWithMultiMic(const Va
 				StreamingSamplerSound::Ptr s = new StreamingSamplerSound(fileName, this);
 
 				multiMicArray.add(s);
-				pool.add(s.get());
+				addToPool(s.get());
 			}
 		}
 	}
@@ -280,7 +280,7 @@ public:
 	// ====================================================================================================================
 
 	void setMaxRRGroupIndex(int newGroupLimit);
-	void setRRGroup(int newGroupIndex) noexcept{ rrGroup = jmin(newGroupIndex, maxRRGroup); };
+	void setRRGroup(int newGroupIndex) noexcept{ rrGroup = jmin(newGroupIndex, maxRRGroup); mappingChanged(); };
 	int getRRGroup() const;
 
 	// ====================================================================================================================
@@ -300,6 +300,12 @@ public:
 	/** This sets the MIDI related properties without undo / range checks. */
 	void setMappingData(MappingData newData);
 
+	/** Sets the counter of the sampler that owns this sound. It is increased whenever the note / velocity / group mapping of this sound changes.
+	*
+	*	This is used by the SampleLookupIndex to check if it needs to be rebuilt.
+	*/
+	void setMappingRevisionCounter(std::atomic<uint32>* newCounter) noexcept { mappingRevisionCounter = newCounter; }
+
 	/** Calculates the gain value that must be applied to normalize the volume of the sample ( 1.0 / peakValue ).
 	*
 	*	It should save calculated value along with the other properties, but if a new sound is added,
@@ -445,6 +451,10 @@ private:
 
 	bool enableAsyncPropertyChange = true;
 
+	void mappingChanged() noexcept { if (mappingRevisionCounter != nullptr) ++(*mappingRevisionCounter); }
+
+	std::atomic<uint32>* mappingRevisionCounter = nullptr;
+
 	// ================================================================================================================
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModulatorSamplerSound)
@@ -514,6 +524,12 @@ public:
 
 	StringArray getFileNameList() const;
 
+	/** Rebuilds the lookup tables for the sounds in the pool.
+	*
+	*	Call this whenever the file reference of a sound in the pool was changed (eg. after resolving missing samples). 
+	*/
+	void rebuildPoolIndex();
+
 	/** Returns the memory usage for all sounds in the pool.
 	*
 	*	This is not the exact amount of memory usage of the application, because every sampler has voices which have 
@@ -586,6 +602,11 @@ private:
 
 	int getSoundIndexFromPool(int64 hashCode, int64 otherPossibleHashCode);
 
+	int getIndexForHashCode(int64 hashCode) const;
+
+	/** Adds the sound to the pool and updates the lookup tables. */
+	void addToPool(StreamingSamplerSound* s);
+
 	ModulatorSamplerSound *addSoundWithSingleMic(const ValueTree &soundDescription, int index, bool forceReuse = false);
 	ModulatorSamplerSound *addSoundWithMultiMic(const ValueTree &soundDescription, int index, bool forceReuse = false);
 	
@@ -598,6 +619,13 @@ private:
 
 	WeakStreamingSamplerSoundArray pool;
 
+	/** Maps the hash code of every sound in the pool to its first index so that the pool search doesn't
+	*	need to iterate over all sounds (which made loading big sample maps quadratic). */
+	HashMap<int64, int> hashIndex;
+
+	/** The file names of the pool sounds (with the same index). */
+	StringArray fileNames;
+
 	bool isCurrentlyLoading;
 	bool forcePoolSearch;
     bool updatePool;
@@ -605,6 +633,8 @@ private:
     
 	
 
+	friend class SamplePoolUnitTest;
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModulatorSamplerSoundPool)
 };
 
@@ -96,34 +96,54 @@ void ModulatorSamplerVoice::stopNote(float velocity, bool allowTailoff)
 
 void ModulatorSamplerVoice::calculateBlock(int startSample, int numSamples)
 {
-    const StreamingSamplerSound *sound = wrappedVoice.getLoadedSound();
-    jassert(sound != nullptr);
- 
+	ADD_GLITCH_DETECTOR(getOwnerSynth(), DebugLogger::Location::SampleRendering);
+
+	prepareBlockForParallelRendering(startSample, numSamples);
+	calculateBlockOnWorkerThread(0, startSample, numSamples);
+	finishBlockAfterParallelRendering(startSample, numSamples);
+}
+
+void ModulatorSamplerVoice::prepareBlockForParallelRendering(int startSample, int numSamples)
+{
+	const StreamingSamplerSound *sound = wrappedVoice.getLoadedSound();
+	jassert(sound != nullptr);
+
 	CHECK_AND_LOG_ASSERTION(getOwnerSynth(), DebugLogger::Location::SampleRendering, sound != nullptr, 1);
 
-	ADD_GLITCH_DETECTOR(getOwnerSynth(), DebugLogger::Location::SampleRendering);
- 
 	ignoreUnused(sound);
 
-	const int startIndex = startSample;
-	const int samplesInBlock = numSamples;
-
 	float *voicePitchValues = isPitchModulationActive() ? getVoicePitchValues() : nullptr;
 	const double propertyPitch = currentlyPlayingSamplerSound->getPropertyPitch();
 	
 	const double pitchCounter = limitPitchDataToMaxSamplerPitch(voicePitchValues, uptimeDelta * propertyPitch, startSample, numSamples);
 	
-	const float *modValues = getVoiceGainValues(startSample, numSamples);
+	blockGainValues = getVoiceGainValues(startSample, numSamples);
 
 	wrappedVoice.setPitchCounterForThisBlock(pitchCounter);
 	wrappedVoice.setPitchValues(voicePitchValues);
 	wrappedVoice.setDynamicPitchFactor(propertyPitch);
 
 	voiceBuffer.clear();
+}
 
-	
+void ModulatorSamplerVoice::calculateBlockOnWorkerThread(int threadIndex, int startSample, int numSamples)
+{
+	wrappedVoice.setTemporaryVoiceBuffer(sampler->getTemporaryVoiceBuffer(threadIndex));
+	wrappedVoice.setInterpolationBuffer(sampler->getInterpolationBuffer(threadIndex));
 
 	wrappedVoice.renderNextBlock(voiceBuffer, startSample, numSamples);
+}
+
+void ModulatorSamplerVoice::finishBlockAfterParallelRendering(int startSample, int numSamples)
+{
+	const StreamingSamplerSound *sound = wrappedVoice.getLoadedSound();
+
+	ignoreUnused(sound);
+
+	const int startIndex = startSample;
+	const int samplesInBlock = numSamples;
+
+	const float *modValues = blockGainValues;
 
 	CHECK_AND_LOG_BUFFER_DATA(getOwnerSynth(), DebugLogger::Location::SampleRendering, voiceBuffer.getReadPointer(0, startSample), true, samplesInBlock);
 	CHECK_AND_LOG_BUFFER_DATA(getOwnerSynth(), DebugLogger::Location::SampleRendering, voiceBuffer.getReadPointer(1, startSample), false, samplesInBlock);
@@ -252,6 +272,11 @@ void ModulatorSamplerVoice::setStreamingBufferDataType(bool shouldBeFloat)
 	wrappedVoice.loader.setStreamingBufferDataType(shouldBeFloat);
 }
 
+void ModulatorSamplerVoice::setInterpolationMode(SampleInterpolators::Mode newMode)
+{
+	wrappedVoice.setInterpolationMode(newMode);
+}
+
 const float * ModulatorSamplerVoice::getCrossfadeModulationValues(int startSample, int numSamples)
 {
 
@@ -280,6 +305,7 @@ sampler(dynamic_cast<ModulatorSampler*>(ownerSynth)),
 wrappedVoice(sampler->getBackgroundThreadPool())
 {
 	wrappedVoice.setTemporaryVoiceBuffer(static_cast<ModulatorSampler*>(ownerSynth)->getTemporaryVoiceBuffer());
+	wrappedVoice.setInterpolationBuffer(static_cast<ModulatorSampler*>(ownerSynth)->getInterpolationBuffer());
 	
 	wrappedVoice.setDebugLogger(&ownerSynth->getMainController()->getDebugLogger());
 };
@@ -297,6 +323,7 @@ ModulatorSamplerVoice(ownerSynth)
 		wrappedVoices.getLast()->prepareToPlay(getOwnerSynth()->getSampleRate(), getOwnerSynth()->getBlockSize());
 		wrappedVoices.getLast()->setLoaderBufferSize((int)getOwnerSynth()->getAttribute(ModulatorSampler::BufferSize));
 		wrappedVoices.getLast()->setTemporaryVoiceBuffer(static_cast<ModulatorSampler*>(ownerSynth)->getTemporaryVoiceBuffer());
+		wrappedVoices.getLast()->setInterpolationBuffer(static_cast<ModulatorSampler*>(ownerSynth)->getInterpolationBuffer());
 		wrappedVoices.getLast()->setDebugLogger(&ownerSynth->getMainController()->getDebugLogger());
 	}
 }
@@ -347,17 +374,25 @@ void MultiMicModulatorSamplerVoice::calculateBlock(int startSample, int numSampl
 {
 	ADD_GLITCH_DETECTOR(getOwnerSynth(), DebugLogger::Location::MultiMicSampleRendering);
 
-	const int startIndex = startSample;
-	const int samplesInBlock = numSamples;
+	prepareBlockForParallelRendering(startSample, numSamples);
+	calculateBlockOnWorkerThread(0, startSample, numSamples);
+	finishBlockAfterParallelRendering(startSample, numSamples);
+}
+
+void MultiMicModulatorSamplerVoice::prepareBlockForParallelRendering(int startSample, int numSamples)
+{
+	jassert(wrappedVoices.size() <= 32);
 
 	float *voicePitchValues = isPitchModulationActive() ? getVoicePitchValues() : nullptr;
 	const double propertyPitch = (float)currentlyPlayingSamplerSound->getPropertyPitch();
 	const double pitchCounter = limitPitchDataToMaxSamplerPitch(voicePitchValues, uptimeDelta * propertyPitch, startSample, numSamples);
 
-	const float *modValues = getVoiceGainValues(startSample, numSamples);
+	blockGainValues = getVoiceGainValues(startSample, numSamples);
 
 	voiceBuffer.clear();
 
+	micPositionsToRender = 0;
+
 	for (int i = 0; i < wrappedVoices.size(); i++)
 	{
 		const StreamingSamplerSound *sound = wrappedVoices[i]->getLoadedSound();
@@ -368,22 +403,63 @@ void MultiMicModulatorSamplerVoice::calculateBlock(int startSample, int numSampl
 		wrappedVoices[i]->setPitchCounterForThisBlock(pitchCounter);
 		wrappedVoices[i]->uptimeDelta = uptimeDelta * propertyPitch;
 
+		micPositionsToRender |= (1u << i);
+	}
+}
+
+void MultiMicModulatorSamplerVoice::calculateBlockOnWorkerThread(int threadIndex, int startSample, int numSamples)
+{
+	auto temporaryBuffer = sampler->getTemporaryVoiceBuffer(threadIndex);
+	auto interpolationBuffer = sampler->getInterpolationBuffer(threadIndex);
+
+	for (int i = 0; i < wrappedVoices.size(); i++)
+	{
+		if ((micPositionsToRender & (1u << i)) == 0) continue;
+
 		float *leftChannel = voiceBuffer.getWritePointer(2*i);
 		float *rightChannel = voiceBuffer.getWritePointer(2*i + 1);
 		float *channels[2] = { leftChannel, rightChannel };
 
 		AudioSampleBuffer channelBuffer(channels, 2, voiceBuffer.getNumSamples());
 
+		wrappedVoices[i]->setTemporaryVoiceBuffer(temporaryBuffer);
+		wrappedVoices[i]->setInterpolationBuffer(interpolationBuffer);
 		wrappedVoices[i]->renderNextBlock(channelBuffer, startSample, numSamples);
+	}
+}
+
+void MultiMicModulatorSamplerVoice::finishBlockAfterParallelRendering(int startSample, int numSamples)
+{
+	const int startIndex = startSample;
+	const int samplesInBlock = numSamples;
+
+	const float *modValues = blockGainValues;
+
+	for (int i = 0; i < wrappedVoices.size(); i++)
+	{
+		if ((micPositionsToRender & (1u << i)) == 0) continue;
 
 		voiceUptime = wrappedVoices[i]->voiceUptime;
 
 		if (!wrappedVoices[i]->isActive)
 		{
 			resetVoice();
+
+			// The sequential rendering stops after the voice was reset, so the remaining mic positions must be silent
+			for (int j = i + 1; j < wrappedVoices.size(); j++)
+			{
+				if ((micPositionsToRender & (1u << j)) == 0) continue;
+
+				voiceBuffer.clear(2 * j, startIndex, samplesInBlock);
+				voiceBuffer.clear(2 * j + 1, startIndex, samplesInBlock);
+			}
+
+			break;
 		}
 	}
 
+	micPositionsToRender = 0;
+
 	getOwnerSynth()->effectChain->renderVoice(voiceIndex, voiceBuffer, startIndex, samplesInBlock);
 	
 	const float propertyGain = currentlyPlayingSamplerSound->getPropertyVolume();
@@ -483,6 +559,14 @@ void MultiMicModulatorSamplerVoice::setStreamingBufferDataType(bool shouldBeFloa
 	}
 }
 
+void MultiMicModulatorSamplerVoice::setInterpolationMode(SampleInterpolators::Mode newMode)
+{
+	for (int i = 0; i < wrappedVoices.size(); i++)
+	{
+		wrappedVoices[i]->setInterpolationMode(newMode);
+	}
+}
+
 void MultiMicModulatorSamplerVoice::resetVoice()
 {
 	sampler->resetNoteDisplay(this->getCurrentlyPlayingNote());
@@ -61,6 +61,10 @@ public:
 	void calculateBlock(int startSample, int numSamples) override;
 	void resetVoice() override;
 
+	void prepareBlockForParallelRendering(int startSample, int numSamples) override;
+	void calculateBlockOnWorkerThread(int threadIndex, int startSample, int numSamples) override;
+	void finishBlockAfterParallelRendering(int startSample, int numSamples) override;
+
 	void handlePlaybackPosition(const StreamingSamplerSound * sound);
 
 	static double limitPitchDataToMaxSamplerPitch(float * pitchData, double uptimeDelta, int startSample, int numSamples);
@@ -73,6 +77,8 @@ public:
 
 	virtual void setStreamingBufferDataType(bool shouldBeFloat);
 
+	virtual void setInterpolationMode(SampleInterpolators::Mode newMode);
+
 	// ================================================================================================================
 
 	const float *getCrossfadeModulationValues(int startSample, int numSamples);
@@ -99,6 +105,9 @@ protected:
 	float velocityXFadeValue;
 	float sampleStartModValue;
 
+	/** The gain values of the current block (they are calculated before the voice is rendered). */
+	const float* blockGainValues = nullptr;
+
 	// ================================================================================================================
 
 private:
@@ -132,6 +141,10 @@ public:
 	void calculateBlock(int startSample, int numSamples) override;
 	void prepareToPlay(double sampleRate, int samplesPerBlock);
 
+	void prepareBlockForParallelRendering(int startSample, int numSamples) override;
+	void calculateBlockOnWorkerThread(int threadIndex, int startSample, int numSamples) override;
+	void finishBlockAfterParallelRendering(int startSample, int numSamples) override;
+
 	// ================================================================================================================
 
 	void setLoaderBufferSize(int newBufferSize) override;
@@ -140,6 +153,8 @@ public:
 
 	void setStreamingBufferDataType(bool shouldBeFloat) override;
 
+	void setInterpolationMode(SampleInterpolators::Mode newMode) override;
+
 	/** Resets the display value for the current note. */
 	void resetVoice() override;
 
@@ -148,6 +163,9 @@ private:
 
 	OwnedArray<StreamingSamplerVoice> wrappedVoices;
 
+	/** A bit mask of the mic positions that have a loaded sound in the current block. */
+	uint32 micPositionsToRender = 0;
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiMicModulatorSamplerVoice)
 };
 
@@ -0,0 +1,289 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class SamplePoolUnitTest : public UnitTest
+{
+public:
+
+	SamplePoolUnitTest() :
+		UnitTest("Testing the sample pool")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testPoolIndex();
+		testSampleMapSwitch(10000);
+		testSampleMapSwitch(50000);
+	}
+
+private:
+
+	using SoundList = ReferenceCountedArray<StreamingSamplerSound>;
+
+	static StringArray createFileNames(int numSamples, int offset)
+	{
+		StringArray sa;
+		sa.ensureStorageAllocated(numSamples);
+
+		File root = File::getSpecialLocation(File::tempDirectory).getChildFile("SamplePoolTest");
+
+		for (int i = 0; i < numSamples; i++)
+			sa.add(root.getChildFile("Sample_" + String(i + offset) + ".wav").getFullPathName());
+
+		return sa;
+	}
+
+	/** Does the same pool search as ModulatorSamplerSoundPool::addSoundWithSingleMic(). */
+	static SoundList loadSampleMap(ModulatorSamplerSoundPool& pool, const StringArray& fileNames, int& numReused)
+	{
+		SoundList list;
+		list.ensureStorageAllocated(fileNames.size());
+
+		for (const auto& fileName : fileNames)
+		{
+			const int i = pool.getSoundIndexFromPool(fileName.hashCode64(), -1);
+
+			if (i != -1)
+			{
+				list.add(pool.pool[i].get());
+				numReused++;
+			}
+			else
+			{
+				StreamingSamplerSound::Ptr s = new StreamingSamplerSound(fileName, &pool);
+				pool.addToPool(s.get());
+				list.add(s);
+			}
+		}
+
+		return list;
+	}
+
+	void testPoolIndex()
+	{
+		beginTest("Testing the pool index");
+
+		ModulatorSamplerSoundPool pool(nullptr);
+
+		auto fileNames = createFileNames(100, 0);
+
+		int numReused = 0;
+
+		auto list = loadSampleMap(pool, fileNames, numReused);
+
+		expectEquals<int>(numReused, 0, "No reused samples in an empty pool");
+		expectEquals<int>(pool.getNumSoundsInPool(), 100, "Pool size");
+
+		for (int i = 0; i < fileNames.size(); i++)
+			expectEquals<int>(pool.getSoundIndexFromPool(fileNames[i].hashCode64(), -1), i, "Index lookup");
+
+		expectEquals<int>(pool.getSoundIndexFromPool(-1, fileNames[42].hashCode64()), 42, "Lookup with the second hash code");
+
+		auto secondList = loadSampleMap(pool, fileNames, numReused);
+
+		expectEquals<int>(numReused, 100, "All samples are reused");
+		expectEquals<int>(pool.getNumSoundsInPool(), 100, "Pool size after reusing");
+
+		list.removeRange(0, 50);
+		secondList.removeRange(0, 50);
+
+		expectEquals<int>(pool.getSoundIndexFromPool(fileNames[10].hashCode64(), -1), -1, "Deleted sound is not found");
+		expectEquals<int>(pool.getFileNameList().size(), 50, "File name list skips deleted sounds");
+
+		pool.clearUnreferencedSamplesInternal();
+
+		expectEquals<int>(pool.getNumSoundsInPool(), 50, "Pool size after cleanup");
+		expectEquals<int>(pool.getSoundIndexFromPool(fileNames[60].hashCode64(), -1), 10, "Index after cleanup");
+		expectEquals<String>(pool.getFileNameList()[0], fileNames[50], "File name list after cleanup");
+
+		numReused = 0;
+		auto thirdList = loadSampleMap(pool, fileNames, numReused);
+
+		expectEquals<int>(numReused, 50, "Only the living sounds are reused");
+		expectEquals<int>(pool.getSoundIndexFromPool(fileNames[10].hashCode64(), -1), 60, "Reloaded sound is indexed");
+	}
+
+	/** Loads a sample map with the given amount of samples and switches to another one that shares half of its samples. */
+	void testSampleMapSwitch(int numSamples)
+	{
+		beginTest("Benchmarking sample map switch with " + String(numSamples) + " samples");
+
+		ModulatorSamplerSoundPool pool(nullptr);
+
+		auto firstMap = createFileNames(numSamples, 0);
+		auto secondMap = createFileNames(numSamples, numSamples / 2);
+
+		int numReused = 0;
+
+		double start = Time::getMillisecondCounterHiRes();
+
+		auto currentSounds = loadSampleMap(pool, firstMap, numReused);
+
+		const double loadTime = Time::getMillisecondCounterHiRes() - start;
+
+		start = Time::getMillisecondCounterHiRes();
+
+		auto newSounds = loadSampleMap(pool, secondMap, numReused);
+		currentSounds.swapWith(newSounds);
+		newSounds.clear();
+		pool.clearUnreferencedSamplesInternal();
+
+		const double switchTime = Time::getMillisecondCounterHiRes() - start;
+
+		expectEquals<int>(numReused, numSamples - numSamples / 2, "Shared samples are reused");
+		expectEquals<int>(pool.getNumSoundsInPool(), numSamples, "Pool size after switching");
+
+		logMessage("Loading " + String(numSamples) + " samples: " + String(loadTime, 1) + " ms");
+		logMessage("Switching sample map: " + String(switchTime, 1) + " ms");
+	}
+};
+
+static SamplePoolUnitTest samplePoolUnitTest;
+
+
+class SampleLookupIndexUnitTest : public UnitTest
+{
+public:
+
+	SampleLookupIndexUnitTest() :
+		UnitTest("Testing the sample lookup index")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testReplaceAllSounds();
+	}
+
+private:
+
+	/** Creates sounds that are mapped to the given key without loading any files. */
+	static void createSounds(ModulatorSampler* sampler, OwnedArray<ModulatorSamplerSound>& sounds, int numSounds, int noteNumber)
+	{
+		auto pool = sampler->getMainController()->getSampleManager().getModulatorSamplerSoundPool();
+		auto root = File::getSpecialLocation(File::tempDirectory).getChildFile("SampleLookupIndexTest");
+
+		for (int i = 0; i < numSounds; i++)
+		{
+			auto fileName = root.getChildFile("Sample_" + String(noteNumber) + "_" + String(i) + ".wav").getFullPathName();
+
+			auto s = new ModulatorSamplerSound(sampler->getMainController(), new StreamingSamplerSound(fileName, pool), i);
+
+			s->setProperty(ModulatorSamplerSound::KeyLow, noteNumber, dontSendNotification);
+			s->setProperty(ModulatorSamplerSound::KeyHigh, noteNumber, dontSendNotification);
+			s->setProperty(ModulatorSamplerSound::VeloLow, 0, dontSendNotification);
+			s->setProperty(ModulatorSamplerSound::VeloHigh, 127, dontSendNotification);
+
+			sounds.add(s);
+		}
+	}
+
+	static int getNumSoundsForNote(ModulatorSampler* sampler, int noteNumber)
+	{
+		auto list = sampler->getSoundsForNoteOn(HiseEvent(HiseEvent::Type::NoteOn, (uint8)noteNumber, 100, 1));
+
+		return list != nullptr ? list->size() : -1;
+	}
+
+	/** Replaces all sounds the same way as the multimic merge and extraction actions of the sample editor. */
+	void testReplaceAllSounds()
+	{
+		beginTest("Testing the index after replacing all sounds");
+
+		ScopedPointer<UnitTestAudioProcessor> p = new UnitTestAudioProcessor();
+
+		auto sampler = new ModulatorSampler(p, "Sampler", 8);
+		p->addSynth(sampler);
+
+		OwnedArray<ModulatorSamplerSound> firstSounds;
+		createSounds(sampler, firstSounds, 4, 60);
+
+		ModulatorSamplerSound::Ptr oldSound = firstSounds.getFirst();
+
+		sampler->addSamplerSounds(firstSounds);
+		sampler->rebuildLookupIndex();
+
+		expectEquals<int>(getNumSoundsForNote(sampler, 60), 4, "Index contains the initial sounds");
+
+		sampler->deleteAllSounds();
+
+		expectEquals<int>(sampler->getNumSounds(), 0, "All sounds are removed");
+		expectEquals<int>(getNumSoundsForNote(sampler, 60), -1, "Index is cleared");
+
+		OwnedArray<ModulatorSamplerSound> secondSounds;
+		createSounds(sampler, secondSounds, 2, 72);
+
+		ModulatorSamplerSound::Ptr newSound = secondSounds.getFirst();
+
+		sampler->addSamplerSounds(secondSounds);
+
+		expectEquals<int>(getNumSoundsForNote(sampler, 72), -1, "No index before the rebuild");
+
+		sampler->rebuildLookupIndex();
+
+		expectEquals<int>(getNumSoundsForNote(sampler, 60), 0, "Removed sounds are not in the index");
+		expectEquals<int>(getNumSoundsForNote(sampler, 72), 2, "Index contains the new sounds");
+
+		oldSound->setProperty(ModulatorSamplerSound::KeyLow, 72, dontSendNotification);
+
+		expectEquals<int>(getNumSoundsForNote(sampler, 72), 2, "Removed sounds don't invalidate the index");
+
+		newSound->setProperty(ModulatorSamplerSound::KeyLow, 71, dontSendNotification);
+
+		expectEquals<int>(getNumSoundsForNote(sampler, 72), -1, "Mapping changes of the new sounds invalidate the index");
+
+		sampler->rebuildLookupIndex();
+
+		expectEquals<int>(getNumSoundsForNote(sampler, 71), 1, "Rebuilt index contains the changed mapping");
+
+		oldSound = nullptr;
+		newSound = nullptr;
+	}
+};
+
+static SampleLookupIndexUnitTest sampleLookupIndexUnitTest;
+
+} // namespace hise
+
+#endif
@@ -201,7 +201,7 @@ void SampleEditHandler::SampleEditingActions::checkMicPositionAmountBeforePastin
 		}
 		else if (PresetHandler::showYesNoWindow("Different mic amount detected.", "Do you want to replace all existing samples in this sampler?"))
 		{
-			s->clearSounds();
+			s->deleteAllSounds();
 
 			s->setNumChannels(numMics);
 
@@ -449,11 +449,7 @@ public:
 
 		sampler->setBypassed(true);
 
-		ScopedLock sl(sampler->getMainController()->getLock());
-
-		sampler->clearSounds();
-
-		sampler->setNumMicPositions(channelNames);
+		OwnedArray<ModulatorSamplerSound> newSounds;
 
 		for (int i = 0; i < collections.size(); i++)
 		{
@@ -463,12 +459,17 @@ public:
 
 			s->setMappingData(c->mappingData);
 
-			sampler->addSound(s);
-
-			s->setUndoManager(sampler->getUndoManager());
-			s->addChangeListener(sampler->getSampleMap());
+			newSounds.add(s);
 		}
 
+		// This takes the sampler sound lock, so it must be called before the audio lock
+		sampler->deleteAllSounds();
+
+		ScopedLock sl(sampler->getMainController()->getLock());
+
+		sampler->setNumMicPositions(channelNames);
+		sampler->addSamplerSounds(newSounds);
+
 		sampler->setBypassed(false);
 
 
@@ -921,14 +922,7 @@ void SampleEditHandler::SampleEditingActions::extractToSingleMicSamples(SampleEd
 
 		jassert(singleList.size() == singleData.size());
 
-		ScopedLock sl(sampler->getMainController()->getLock());
-
-		sampler->clearSounds();
-
-		StringArray channels;
-		channels.add("SingleMic");
-
-		sampler->setNumMicPositions(channels);
+		OwnedArray<ModulatorSamplerSound> newSounds;
 
 		for (int i = 0; i < singleList.size(); i++)
 		{
@@ -936,12 +930,20 @@ void SampleEditHandler::SampleEditingActions::extractToSingleMicSamples(SampleEd
 
 			s->setMappingData(singleData[i]);
 
-			sampler->addSound(s);
-
-			s->setUndoManager(sampler->getUndoManager());
-			s->addChangeListener(sampler->getSampleMap());
+			newSounds.add(s);
 		}
 
+		// This takes the sampler sound lock, so it must be called before the audio lock
+		sampler->deleteAllSounds();
+
+		ScopedLock sl(sampler->getMainController()->getLock());
+
+		StringArray channels;
+		channels.add("SingleMic");
+
+		sampler->setNumMicPositions(channels);
+		sampler->addSamplerSounds(newSounds);
+
 		sampler->setBypassed(false);
 
 		sampler->sendChangeMessage();
@@ -649,12 +649,14 @@ void SamplerSettings::labelTextChanged (Label* labelThatHasChanged)
     {
         //[UserLabelCode_bufferSizeEditor] -- add your label text handling code here..
 		sampler->setAttribute(ModulatorSampler::BufferSize, labelThatHasChanged->getText().getFloatValue(), dontSendNotification);
+		sampler->getBackgroundThreadPool()->resetDeadlineStatistics();
         //[/UserLabelCode_bufferSizeEditor]
     }
     else if (labelThatHasChanged == preloadBufferEditor)
     {
         //[UserLabelCode_preloadBufferEditor] -- add your label text handling code here..
 		sampler->setAttribute(ModulatorSampler::PreloadSize, labelThatHasChanged->getText().getFloatValue(), dontSendNotification);
+		sampler->getBackgroundThreadPool()->resetDeadlineStatistics();
         //[/UserLabelCode_preloadBufferEditor]
     }
     else if (labelThatHasChanged == voiceAmountEditor)
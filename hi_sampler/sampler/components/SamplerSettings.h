@@ -53,6 +53,16 @@ public:
 	{
 		const double usage = sampler->getDiskUsage();
 		diskSlider->setValue(usage, dontSendNotification);
+
+		const auto stats = sampler->getBackgroundThreadPool()->getDeadlineStatistics();
+
+		String tooltip;
+		tooltip << "Streaming jobs: " << stats.numJobs;
+		tooltip << ", near misses: " << stats.numNearMisses;
+		tooltip << ", dropouts: " << stats.numMissedDeadlines;
+		tooltip << ", min. slack: " << String(stats.minimumSlack * 1000.0, 1) << "ms";
+
+		diskSlider->setTooltip(tooltip);
 	}
 
 	int getPanelHeight() const
@@ -400,6 +400,14 @@ void JavascriptProcessor::setCallStackEnabled(bool shouldBeEnabled)
 		scriptEngine->setCallStackEnabled(shouldBeEnabled);
 }
 
+void JavascriptProcessor::setAudioThreadSafeMode(bool shouldBeEnabled)
+{
+	audioThreadSafeMode = shouldBeEnabled;
+
+	if (scriptEngine != nullptr)
+		scriptEngine->setAudioThreadSafeMode(shouldBeEnabled);
+}
+
 ValueTree FileChangeListener::collectAllScriptFiles(ModulatorSynthChain *chainToExport)
 {
 	Processor::Iterator<JavascriptProcessor> iter(chainToExport);
@@ -500,7 +508,8 @@ scriptEngine(new HiseJavascriptEngine(this)),
 lastCompileWasOK(false),
 currentCompileThread(nullptr),
 lastResult(Result::ok()),
-callStackEnabled(mc->isCallStackEnabled())
+callStackEnabled(mc->isCallStackEnabled()),
+audioThreadSafeMode(mc->isAudioThreadSafeModeEnabled())
 {
 	allInterfaceData = ValueTree("UIData");
 	auto defaultContent = ValueTree("ContentProperties");
@@ -738,6 +747,7 @@ void JavascriptProcessor::setupApi()
 	scriptEngine->addBreakpointListener(this);
 
 	scriptEngine->setCallStackEnabled(callStackEnabled);
+	scriptEngine->setAudioThreadSafeMode(audioThreadSafeMode);
 
 	scriptEngine->maximumExecutionTime = RelativeTime(mainController->getCompileTimeOut());
 
@@ -488,6 +488,11 @@ public:
 
 	void setCallStackEnabled(bool shouldBeEnabled);
 
+	/** Enables the allocation free execution of the audio thread callbacks (see HiseSettings::Scripting::EnableAudioThreadSafeMode). */
+	void setAudioThreadSafeMode(bool shouldBeEnabled);
+
+	bool isAudioThreadSafeModeEnabled() const noexcept { return audioThreadSafeMode; }
+
 	void addBreakpointListener(HiseJavascriptEngine::Breakpoint::Listener* newListener)
 	{
 		breakpointListeners.addIfNotAlreadyThere(newListener);
@@ -600,6 +605,8 @@ private:
 
 	bool callStackEnabled = false;
 
+	bool audioThreadSafeMode = false;
+
 	bool cycleReferenceCheckEnabled = false;
 
 	
@@ -199,6 +199,42 @@ void JavascriptMidiProcessor::registerApiClasses()
     scriptEngine->registerNativeObject("Libraries", new DspFactory::LibraryLoader(this));
     scriptEngine->registerNativeObject("Buffer", new VariantBuffer::Factory(64));
     
+	lastAllocationCallback = -1;
+	lastAllocationCharIndex = -1;
+}
+
+void JavascriptMidiProcessor::executeAudioThreadCallback(int callbackIndex, DebugLogger::Location location)
+{
+	const bool checkAllocations = isAudioThreadSafeModeEnabled() && !isDeferred();
+
+	if (!checkAllocations)
+	{
+		scriptEngine->executeCallback(callbackIndex, &lastResult);
+		return;
+	}
+
+	scriptEngine->startAllocationCheck();
+	scriptEngine->executeCallback(callbackIndex, &lastResult);
+
+	HiseJavascriptEngine::RootObject::Error e;
+
+	const int numAllocations = scriptEngine->stopAllocationCheck(e);
+
+	if (numAllocations == 0)
+		return;
+
+	// Only report a new location, otherwise every event would flood the console
+	if (callbackIndex == lastAllocationCallback && e.charIndex == lastAllocationCharIndex)
+		return;
+
+	lastAllocationCallback = callbackIndex;
+	lastAllocationCharIndex = e.charIndex;
+
+	const Identifier& callbackName = getSnippet(callbackIndex)->getCallbackName();
+
+	getMainController()->getDebugLogger().addScriptAllocation(this, location, callbackName, e.lineNumber);
+
+	BACKEND_ONLY(debugError(this, callbackName.toString() + "() allocated " + String(numAllocations) + " time(s) on the audio thread. " + e.getLocationString() + ": " + e.errorMessage + " " + e.getEncodedLocation(this)));
 }
 
 
@@ -221,7 +257,7 @@ void JavascriptMidiProcessor::runScriptCallbacks()
 
 		if (onNoteOnCallback->isSnippetEmpty()) return;
 
-		scriptEngine->executeCallback(onNoteOn, &lastResult);
+		executeAudioThreadCallback(onNoteOn, DebugLogger::Location::NoteOnCallback);
 
 		BACKEND_ONLY(if (!lastResult.wasOk()) debugError(this, lastResult.getErrorMessage()));
 
@@ -233,7 +269,7 @@ void JavascriptMidiProcessor::runScriptCallbacks()
 
 		if (onNoteOffCallback->isSnippetEmpty()) return;
 
-		scriptEngine->executeCallback(onNoteOff, &lastResult);
+		executeAudioThreadCallback(onNoteOff, DebugLogger::Location::NoteOffCallback);
 
 		BACKEND_ONLY(if (!lastResult.wasOk()) debugError(this, lastResult.getErrorMessage()));
 
@@ -255,7 +291,7 @@ void JavascriptMidiProcessor::runScriptCallbacks()
 		if (currentEvent->isAllNotesOff()) return;
 
 		Result r = Result::ok();
-		scriptEngine->executeCallback(onController, &lastResult);
+		executeAudioThreadCallback(onController, DebugLogger::Location::ScriptMidiEventCallback);
 
 		BACKEND_ONLY(if (!lastResult.wasOk()) debugError(this, lastResult.getErrorMessage()));
 		break;
@@ -323,7 +359,7 @@ void JavascriptMidiProcessor::runTimerCallback(int /*offsetInBuffer*//*=-1*/)
 
 	if (lastResult.failed()) return;
 
-	scriptEngine->executeCallback(onTimer, &lastResult);
+	executeAudioThreadCallback(onTimer, DebugLogger::Location::TimerCallback);
 
 	if (isDeferred())
 	{
@@ -131,6 +131,9 @@ private:
 	void runTimerCallback(int offsetInBuffer = -1);
 	void runScriptCallbacks();
 
+	/** Executes the callback and reports the first allocation if the audio thread safe mode is enabled. */
+	void executeAudioThreadCallback(int callbackIndex, DebugLogger::Location location);
+
 	ScopedPointer<SnippetDocument> onInitCallback;
 	ScopedPointer<SnippetDocument> onNoteOnCallback;
 	ScopedPointer<SnippetDocument> onNoteOffCallback;
@@ -154,6 +157,9 @@ private:
 
 	bool front, deferred, deferredUpdatePending;
 
+	int lastAllocationCallback = -1;
+	int lastAllocationCharIndex = -1;
+
 	
 };
 
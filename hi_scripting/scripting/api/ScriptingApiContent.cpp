@@ -2533,6 +2533,8 @@ struct ScriptingApi::Content::ScriptPanel::Wrapper
     API_VOID_METHOD_WRAPPER_3(ScriptPanel, setValueWithUndo);
 	API_VOID_METHOD_WRAPPER_1(ScriptPanel, showAsPopup);
 	API_VOID_METHOD_WRAPPER_0(ScriptPanel, closeAsPopup);
+	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setPaintRoutineCaching);
+	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setPaintInBackground);
 };
 
 ScriptingApi::Content::ScriptPanel::ScriptPanel(ProcessorWithScriptingContent *base, Content* /*parentContent*/, Identifier panelName, int x, int y, int , int ) :
@@ -2603,10 +2605,14 @@ timerRoutine(var())
     ADD_API_METHOD_3(setValueWithUndo);
 	ADD_API_METHOD_1(showAsPopup);
 	ADD_API_METHOD_0(closeAsPopup);
+	ADD_API_METHOD_1(setPaintRoutineCaching);
+	ADD_API_METHOD_1(setPaintInBackground);
 }
 
 ScriptingApi::Content::ScriptPanel::~ScriptPanel()
 {
+	backgroundPainter->removePanel(this);
+
 	stopTimer();
 
 	timerRoutine = var();
@@ -2640,13 +2646,16 @@ ScriptCreatedComponentWrapper * ScriptingApi::Content::ScriptPanel::createCompon
 
 void ScriptingApi::Content::ScriptPanel::repaint()
 {
-	repainter.triggerAsyncUpdate();
+	if (paintInBackground && checkBackgroundPainting())
+		backgroundPainter->addPanel(this);
+	else
+		repainter.triggerAsyncUpdate();
 }
 
 
 void ScriptingApi::Content::ScriptPanel::repaintImmediately()
 {
-	if (MessageManager::getInstance()->isThisTheMessageThread())
+	if (!paintInBackground && MessageManager::getInstance()->isThisTheMessageThread())
 	{
 		repainter.cancelPendingUpdate();
 		internalRepaint();
@@ -2679,6 +2688,15 @@ void ScriptingApi::Content::ScriptPanel::internalRepaint(bool forceRepaint/*=fal
 
 	ScopedReadLock sl(dynamic_cast<Processor*>(getScriptProcessor())->getMainController()->getCompileLock());
 
+	recordPaintRoutine(forceRepaint);
+
+	//SEND_MESSAGE(this);
+}
+
+void ScriptingApi::Content::ScriptPanel::recordPaintRoutine(bool forceRepaint)
+{
+	ScopedLock sl(paintRoutineLock);
+
 	if (!usesClippedFixedImage)
 	{
 		HiseJavascriptEngine* engine = dynamic_cast<JavascriptProcessor*>(getScriptProcessor())->getScriptEngine();
@@ -2686,37 +2704,29 @@ void ScriptingApi::Content::ScriptPanel::internalRepaint(bool forceRepaint/*=fal
 		if (engine == nullptr)
 			return;
 
-		auto imageBounds = getBoundsForImage();
+		const int width = getScriptObjectProperty(ScriptComponent::Properties::width);
+		const int height = getScriptObjectProperty(ScriptComponent::Properties::height);
 
-		int canvasWidth = imageBounds.getWidth();
-		int canvasHeight = imageBounds.getHeight();
-
-		if ((!forceRepaint && !isShowing()) || canvasWidth <= 0 || canvasHeight <= 0)
+		if ((!forceRepaint && !isShowing()) || width <= 0 || height <= 0)
 		{
-			paintCanvas = Image();
+			SpinLock::ScopedLockType dl(displayListLock);
+			displayList = nullptr;
 
 			return;
 		}
 
-		if (paintCanvas.getWidth() != canvasWidth ||
-			paintCanvas.getHeight() != canvasHeight)
-		{
-			paintCanvas = Image(Image::PixelFormat::ARGB, canvasWidth, canvasHeight, !getScriptObjectProperty(Properties::opaque));
-		}
-		else if (!getScriptObjectProperty(Properties::opaque))
-		{
-			paintCanvas.clear(Rectangle<int>(0, 0, canvasWidth, canvasHeight));
-		}
+		const int64 paintState = paintCacheEnabled ? getPaintStateHash() : 0;
 
-		Graphics g(paintCanvas);
+		if (paintCacheEnabled && !forceRepaint && paintState == lastPaintState && getDisplayList() != nullptr)
+			return;
 
-		g.addTransform(AffineTransform::scale((float)getScaleFactorForCanvas()));
+		DisplayList::Ptr newList = new DisplayList();
 
 		var thisObject(this);
 		var arguments = var(graphics);
 		var::NativeFunctionArgs args(thisObject, &arguments, 1);
 
-		graphics->setGraphics(&g, &paintCanvas);
+		graphics->setDisplayList(newList);
 
 		Result r = Result::ok();
 
@@ -2732,14 +2742,130 @@ void ScriptingApi::Content::ScriptPanel::internalRepaint(bool forceRepaint/*=fal
 			debugError(dynamic_cast<Processor*>(getScriptProcessor()), r.getErrorMessage());
 		}
 
-		graphics->setGraphics(nullptr, nullptr);
+		graphics->setDisplayList(nullptr);
+
+		{
+			SpinLock::ScopedLockType dl(displayListLock);
+			displayList = newList;
+		}
+
+		lastPaintState = paintState;
 
 		sendChangeMessage();
 
-		repaintNotifier.sendSynchronousChangeMessage();
+		if (MessageManager::getInstance()->isThisTheMessageThread())
+			repaintNotifier.sendSynchronousChangeMessage();
+		else
+			repaintNotifier.sendChangeMessage();
 	}
+}
 
-	//SEND_MESSAGE(this);
+int64 ScriptingApi::Content::ScriptPanel::getPaintStateHash() const
+{
+	String state = JSON::toString(getConstantValue(0), true);
+
+	state << getValue().toString();
+	state << getScriptObjectProperty(ScriptComponent::Properties::width).toString();
+	state << getScriptObjectProperty(ScriptComponent::Properties::height).toString();
+
+	return state.hashCode64();
+}
+
+void ScriptingApi::Content::ScriptPanel::setPaintRoutineCaching(bool shouldCache)
+{
+	paintCacheEnabled = shouldCache;
+}
+
+void ScriptingApi::Content::ScriptPanel::setPaintInBackground(bool shouldPaintInBackground)
+{
+	if (!shouldPaintInBackground)
+		backgroundPainter->removePanel(this);
+
+	paintInBackground = shouldPaintInBackground;
+
+	if (paintInBackground)
+		checkBackgroundPainting();
+}
+
+bool ScriptingApi::Content::ScriptPanel::checkBackgroundPainting()
+{
+	auto engine = dynamic_cast<JavascriptProcessor*>(getScriptProcessor())->getScriptEngine();
+
+	// The local variables of inline functions are not thread safe, so calling them from the paint routine
+	// and another callback at the same time corrupts their values. This is also checked when the panel is
+	// repainted because an included file might add inline functions after setPaintInBackground() was called.
+	if (engine != nullptr && engine->hasInlineFunctions())
+	{
+		debugToConsole(dynamic_cast<Processor*>(getScriptProcessor()), getName().toString() + ": background painting is disabled because the script uses inline functions");
+
+		paintInBackground = false;
+		backgroundPainter->removePanel(this);
+		return false;
+	}
+
+	return true;
+}
+
+void ScriptingApi::Content::ScriptPanel::BackgroundPainter::addPanel(ScriptPanel* p)
+{
+	{
+		ScopedLock sl(queueLock);
+		pendingPanels.addIfNotAlreadyThere(p);
+	}
+
+	if (!isThreadRunning())
+		startThread(3);
+
+	notify();
+}
+
+void ScriptingApi::Content::ScriptPanel::BackgroundPainter::removePanel(ScriptPanel* p)
+{
+	{
+		ScopedLock sl(queueLock);
+		pendingPanels.removeAllInstancesOf(p);
+	}
+
+	// The paint lock is held while a panel is painted, so this waits until it's done.
+	ScopedLock sl(paintLock);
+}
+
+void ScriptingApi::Content::ScriptPanel::BackgroundPainter::run()
+{
+	while (!threadShouldExit())
+	{
+		wait(500);
+
+		while (!threadShouldExit())
+		{
+			ScopedLock sl(paintLock);
+
+			ScriptPanel* p = nullptr;
+
+			{
+				ScopedLock ql(queueLock);
+
+				if (pendingPanels.isEmpty())
+					break;
+
+				p = pendingPanels.removeAndReturn(0);
+			}
+
+			const bool parentHasMovedOn = !p->parent->hasComponent(p);
+
+			if (parentHasMovedOn || !p->parent->asyncFunctionsAllowed())
+				continue;
+
+			auto& compileLock = dynamic_cast<Processor*>(p->getScriptProcessor())->getMainController()->getCompileLock();
+
+			// Don't wait for a compilation, the panel will be repainted afterwards anyway
+			if (compileLock.tryEnterRead())
+			{
+				p->recordPaintRoutine(false);
+				compileLock.exitRead();
+			}
+		}
+	}
 }
 
 void ScriptingApi::Content::ScriptPanel::setLoadingCallback(var loadingCallback)
@@ -2966,6 +3092,11 @@ void ScriptingApi::Content::ScriptPanel::setImage(String imageName, int xOffset,
 	paintRoutine = var();
 	usesClippedFixedImage = true;
 
+	{
+		SpinLock::ScopedLockType sl(displayListLock);
+		displayList = nullptr;
+	}
+
 	Image toUse = getLoadedImage(imageName);
 
 	auto b = getBoundsForImage();
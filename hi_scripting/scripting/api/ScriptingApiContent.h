@@ -1193,6 +1193,7 @@ public:
 			repaintNotifier.removeAllChangeListeners();
 			
 			repainter.cancelPendingUpdate();
+			backgroundPainter->removePanel(this);
 			
 		}
 
@@ -1244,6 +1245,16 @@ public:
 		/** Closes the popup manually. */
 		void closeAsPopup();
 
+		/** If enabled, repaint() only executes the paint routine if the `data` object, the value or the size of the panel has changed. */
+		void setPaintRoutineCaching(bool shouldCache);
+
+		/** Executes the paint routine on a background thread.
+		*
+		*	The paint routine runs at the same time as the other callbacks, so it must not change any script variables.
+		*	This is ignored if the script uses inline functions because their local variables are not thread safe.
+		*/
+		void setPaintInBackground(bool shouldPaintInBackground);
+
 		// ========================================================================================================
 
 		void forcedRepaint()
@@ -1280,6 +1291,13 @@ public:
 			return paintCanvas;
 		}
 
+		/** Returns the draw calls of the last paint routine execution. */
+		DisplayList::Ptr getDisplayList() const
+		{
+			SpinLock::ScopedLockType sl(displayListLock);
+			return displayList;
+		}
+
 		bool isUsingCustomPaintRoutine() const { return HiseJavascriptEngine::isJavascriptFunction(paintRoutine); }
 
 		bool isUsingClippedFixedImage() const { return usesClippedFixedImage; };
@@ -1359,7 +1377,39 @@ public:
 		
 		void internalRepaint(bool forceRepaint=false);
 
-		
+		/** Executes the paint routine and records it into a new DisplayList. The compile lock must be held. */
+		void recordPaintRoutine(bool forceRepaint);
+
+		/** Creates a hash of everything that is checked by the paint routine cache. */
+		int64 getPaintStateHash() const;
+
+		/** A thread that executes the paint routines of the panels that use setPaintInBackground(). */
+		struct BackgroundPainter : public Thread
+		{
+			BackgroundPainter() :
+				Thread("Script Panel Painter")
+			{}
+
+			~BackgroundPainter()
+			{
+				stopThread(1000);
+			}
+
+			void addPanel(ScriptPanel* p);
+
+			/** Removes the panel from the queue and waits until its paint routine is finished. */
+			void removePanel(ScriptPanel* p);
+
+			void run() override;
+
+		private:
+
+			CriticalSection queueLock;
+			CriticalSection paintLock;
+
+			Array<ScriptPanel*> pendingPanels;
+		};
+
 
 		struct AsyncPreloadStateHandler : private AsyncUpdater
 		{
@@ -1411,7 +1461,8 @@ public:
 			WeakReference<ScriptPanel> parent;
 		};
 
-        
+		/** Disables the background painting if the script uses inline functions. Returns false if it was disabled. */
+		bool checkBackgroundPainting();
         
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScriptPanel);
 
@@ -1426,6 +1477,16 @@ public:
 
 		Image paintCanvas;
 
+		DisplayList::Ptr displayList;
+		mutable SpinLock displayListLock;
+
+		CriticalSection paintRoutineLock;
+		int64 lastPaintState = 0;
+		bool paintCacheEnabled = false;
+		bool paintInBackground = false;
+
+		SharedResourcePointer<BackgroundPainter> backgroundPainter;
+
 		enum class NamedImageEntries
 		{
 			Image=0,
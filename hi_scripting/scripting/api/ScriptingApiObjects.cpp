@@ -1965,6 +1965,190 @@ var ScriptingObjects::PathObject::getBounds(var scaleFactor)
 	return var(area);
 }
 
+namespace ScriptedDrawActions
+{
+	struct FillAllAction : public DisplayList::Action
+	{
+		FillAllAction(Colour c_) : c(c_) {};
+		void perform(Graphics& g, Image*) const override { g.fillAll(c); }
+		Colour c;
+	};
+
+	struct FillRectAction : public DisplayList::Action
+	{
+		FillRectAction(Rectangle<float> area_) : area(area_) {};
+		void perform(Graphics& g, Image*) const override { g.fillRect(area); }
+		Rectangle<float> area;
+	};
+
+	struct DrawRectAction : public DisplayList::Action
+	{
+		DrawRectAction(Rectangle<float> area_, float borderSize_) : area(area_), borderSize(borderSize_) {};
+		void perform(Graphics& g, Image*) const override { g.drawRect(area, borderSize); }
+		Rectangle<float> area;
+		float borderSize;
+	};
+
+	struct FillRoundedRectangleAction : public DisplayList::Action
+	{
+		FillRoundedRectangleAction(Rectangle<float> area_, float cornerSize_) : area(area_), cornerSize(cornerSize_) {};
+		void perform(Graphics& g, Image*) const override { g.fillRoundedRectangle(area, cornerSize); }
+		Rectangle<float> area;
+		float cornerSize;
+	};
+
+	struct DrawRoundedRectangleAction : public DisplayList::Action
+	{
+		DrawRoundedRectangleAction(Rectangle<float> area_, float cornerSize_, float borderSize_) : area(area_), cornerSize(cornerSize_), borderSize(borderSize_) {};
+		void perform(Graphics& g, Image*) const override { g.drawRoundedRectangle(area, cornerSize, borderSize); }
+		Rectangle<float> area;
+		float cornerSize;
+		float borderSize;
+	};
+
+	struct DrawHorizontalLineAction : public DisplayList::Action
+	{
+		DrawHorizontalLineAction(int y_, float x1_, float x2_) : y(y_), x1(x1_), x2(x2_) {};
+		void perform(Graphics& g, Image*) const override { g.drawHorizontalLine(y, x1, x2); }
+		int y;
+		float x1, x2;
+	};
+
+	struct DrawLineAction : public DisplayList::Action
+	{
+		DrawLineAction(Line<float> line_, float lineThickness_) : line(line_), lineThickness(lineThickness_) {};
+		void perform(Graphics& g, Image*) const override { g.drawLine(line, lineThickness); }
+		Line<float> line;
+		float lineThickness;
+	};
+
+	struct SetOpacityAction : public DisplayList::Action
+	{
+		SetOpacityAction(float alpha_) : alpha(alpha_) {};
+		void perform(Graphics& g, Image*) const override { g.setOpacity(alpha); }
+		float alpha;
+	};
+
+	struct SetColourAction : public DisplayList::Action
+	{
+		SetColourAction(Colour c_) : c(c_) {};
+		void perform(Graphics& g, Image*) const override { g.setColour(c); }
+		Colour c;
+	};
+
+	struct SetFontAction : public DisplayList::Action
+	{
+		SetFontAction(Font f_) : f(f_) {};
+		void perform(Graphics& g, Image*) const override { g.setFont(f); }
+		Font f;
+	};
+
+	struct SetGradientFillAction : public DisplayList::Action
+	{
+		SetGradientFillAction(const ColourGradient& gradient_) : gradient(gradient_) {};
+		void perform(Graphics& g, Image*) const override { g.setGradientFill(gradient); }
+		ColourGradient gradient;
+	};
+
+	struct DrawTextAction : public DisplayList::Action
+	{
+		DrawTextAction(const String& text_, Rectangle<float> area_, Justification j_) : text(text_), area(area_), j(j_) {};
+		void perform(Graphics& g, Image*) const override { g.drawText(text, area, j); }
+		String text;
+		Rectangle<float> area;
+		Justification j;
+	};
+
+	struct DrawEllipseAction : public DisplayList::Action
+	{
+		DrawEllipseAction(Rectangle<float> area_, float lineThickness_) : area(area_), lineThickness(lineThickness_) {};
+		void perform(Graphics& g, Image*) const override { g.drawEllipse(area, lineThickness); }
+		Rectangle<float> area;
+		float lineThickness;
+	};
+
+	struct FillEllipseAction : public DisplayList::Action
+	{
+		FillEllipseAction(Rectangle<float> area_) : area(area_) {};
+		void perform(Graphics& g, Image*) const override { g.fillEllipse(area); }
+		Rectangle<float> area;
+	};
+
+	struct DrawImageAction : public DisplayList::Action
+	{
+		DrawImageAction(const Image& img_, Rectangle<int> destination_, Rectangle<int> source_) : img(img_), destination(destination_), source(source_) {};
+
+		void perform(Graphics& g, Image*) const override
+		{
+			g.drawImage(img, destination.getX(), destination.getY(), destination.getWidth(), destination.getHeight(),
+						source.getX(), source.getY(), source.getWidth(), source.getHeight());
+		}
+
+		Image img;
+		Rectangle<int> destination;
+		Rectangle<int> source;
+	};
+
+	struct DrawDropShadowAction : public DisplayList::Action
+	{
+		DrawDropShadowAction(const DropShadow& shadow_, Rectangle<int> area_) : shadow(shadow_), area(area_) {};
+		void perform(Graphics& g, Image*) const override { shadow.drawForRectangle(g, area); }
+		DropShadow shadow;
+		Rectangle<int> area;
+	};
+
+	struct FillPathAction : public DisplayList::Action
+	{
+		FillPathAction(const Path& p_) : p(p_) {};
+		void perform(Graphics& g, Image*) const override { g.fillPath(p); }
+		Path p;
+	};
+
+	struct StrokePathAction : public DisplayList::Action
+	{
+		StrokePathAction(const Path& p_, const PathStrokeType& stroke_) : p(p_), stroke(stroke_) {};
+		void perform(Graphics& g, Image*) const override { g.strokePath(p, stroke); }
+		Path p;
+		PathStrokeType stroke;
+	};
+
+	struct AddTransformAction : public DisplayList::Action
+	{
+		AddTransformAction(const AffineTransform& t_) : t(t_) {};
+		void perform(Graphics& g, Image*) const override { g.addTransform(t); }
+		AffineTransform t;
+	};
+
+	struct AddDropShadowFromAlphaAction : public DisplayList::Action
+	{
+		AddDropShadowFromAlphaAction(const DropShadow& shadow_) : shadow(shadow_) {};
+
+		bool needsCanvas() const override { return true; }
+
+		void perform(Graphics& g, Image* canvas) const override
+		{
+			if (canvas == nullptr)
+				return;
+
+			Graphics g2(*canvas);
+
+#if JUCE_MAC || HISE_IOS
+			// The list might be replayed on another display, so use the scale of the canvas instead of the recording
+			const float scaleFactor = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+			// don't ask why...
+			g2.addTransform(AffineTransform::scale(1.0f / scaleFactor));
+#else
+			ignoreUnused(g);
+#endif
+
+			shadow.drawForImage(g2, *canvas);
+		}
+
+		DropShadow shadow;
+	};
+}
+
 struct ScriptingObjects::GraphicsObject::Wrapper
 {
 	API_VOID_METHOD_WRAPPER_1(GraphicsObject, fillAll);
@@ -2025,8 +2209,7 @@ rectangleResult(Result::ok())
 ScriptingObjects::GraphicsObject::~GraphicsObject()
 {
 	parent = nullptr;
-	imageToDraw = nullptr;
-	g = nullptr;
+	displayList = nullptr;
 }
 
 void ScriptingObjects::GraphicsObject::fillAll(var colour)
@@ -2034,7 +2217,7 @@ void ScriptingObjects::GraphicsObject::fillAll(var colour)
 	initGraphics();
 	Colour c = ScriptingApi::Content::Helpers::getCleanedObjectColour(colour);
 
-	g->fillAll(c);
+	displayList->addAction(new ScriptedDrawActions::FillAllAction(c));
 
 	
 }
@@ -2043,7 +2226,7 @@ void ScriptingObjects::GraphicsObject::fillRect(var area)
 {
 	initGraphics();
 
-	g->fillRect(getRectangleFromVar(area));
+	displayList->addAction(new ScriptedDrawActions::FillRectAction(getRectangleFromVar(area)));
 }
 
 void ScriptingObjects::GraphicsObject::drawRect(var area, float borderSize)
@@ -2052,7 +2235,7 @@ void ScriptingObjects::GraphicsObject::drawRect(var area, float borderSize)
 
 	auto bs = (float)borderSize;
 
-	g->drawRect(getRectangleFromVar(area), SANITIZED(bs));
+	displayList->addAction(new ScriptedDrawActions::DrawRectAction(getRectangleFromVar(area), SANITIZED(bs)));
 }
 
 void ScriptingObjects::GraphicsObject::fillRoundedRectangle(var area, float cornerSize)
@@ -2061,7 +2244,7 @@ void ScriptingObjects::GraphicsObject::fillRoundedRectangle(var area, float corn
 
     auto cs = (float)cornerSize;
     
-	g->fillRoundedRectangle(getRectangleFromVar(area), SANITIZED(cs));
+	displayList->addAction(new ScriptedDrawActions::FillRoundedRectangleAction(getRectangleFromVar(area), SANITIZED(cs)));
 }
 
 void ScriptingObjects::GraphicsObject::drawRoundedRectangle(var area, float cornerSize, float borderSize)
@@ -2071,7 +2254,7 @@ void ScriptingObjects::GraphicsObject::drawRoundedRectangle(var area, float corn
     auto cs = (float)cornerSize;
     auto bs = (float)borderSize;
     
-    g->drawRoundedRectangle(getRectangleFromVar(area), SANITIZED(cs), SANITIZED(bs));
+    displayList->addAction(new ScriptedDrawActions::DrawRoundedRectangleAction(getRectangleFromVar(area), SANITIZED(cs), SANITIZED(bs)));
 }
 
 void ScriptingObjects::GraphicsObject::drawHorizontalLine(int y, float x1, float x2)
@@ -2080,7 +2263,7 @@ void ScriptingObjects::GraphicsObject::drawHorizontalLine(int y, float x1, float
 
     
     
-	g->drawHorizontalLine(y, SANITIZED(x1), SANITIZED(x2));
+	displayList->addAction(new ScriptedDrawActions::DrawHorizontalLineAction(y, SANITIZED(x1), SANITIZED(x2)));
 }
 
 void ScriptingObjects::GraphicsObject::setOpacity(float alphaValue)
@@ -2089,32 +2272,37 @@ void ScriptingObjects::GraphicsObject::setOpacity(float alphaValue)
 
 	
 
-	g->setOpacity(alphaValue);
+	displayList->addAction(new ScriptedDrawActions::SetOpacityAction(alphaValue));
 }
 
 void ScriptingObjects::GraphicsObject::drawLine(float x1, float x2, float y1, float y2, float lineThickness)
 {
 	initGraphics();
 
-	g->drawLine(SANITIZED(x1), SANITIZED(y1), SANITIZED(x2), SANITIZED(y2), SANITIZED(lineThickness));
+	Line<float> l(SANITIZED(x1), SANITIZED(y1), SANITIZED(x2), SANITIZED(y2));
+
+	displayList->addAction(new ScriptedDrawActions::DrawLineAction(l, SANITIZED(lineThickness)));
 }
 
 void ScriptingObjects::GraphicsObject::setColour(var colour)
 {
-	
+	initGraphics();
+
 	currentColour = ScriptingApi::Content::Helpers::getCleanedObjectColour(colour);
-	g->setColour(currentColour);
+	displayList->addAction(new ScriptedDrawActions::SetColourAction(currentColour));
 
 	useGradient = false;
 }
 
 void ScriptingObjects::GraphicsObject::setFont(String fontName, float fontSize)
 {
+	initGraphics();
+
 	MainController *mc = getScriptProcessor()->getMainController_();
 
 	currentFont = mc->getFontFromString(fontName, SANITIZED(fontSize));
 
-	g->setFont(currentFont);
+	displayList->addAction(new ScriptedDrawActions::SetFontAction(currentFont));
 }
 
 void ScriptingObjects::GraphicsObject::drawText(String text, var area)
@@ -2125,9 +2313,8 @@ void ScriptingObjects::GraphicsObject::drawText(String text, var area)
 
 	currentFont.setHeightWithoutChangingWidth(r.getHeight());
 
-	g->setFont(currentFont);
-
-	g->drawText(text, r, Justification::centred);
+	displayList->addAction(new ScriptedDrawActions::SetFontAction(currentFont));
+	displayList->addAction(new ScriptedDrawActions::DrawTextAction(text, r, Justification::centred));
 }
 
 void ScriptingObjects::GraphicsObject::drawAlignedText(String text, var area, String alignment)
@@ -2144,13 +2331,14 @@ void ScriptingObjects::GraphicsObject::drawAlignedText(String text, var area, St
 		reportScriptError(re.getErrorMessage());
 
 
-	g->setFont(currentFont);
-
-	g->drawText(text, r, just);
+	displayList->addAction(new ScriptedDrawActions::SetFontAction(currentFont));
+	displayList->addAction(new ScriptedDrawActions::DrawTextAction(text, r, just));
 }
 
 void ScriptingObjects::GraphicsObject::setGradientFill(var gradientData)
 {
+	initGraphics();
+
 	if (gradientData.isArray())
 	{
 		Array<var>* data = gradientData.getArray();
@@ -2165,7 +2353,7 @@ void ScriptingObjects::GraphicsObject::setGradientFill(var gradientData)
 
 			useGradient = true;
 
-			g->setGradientFill(currentGradient);
+			displayList->addAction(new ScriptedDrawActions::SetGradientFillAction(currentGradient));
 		}
 		else
 		{
@@ -2184,14 +2372,14 @@ void ScriptingObjects::GraphicsObject::drawEllipse(var area, float lineThickness
 {
 	initGraphics();
 
-	g->drawEllipse(getRectangleFromVar(area), lineThickness);
+	displayList->addAction(new ScriptedDrawActions::DrawEllipseAction(getRectangleFromVar(area), lineThickness));
 }
 
 void ScriptingObjects::GraphicsObject::fillEllipse(var area)
 {
 	initGraphics();
 
-	g->fillEllipse(getRectangleFromVar(area));
+	displayList->addAction(new ScriptedDrawActions::FillEllipseAction(getRectangleFromVar(area)));
 }
 
 void ScriptingObjects::GraphicsObject::drawImage(String imageName, var area, int /*xOffset*/, int yOffset)
@@ -2210,7 +2398,10 @@ void ScriptingObjects::GraphicsObject::drawImage(String imageName, var area, int
         {
             const double scaleFactor = (double)img.getWidth() / (double)r.getWidth();
             
-            g->drawImage(img, (int)r.getX(), (int)r.getY(), (int)r.getWidth(), (int)r.getHeight(), 0, yOffset, (int)img.getWidth(), (int)((double)r.getHeight() * scaleFactor));
+            Rectangle<int> destination((int)r.getX(), (int)r.getY(), (int)r.getWidth(), (int)r.getHeight());
+            Rectangle<int> source(0, yOffset, (int)img.getWidth(), (int)((double)r.getHeight() * scaleFactor));
+
+            displayList->addAction(new ScriptedDrawActions::DrawImageAction(img, destination, source));
         }        
 	}
 	else
@@ -2230,7 +2421,7 @@ void ScriptingObjects::GraphicsObject::drawDropShadow(var area, var colour, int
 
 	auto r = getIntRectangleFromVar(area);
 
-	shadow.drawForRectangle(*g, r);
+	displayList->addAction(new ScriptedDrawActions::DrawDropShadowAction(shadow, r));
 }
 
 void ScriptingObjects::GraphicsObject::drawTriangle(var area, float angle, float lineThickness)
@@ -2247,7 +2438,7 @@ void ScriptingObjects::GraphicsObject::drawTriangle(var area, float angle, float
 	p.scaleToFit(r.getX(), r.getY(), r.getWidth(), r.getHeight(), false);
 	
 	PathStrokeType pst(lineThickness);
-	g->strokePath(p, pst);
+	displayList->addAction(new ScriptedDrawActions::StrokePathAction(p, pst));
 }
 
 void ScriptingObjects::GraphicsObject::fillTriangle(var area, float angle)
@@ -2263,7 +2454,7 @@ void ScriptingObjects::GraphicsObject::fillTriangle(var area, float angle)
 	auto r = getRectangleFromVar(area);
 	p.scaleToFit(r.getX(), r.getY(), r.getWidth(), r.getHeight(), false);
 
-	g->fillPath(p);
+	displayList->addAction(new ScriptedDrawActions::FillPathAction(p));
 }
 
 void ScriptingObjects::GraphicsObject::addDropShadowFromAlpha(var colour, int radius)
@@ -2275,20 +2466,13 @@ void ScriptingObjects::GraphicsObject::addDropShadowFromAlpha(var colour, int ra
 	shadow.colour = ScriptingApi::Content::Helpers::getCleanedObjectColour(colour);
 	shadow.radius = radius;
 
-    Graphics g2(*imageToDraw);
-    
-#if JUCE_MAC || HISE_IOS
-    const double scaleFactor = dynamic_cast<ScriptingApi::Content::ScriptPanel*>(parent)->parent->usesDoubleResolution() ? 2.0 : 1.0;
-    
-    // don't ask why...
-    g2.addTransform(AffineTransform::scale((float)(1.0 / scaleFactor)));
-#endif
-    
-	shadow.drawForImage(g2, *imageToDraw);
+	displayList->addAction(new ScriptedDrawActions::AddDropShadowFromAlphaAction(shadow));
 }
 
 void ScriptingObjects::GraphicsObject::fillPath(var path, var area)
 {
+	initGraphics();
+
 	if (PathObject* pathObject = dynamic_cast<PathObject*>(path.getObject()))
 	{
 		Path p = pathObject->getPath();
@@ -2299,12 +2483,14 @@ void ScriptingObjects::GraphicsObject::fillPath(var path, var area)
 			p.scaleToFit(r.getX(), r.getY(), r.getWidth(), r.getHeight(), false);
 		}
 
-		g->fillPath(p);
+		displayList->addAction(new ScriptedDrawActions::FillPathAction(p));
 	}
 }
 
 void ScriptingObjects::GraphicsObject::drawPath(var path, var area, var thickness)
 {
+	initGraphics();
+
 	if (PathObject* pathObject = dynamic_cast<PathObject*>(path.getObject()))
 	{
 		Path p = pathObject->getPath();
@@ -2317,7 +2503,7 @@ void ScriptingObjects::GraphicsObject::drawPath(var path, var area, var thicknes
 
         auto t = (float)thickness;
         
-		g->strokePath(p, PathStrokeType(SANITIZED(t)));
+		displayList->addAction(new ScriptedDrawActions::StrokePathAction(p, PathStrokeType(SANITIZED(t))));
 	}
 }
 
@@ -2331,7 +2517,7 @@ void ScriptingObjects::GraphicsObject::rotate(var angleInRadian, var center)
     
 	auto a = AffineTransform::rotation(SANITIZED(air), c.getX(), c.getY());
 
-	g->addTransform(a);
+	displayList->addAction(new ScriptedDrawActions::AddTransformAction(a));
 }
 
 Point<float> ScriptingObjects::GraphicsObject::getPointFromVar(const var& data)
@@ -2363,7 +2549,7 @@ Rectangle<int> ScriptingObjects::GraphicsObject::getIntRectangleFromVar(const va
 
 void ScriptingObjects::GraphicsObject::initGraphics()
 {
-	if (g == nullptr) reportScriptError("Graphics not initialised");
+	if (displayList == nullptr) reportScriptError("Graphics not initialised");
 
 }
 
@@ -1084,11 +1084,10 @@ public:
 
 		struct Wrapper;
 
-		
-		void setGraphics(Graphics *g_, Image* image_)
+		/** Sets the list that records the draw calls of the paint routine (or nullptr after the paint routine). */
+		void setDisplayList(DisplayList* newDisplayList)
 		{
-			g = g_;
-			imageToDraw = image_;
+			displayList = newDisplayList;
 		}
 
 	private:
@@ -1101,9 +1100,7 @@ public:
 
 		Result rectangleResult;
 
-		Image *imageToDraw = nullptr;
-
-		Graphics *g = nullptr;
+		DisplayList* displayList = nullptr;
 
 		Colour currentColour;
 		Font currentFont;
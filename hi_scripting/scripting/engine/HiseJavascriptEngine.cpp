@@ -98,7 +98,7 @@ void HiseJavascriptEngine::setBreakpoints(Array<Breakpoint> &breakpoints)
 }
 
 
-void HiseJavascriptEngine::prepareTimeout() const noexcept{ root->timeout = Time::getCurrentTime() + maximumExecutionTime; }
+void HiseJavascriptEngine::prepareTimeout() const noexcept{ root->timeoutBudget.prepare(maximumExecutionTime); }
 
 
 
@@ -459,7 +459,7 @@ struct HiseJavascriptEngine::RootObject::Scope
 
 	void checkTimeOut(const CodeLocation& location) const
 	{
-		if (Time::getCurrentTime() > root->timeout)
+		if (root->timeoutBudget.tick() && root->timeoutBudget.hasTimedOut())
 			location.throwError("Execution timed-out");
 	}
 };
@@ -690,6 +690,33 @@ void HiseJavascriptEngine::setCallStackEnabled(bool shouldBeEnabled)
 	root->setCallStackEnabled(shouldBeEnabled);
 }
 
+void HiseJavascriptEngine::setUseBytecode(bool shouldBeEnabled)
+{
+	root->setUseBytecode(shouldBeEnabled);
+}
+
+void HiseJavascriptEngine::setAudioThreadSafeMode(bool shouldBeEnabled)
+{
+	root->setAudioThreadSafeMode(shouldBeEnabled);
+}
+
+void HiseJavascriptEngine::startAllocationCheck()
+{
+	root->allocationTracker.start();
+}
+
+int HiseJavascriptEngine::stopAllocationCheck(RootObject::Error& firstAllocation)
+{
+	auto& tracker = root->allocationTracker;
+
+	tracker.stop();
+
+	if (tracker.numAllocations > 0)
+		firstAllocation = tracker.firstAllocation;
+
+	return tracker.numAllocations;
+}
+
 void HiseJavascriptEngine::registerApiClass(ApiClass *apiClass)
 {
 	root->hiseSpecialData.apiClasses.add(apiClass);
@@ -880,6 +907,20 @@ int HiseJavascriptEngine::getNumDebugObjects() const
 	return root->hiseSpecialData.getNumDebugObjects();
 }
 
+bool HiseJavascriptEngine::hasInlineFunctions() const
+{
+	if (root->hiseSpecialData.inlineFunctions.size() != 0)
+		return true;
+
+	for (auto n : root->hiseSpecialData.namespaces)
+	{
+		if (n->inlineFunctions.size() != 0)
+			return true;
+	}
+
+	return false;
+}
+
 
 void HiseJavascriptEngine::clearDebugInformation()
 {
@@ -941,6 +982,44 @@ numArgs(numArgs_)
 	}
 }
 
+static const double costHistogramLimits[] = { 1.0, 2.0, 5.0, 10.0, 25.0, 50.0, 100.0 };
+
+void HiseJavascriptEngine::RootObject::Callback::CostHistogram::addExecution(double percentage, int64 numTicks) noexcept
+{
+	int bucket = 0;
+
+	while (bucket < NumBuckets - 1 && percentage >= costHistogramLimits[bucket])
+		bucket++;
+
+	counts[bucket]++;
+
+	peakPercentage = jmax(peakPercentage, percentage);
+	lastNumTicks = numTicks;
+	peakNumTicks = jmax(peakNumTicks, numTicks);
+}
+
+var HiseJavascriptEngine::RootObject::Callback::CostHistogram::toVar() const
+{
+	DynamicObject::Ptr buckets = new DynamicObject();
+
+	for (int i = 0; i < NumBuckets; i++)
+	{
+		const String name = i < NumBuckets - 1 ? ("< " + String((int)costHistogramLimits[i]) + "%") :
+												 (">= " + String((int)costHistogramLimits[i - 1]) + "%");
+
+		buckets->setProperty(name, counts[i]);
+	}
+
+	DynamicObject::Ptr object = new DynamicObject();
+
+	object->setProperty("Histogram", var(buckets));
+	object->setProperty("PeakPercentage", peakPercentage);
+	object->setProperty("LastTicks", lastNumTicks);
+	object->setProperty("PeakTicks", peakNumTicks);
+
+	return var(object);
+}
+
 #if INCLUDE_NATIVE_JIT
 NativeJITScope* HiseJavascriptEngine::RootObject::HiseSpecialData::getNativeJITScope(const Identifier& id)
 {
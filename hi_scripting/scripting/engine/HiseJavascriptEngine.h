@@ -175,6 +175,9 @@ public:
 
 	int getNumDebugObjects() const;
 
+	/** Checks if the script defines inline functions in the root or any other namespace. */
+	bool hasInlineFunctions() const;
+
 	void clearDebugInformation();
 	
 	void rebuildDebugInformation();
@@ -193,6 +196,9 @@ public:
 
 	void setCallStackEnabled(bool shouldBeEnabled);
 
+	/** Enables the bytecode VM for the callbacks. If disabled, the parsed tree is evaluated directly. */
+	void setUseBytecode(bool shouldBeEnabled);
+
 	CriticalSection& getDebugLock() const;
 
 	void registerApiClass(ApiClass *apiClass);
@@ -335,7 +341,44 @@ public:
 	{
 		RootObject();
 
-		Time timeout;
+		/** The watchdog that aborts endless loops.
+		*
+		*	Reading the clock on every loop iteration and function call is too expensive, so every check
+		*	just counts a tick and the clock is only compared after NumTicksPerClockCheck ticks.
+		*/
+		struct TimeoutBudget
+		{
+			static constexpr int NumTicksPerClockCheck = 4096;
+
+			void prepare(RelativeTime maximumExecutionTime) noexcept
+			{
+				timeout = Time::getCurrentTime() + maximumExecutionTime;
+				ticksUntilClockCheck = NumTicksPerClockCheck;
+				numTicks = 0;
+			}
+
+			/** Returns true if the budget is used up and the clock needs to be checked. */
+			bool tick() noexcept
+			{
+				++numTicks;
+				return --ticksUntilClockCheck <= 0;
+			}
+
+			/** Refills the budget and compares the current time against the timeout. */
+			bool hasTimedOut() noexcept
+			{
+				ticksUntilClockCheck = NumTicksPerClockCheck;
+				return Time::getCurrentTime() > timeout;
+			}
+
+			Time timeout;
+			int ticksUntilClockCheck = NumTicksPerClockCheck;
+
+			/** The number of ticks since the last call to prepare(). */
+			int64 numTicks = 0;
+		};
+
+		TimeoutBudget timeoutBudget;
 
 		Array<Breakpoint> breakpoints;
 
@@ -491,6 +534,10 @@ public:
 		struct CallbackLocalStatement;  struct CallbackLocalReference;  struct ExternalCFunction;
 		struct NativeJIT;				struct IsDefinedTest;
 
+		// Bytecode
+
+		struct BytecodeFunction;		struct BytecodeCompiler;
+
 		// Parser classes
 
 		struct TokenIterator;
@@ -524,6 +571,59 @@ public:
 		String dumpCallStack(const Error& lastError, const Identifier& rootFunctionName);
 		void setCallStackEnabled(bool shouldeBeEnabled) { enableCallstack = shouldeBeEnabled; }
 
+		/** Resolves the unqualified names of the callbacks and inline functions to their slot in the root properties. */
+		void resolveSlots();
+
+		/** Compiles the bytecode for all callbacks and inline functions that don't have one yet. */
+		void compileBytecode();
+
+		void setUseBytecode(bool shouldUseBytecode) noexcept { useBytecode = shouldUseBytecode; }
+		bool isUsingBytecode() const noexcept { return useBytecode; }
+
+		/** Records the allocations of the script code while a callback is executed. 
+		*
+		*	Only the thread that started the check is recorded, so a callback running on another thread
+		*	at the same time doesn't show up.
+		*/
+		struct AllocationTracker
+		{
+			void start() noexcept
+			{
+				numAllocations = 0;
+				activeThread = Thread::getCurrentThreadId();
+			}
+
+			void stop() noexcept { activeThread = nullptr; }
+
+			bool isActive() const noexcept { return activeThread.load() != nullptr; }
+
+			/** Returns true if the calling thread started the check. Only this thread may reuse the cached literals. */
+			bool isActiveOnThisThread() const noexcept
+			{
+				auto t = activeThread.load();
+				return t != nullptr && t == Thread::getCurrentThreadId();
+			}
+
+			/** Call this whenever the script code allocates. The location of the first allocation is stored. */
+			void report(const CodeLocation& location, const char* description)
+			{
+				if (!isActiveOnThisThread())
+					return;
+
+				if (numAllocations++ == 0)
+					firstAllocation = Error::fromLocation(location, description);
+			}
+
+			std::atomic<Thread::ThreadID> activeThread { nullptr };
+			int numAllocations = 0;
+			Error firstAllocation;
+		};
+
+		void setAudioThreadSafeMode(bool shouldBeEnabled) noexcept { audioThreadSafeMode = shouldBeEnabled; }
+		bool isAudioThreadSafeMode() const noexcept { return audioThreadSafeMode; }
+
+		AllocationTracker allocationTracker;
+
 		class Callback:  public DynamicObject,
 					     public DebugableObject
 		{
@@ -535,6 +635,8 @@ public:
 
 			void setStatements(BlockStatement *s) noexcept;
 
+			void compileBytecode(RootObject* root);
+
 			bool isDefined() const noexcept{ return isCallbackDefined; }
 
 			const Identifier &getName() const { return callbackName; }
@@ -563,7 +665,13 @@ public:
 			String getDebugValue() const override 
 			{
 				const double percentage = lastExecutionTime / bufferTime * 100.0;
-				return String(percentage, 2) + "%";
+				return String(percentage, 2) + "% (Peak: " + String(costHistogram.peakPercentage, 2) + "%)";
+			}
+
+			/** Shows the execution cost histogram. */
+			void rightClickCallback(const MouseEvent& e, Component* componentToNotify) override
+			{
+				DebugableObject::Helpers::showJSONEditorForObject(e, componentToNotify, costHistogram.toVar(), getDebugName());
 			}
 
 			var createDynamicObjectForBreakpoint()
@@ -613,7 +721,27 @@ public:
 
 		private:
 
+			/** Counts the executions of the callback by their cost in percent of the buffer duration. */
+			struct CostHistogram
+			{
+				static constexpr int NumBuckets = 8;
+
+				void addExecution(double percentage, int64 numTicks) noexcept;
+
+				var toVar() const;
+
+				int counts[NumBuckets] = {};
+				double peakPercentage = 0.0;
+				int64 lastNumTicks = 0;
+				int64 peakNumTicks = 0;
+			};
+
+			void performStatements(const Scope& s, var* returnValue);
+
+			CostHistogram costHistogram;
+
 			ScopedPointer<BlockStatement> statements;
+			ScopedPointer<BytecodeFunction> bytecode;
 			double lastExecutionTime;
 			const Identifier callbackName;
 			int numArgs;
@@ -735,6 +863,9 @@ public:
 
 			ReferenceCountedArray<Callback> callbackNEW;
 
+			/** The unqualified names in callbacks and inline functions that are resolved to a root slot after the onInit call. */
+			Array<UnqualifiedName*> unresolvedNames;
+
 			ReferenceCountedArray<ExternalCFunction> externalCFunctions;
 
 			double callbackTimes[32];
@@ -811,6 +942,10 @@ public:
 		bool enableCallstack = false;
 
 		bool shouldUseCycleCheck = false;
+
+		bool useBytecode = true;
+
+		bool audioThreadSafeMode = false;
 	};
 
 	
@@ -929,6 +1064,20 @@ public:
 
 	static void checkValidParameter(int index, const var& valueToTest, const RootObject::CodeLocation& location);
 
+	/** Enables the audio thread safe mode.
+	*
+	*	In this mode the object and array literals reuse their storage if nothing else holds a reference to
+	*	their last value, and the allocations that can't be avoided are recorded between startAllocationCheck()
+	*	and stopAllocationCheck().
+	*/
+	void setAudioThreadSafeMode(bool shouldBeEnabled);
+
+	/** Starts recording the allocations of the script code on the current thread. */
+	void startAllocationCheck();
+
+	/** Stops recording and returns the number of allocations. The location of the first one is written to firstAllocation. */
+	int stopAllocationCheck(RootObject::Error& firstAllocation);
+
 private:
 
     bool initialising = false;
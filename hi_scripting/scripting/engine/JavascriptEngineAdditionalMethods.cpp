@@ -376,6 +376,7 @@ void HiseJavascriptEngine::RootObject::HiseSpecialData::clear()
 	inlineFunctions.clear();
 	constObjects.clear();
 	callbackNEW.clear();
+	unresolvedNames.clear();
 	globals = nullptr;
 }
 
@@ -754,6 +755,7 @@ var HiseJavascriptEngine::executeCallback(int callbackIndex, Result *result)
 
 void HiseJavascriptEngine::RootObject::Callback::setStatements(BlockStatement *s) noexcept
 {
+	bytecode = nullptr;
 	statements = s;
 	isCallbackDefined = s->statements.size() != 0;
 }
@@ -768,19 +770,26 @@ var HiseJavascriptEngine::RootObject::Callback::perform(RootObject *root)
 #if USE_BACKEND
 	const double pre = Time::getMillisecondCounterHiRes();
 
+	// The budget is shared by all callbacks, so only count the ticks of this invocation
+	const int64 ticksBefore = root->timeoutBudget.numTicks;
 
 	root->addToCallStack(callbackName, nullptr);
 
 
 
-	statements->perform(s, &returnValue);
+	performStatements(s, &returnValue);
 
 	root->removeFromCallStack(callbackName);
 
 	const double post = Time::getMillisecondCounterHiRes();
 	lastExecutionTime = post - pre;
+
+	// prepareTimeout() resets the counter if another entry point of the engine is called in the meantime
+	const int64 numTicks = jmax<int64>(0, root->timeoutBudget.numTicks - ticksBefore);
+
+	costHistogram.addExecution(lastExecutionTime / bufferTime * 100.0, numTicks);
 #else
-	statements->perform(s, &returnValue);
+	performStatements(s, &returnValue);
 #endif
 
 	return returnValue;
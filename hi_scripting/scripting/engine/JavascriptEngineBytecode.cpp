@@ -0,0 +1,955 @@
+namespace hise { using namespace juce;
+
+/** A callback or inline function body lowered to instructions for a register based VM.
+*
+*	Every expression writes its result into a preallocated register, so the var temporaries
+*	of the tree walker and the virtual getResult() call per node go away. Numbers stay unboxed
+*	until they are stored in a variable or passed to a function. Everything the compiler doesn't
+*	know is kept as a reference to the original tree node and evaluated from there.
+*/
+struct HiseJavascriptEngine::RootObject::BytecodeFunction
+{
+	enum OpCode
+	{
+		LoadConstant = 0,	// dst = constants[imm]
+		LoadPointer,		// dst = *pointers[imm]
+		StorePointer,		// *pointers[imm] = a
+		LoadConst,			// dst = ConstReference (nodes[imm])
+		LoadParameter,		// dst = InlineFunction::ParameterReference (nodes[imm])
+		Add,				// dst = a <op> b, nodes[imm] is the BinaryOperator for the slow path
+		Subtract,
+		Multiply,
+		Divide,
+		Modulo,
+		BitwiseOr,
+		BitwiseAnd,
+		BitwiseXor,
+		LeftShift,
+		RightShift,
+		RightShiftUnsigned,
+		Equals,
+		NotEquals,
+		LessThan,
+		LessThanOrEqual,
+		GreaterThan,
+		GreaterThanOrEqual,
+		TypeEquals,
+		TypeNotEquals,
+		ToBool,				// dst = (bool)dst
+		LoadBool,			// dst = imm != 0
+		Jump,				// pc = imm
+		JumpIfFalse,		// if (!a) pc = imm
+		CallApi,			// dst = ApiCall (nodes[imm]) with b arguments in a, a+1...
+		CallConstObject,	// dst = ConstObjectApiCall (nodes[imm]) with b arguments in a, a+1...
+		CallInline,			// dst = InlineFunction::FunctionCall (nodes[imm]) with b arguments in a, a+1...
+		EvalTree,			// dst = nodes[imm]->getResult()
+		AssignTree,			// nodes[imm]->assign(a)
+		PerformTree,		// treeCalls[imm].statement->perform()
+		CheckTimeout,		// nodes[imm]->location
+		Return,				// *returnedValue = a, returnWasHit
+		ReturnCode,			// return (ResultCode)imm
+		numOpCodes
+	};
+
+	struct Instruction
+	{
+		uint8 op;
+		uint8 dst;
+		uint8 a;
+		uint8 b;
+		int32 imm;
+	};
+
+	struct TreeCall
+	{
+		const Statement* statement;
+		int breakTarget;
+		int continueTarget;
+	};
+
+	/** A VM register. Numbers are stored unboxed and only converted to a var when they leave the VM. */
+	struct Register
+	{
+		enum Type
+		{
+			Undefined = 0,
+			Bool,
+			Int,
+			Int64,
+			Double,
+			Object // anything else, stored as var
+		};
+
+		void set(const var& v)
+		{
+			if (v.isInt())				setNumber(Int, (int)v);
+			else if (v.isDouble())		setDouble(v);
+			else if (v.isInt64())		setNumber(Int64, (int64)v);
+			else if (v.isBool())		setNumber(Bool, (bool)v ? 1 : 0);
+			else if (v.isUndefined())	setNumber(Undefined, 0);
+			else
+			{
+				type = Object;
+				value = v;
+			}
+		}
+
+		void setFrom(const Register& other)
+		{
+			if (other.type == Object)
+				value = other.value;
+			else if (type == Object)
+				value = var();
+
+			type = other.type;
+			i = other.i;
+		}
+
+		void setNumber(Type t, int64 newValue)
+		{
+			if (type == Object)
+				value = var();
+
+			type = t;
+			i = newValue;
+		}
+
+		void setDouble(double newValue)
+		{
+			if (type == Object)
+				value = var();
+
+			type = Double;
+			d = newValue;
+		}
+
+		void setBool(bool newValue) { setNumber(Bool, newValue ? 1 : 0); }
+		void setInt(int newValue) { setNumber(Int, newValue); }
+		void setInt64(int64 newValue) { setNumber(Int64, newValue); }
+
+		var get() const
+		{
+			switch (type)
+			{
+			case Undefined: return var::undefined();
+			case Bool:		return var(i != 0);
+			case Int:		return var((int)i);
+			case Int64:		return var(i);
+			case Double:	return var(d);
+			default:		return value;
+			}
+		}
+
+		void clear()
+		{
+			setNumber(Undefined, 0);
+		}
+
+		bool isNumeric() const noexcept { return type != Object; }
+		bool isDouble() const noexcept { return type == Double; }
+
+		int64 toInt64() const noexcept { return type == Double ? (int64)d : i; }
+		double toDouble() const noexcept { return type == Double ? d : (double)i; }
+
+		bool toBool() const
+		{
+			switch (type)
+			{
+			case Double:	return d != 0.0;
+			case Object:	return (bool)value;
+			default:		return i != 0;
+			}
+		}
+
+		Type type = Undefined;
+
+		union
+		{
+			int64 i = 0;
+			double d;
+		};
+
+		var value;
+	};
+
+	BytecodeFunction(const BlockStatement* source_) :
+		source(source_),
+		running(false)
+	{}
+
+	/** Runs the instructions. If the function is already running (recursion or another thread), it uses the tree instead. */
+	Statement::ResultCode run(const Scope& s, var* returnedValue) const;
+
+	const BlockStatement* source;
+
+	Array<Instruction> instructions;
+	Array<Register> constants;
+	Array<var*> pointers;
+	Array<const Statement*> nodes;
+	Array<TreeCall> treeCalls;
+
+	int numRegisters = 0;
+	mutable Array<Register> registers;
+
+	mutable std::atomic<bool> running;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BytecodeFunction)
+};
+
+/** Lowers a BlockStatement into a BytecodeFunction. */
+struct HiseJavascriptEngine::RootObject::BytecodeCompiler
+{
+	/** Returns nullptr if the body can't be compiled or would run completely on the tree anyway. */
+	static BytecodeFunction* compile(RootObject* root, const BlockStatement* body)
+	{
+		ScopedPointer<BytecodeFunction> f = new BytecodeFunction(body);
+
+		BytecodeCompiler c(root, f);
+
+		c.compileStatement(body);
+		c.emit(BytecodeFunction::ReturnCode, 0, 0, 0, Statement::ok);
+
+		const bool onlyTree = f->instructions.size() == 2 && f->instructions.getFirst().op == BytecodeFunction::PerformTree;
+
+		if (c.failed || onlyTree)
+			return nullptr;
+
+		f->numRegisters = jmax<int>(1, c.maxRegisters);
+		f->registers.insertMultiple(0, BytecodeFunction::Register(), f->numRegisters);
+
+		return f.release();
+	}
+
+private:
+
+	BytecodeCompiler(RootObject* root_, BytecodeFunction* f_) :
+		root(root_),
+		f(f_)
+	{}
+
+	typedef BytecodeFunction BF;
+
+	struct LoopTargets
+	{
+		Array<int> breakJumps;
+		Array<int> continueJumps;
+		Array<int> treeCalls;
+	};
+
+	int emit(int op, int dst, int a, int b, int imm)
+	{
+		BF::Instruction i;
+		i.op = (uint8)op;
+		i.dst = (uint8)dst;
+		i.a = (uint8)a;
+		i.b = (uint8)b;
+		i.imm = imm;
+
+		f->instructions.add(i);
+		return f->instructions.size() - 1;
+	}
+
+	int getPosition() const { return f->instructions.size(); }
+
+	void patchJump(int instructionIndex, int target)
+	{
+		f->instructions.getReference(instructionIndex).imm = target;
+	}
+
+	int addNode(const Statement* st)
+	{
+		f->nodes.add(st);
+		return f->nodes.size() - 1;
+	}
+
+	int addConstant(const var& v)
+	{
+		BF::Register r;
+		r.set(v);
+
+		f->constants.add(r);
+		return f->constants.size() - 1;
+	}
+
+	int addPointer(var* p)
+	{
+		const int index = f->pointers.indexOf(p);
+
+		if (index != -1)
+			return index;
+
+		f->pointers.add(p);
+		return f->pointers.size() - 1;
+	}
+
+	int allocateRegister()
+	{
+		if (numUsedRegisters >= 255)
+		{
+			failed = true;
+			return 0;
+		}
+
+		maxRegisters = jmax<int>(maxRegisters, ++numUsedRegisters);
+		return numUsedRegisters - 1;
+	}
+
+	void releaseRegisters(int numToKeep)
+	{
+		numUsedRegisters = numToKeep;
+	}
+
+	static bool hasBreakpointsOrLocks(const BlockStatement* b)
+	{
+		if (b->lockStatements.size() != 0)
+			return true;
+
+		for (auto st : b->statements)
+		{
+			if (st->breakpointReference.index != -1)
+				return true;
+		}
+
+		return false;
+	}
+
+	void compileStatement(const Statement* st)
+	{
+		if (st == nullptr || typeid(*st) == typeid(Statement))
+			return;
+
+		if (auto b = dynamic_cast<const BlockStatement*>(st))
+		{
+			if (hasBreakpointsOrLocks(b))
+				return performTree(st);
+
+			for (auto child : b->statements)
+				compileStatement(child);
+
+			return;
+		}
+
+		if (auto e = dynamic_cast<const Expression*>(st))
+		{
+			const int mark = numUsedRegisters;
+			compileExpression(e, allocateRegister());
+			releaseRegisters(mark);
+			return;
+		}
+
+		if (auto is = dynamic_cast<const IfStatement*>(st))
+		{
+			const int mark = numUsedRegisters;
+			const int c = allocateRegister();
+			compileExpression(is->condition, c);
+			releaseRegisters(mark);
+
+			const int jumpToFalse = emit(BF::JumpIfFalse, 0, c, 0, -1);
+			compileStatement(is->trueBranch);
+			const int jumpToEnd = emit(BF::Jump, 0, 0, 0, -1);
+			patchJump(jumpToFalse, getPosition());
+			compileStatement(is->falseBranch);
+			patchJump(jumpToEnd, getPosition());
+			return;
+		}
+
+		if (auto loop = dynamic_cast<const LoopStatement*>(st))
+		{
+			if (loop->isIterator)
+				return performTree(st);
+
+			return compileLoop(loop);
+		}
+
+		if (auto lv = dynamic_cast<const LocalVarStatement*>(st))
+			return compileLocalDefinition(lv->initialiser, lv->parentFunction->localProperties.getVarPointerAt(lv->index));
+
+		if (auto cl = dynamic_cast<const CallbackLocalStatement*>(st))
+			return compileLocalDefinition(cl->initialiser, cl->parentCallback->localProperties.getVarPointerAt(cl->index));
+
+		if (auto r = dynamic_cast<const ReturnStatement*>(st))
+		{
+			const int mark = numUsedRegisters;
+			const int v = allocateRegister();
+			compileExpression(r->returnValue, v);
+			emit(BF::Return, 0, v, 0, 0);
+			releaseRegisters(mark);
+			return;
+		}
+
+		if (dynamic_cast<const BreakStatement*>(st) != nullptr)
+		{
+			if (auto l = loops.getLast())
+				l->breakJumps.add(emit(BF::Jump, 0, 0, 0, -1));
+			else
+				emit(BF::ReturnCode, 0, 0, 0, Statement::breakWasHit);
+
+			return;
+		}
+
+		if (dynamic_cast<const ContinueStatement*>(st) != nullptr)
+		{
+			if (auto l = loops.getLast())
+				l->continueJumps.add(emit(BF::Jump, 0, 0, 0, -1));
+			else
+				emit(BF::ReturnCode, 0, 0, 0, Statement::continueWasHit);
+
+			return;
+		}
+
+		performTree(st);
+	}
+
+	void compileLocalDefinition(const Expression* initialiser, var* slot)
+	{
+		const int mark = numUsedRegisters;
+		const int v = allocateRegister();
+		compileExpression(initialiser, v);
+		emit(BF::StorePointer, 0, v, 0, addPointer(slot));
+		releaseRegisters(mark);
+	}
+
+	void compileLoop(const LoopStatement* loop)
+	{
+		LoopTargets targets;
+
+		compileStatement(loop->initialiser);
+
+		const int start = getPosition();
+		const int mark = numUsedRegisters;
+		const int c = allocateRegister();
+
+		if (!loop->isDoLoop)
+		{
+			compileExpression(loop->condition, c);
+			targets.breakJumps.add(emit(BF::JumpIfFalse, 0, c, 0, -1));
+		}
+
+		emit(BF::CheckTimeout, 0, 0, 0, addNode(loop));
+
+		loops.add(&targets);
+		compileStatement(loop->body);
+		loops.removeLast();
+
+		int continueTarget = getPosition();
+
+		compileStatement(loop->iterator);
+
+		if (loop->isDoLoop)
+		{
+			// A continue statement skips the condition of a do loop (see LoopStatement::perform())
+			compileExpression(loop->condition, c);
+			targets.breakJumps.add(emit(BF::JumpIfFalse, 0, c, 0, -1));
+			emit(BF::Jump, 0, 0, 0, start);
+
+			continueTarget = getPosition();
+			compileStatement(loop->iterator);
+		}
+
+		emit(BF::Jump, 0, 0, 0, start);
+		releaseRegisters(mark);
+
+		const int end = getPosition();
+
+		for (auto j : targets.breakJumps)
+			patchJump(j, end);
+
+		for (auto j : targets.continueJumps)
+			patchJump(j, continueTarget);
+
+		for (auto t : targets.treeCalls)
+		{
+			auto& tc = f->treeCalls.getReference(t);
+			tc.breakTarget = end;
+			tc.continueTarget = continueTarget;
+		}
+	}
+
+	void performTree(const Statement* st)
+	{
+		BF::TreeCall tc;
+		tc.statement = st;
+		tc.breakTarget = -1;
+		tc.continueTarget = -1;
+
+		f->treeCalls.add(tc);
+
+		const int index = f->treeCalls.size() - 1;
+
+		if (auto l = loops.getLast())
+			l->treeCalls.add(index);
+
+		emit(BF::PerformTree, 0, 0, 0, index);
+	}
+
+	static int getBinaryOpCode(const Expression* e)
+	{
+		if (dynamic_cast<const AdditionOp*>(e) != nullptr)				return BF::Add;
+		if (dynamic_cast<const SubtractionOp*>(e) != nullptr)			return BF::Subtract;
+		if (dynamic_cast<const MultiplyOp*>(e) != nullptr)				return BF::Multiply;
+		if (dynamic_cast<const DivideOp*>(e) != nullptr)				return BF::Divide;
+		if (dynamic_cast<const ModuloOp*>(e) != nullptr)				return BF::Modulo;
+		if (dynamic_cast<const BitwiseOrOp*>(e) != nullptr)				return BF::BitwiseOr;
+		if (dynamic_cast<const BitwiseAndOp*>(e) != nullptr)			return BF::BitwiseAnd;
+		if (dynamic_cast<const BitwiseXorOp*>(e) != nullptr)			return BF::BitwiseXor;
+		if (dynamic_cast<const LeftShiftOp*>(e) != nullptr)				return BF::LeftShift;
+		if (dynamic_cast<const RightShiftOp*>(e) != nullptr)			return BF::RightShift;
+		if (dynamic_cast<const RightShiftUnsignedOp*>(e) != nullptr)	return BF::RightShiftUnsigned;
+		if (dynamic_cast<const EqualsOp*>(e) != nullptr)				return BF::Equals;
+		if (dynamic_cast<const NotEqualsOp*>(e) != nullptr)				return BF::NotEquals;
+		if (dynamic_cast<const LessThanOp*>(e) != nullptr)				return BF::LessThan;
+		if (dynamic_cast<const LessThanOrEqualOp*>(e) != nullptr)		return BF::LessThanOrEqual;
+		if (dynamic_cast<const GreaterThanOp*>(e) != nullptr)			return BF::GreaterThan;
+		if (dynamic_cast<const GreaterThanOrEqualOp*>(e) != nullptr)	return BF::GreaterThanOrEqual;
+		if (dynamic_cast<const TypeEqualsOp*>(e) != nullptr)			return BF::TypeEquals;
+		if (dynamic_cast<const TypeNotEqualsOp*>(e) != nullptr)			return BF::TypeNotEquals;
+
+		return -1;
+	}
+
+	void compileStore(const Expression* target, int source)
+	{
+		if (auto rn = dynamic_cast<const RegisterName*>(target))
+			emit(BF::StorePointer, 0, source, 0, addPointer(rn->data));
+		else if (auto lr = dynamic_cast<const LocalReference*>(target))
+			emit(BF::StorePointer, 0, source, 0, addPointer(lr->getSlotPointer()));
+		else if (auto cl = dynamic_cast<const CallbackLocalReference*>(target))
+			emit(BF::StorePointer, 0, source, 0, addPointer(cl->getSlotPointer()));
+		else
+			emit(BF::AssignTree, 0, source, 0, addNode(target));
+	}
+
+	/** Compiles the arguments into consecutive registers and returns the first one. */
+	int compileArguments(const ExpPtr* arguments, int numArguments)
+	{
+		const int first = numUsedRegisters;
+
+		for (int i = 0; i < numArguments; i++)
+			allocateRegister();
+
+		for (int i = 0; i < numArguments; i++)
+			compileExpression(arguments[i], first + i);
+
+		return first;
+	}
+
+	void compileExpression(const Expression* e, int dst)
+	{
+		const int mark = numUsedRegisters;
+
+		if (auto lv = dynamic_cast<const LiteralValue*>(e))
+		{
+			emit(BF::LoadConstant, dst, 0, 0, addConstant(lv->value));
+		}
+		else if (auto ac = dynamic_cast<const ApiConstant*>(e))
+		{
+			emit(BF::LoadConstant, dst, 0, 0, addConstant(ac->value));
+		}
+		else if (auto rn = dynamic_cast<const RegisterName*>(e))
+		{
+			emit(BF::LoadPointer, dst, 0, 0, addPointer(rn->data));
+		}
+		else if (auto cp = dynamic_cast<const CallbackParameterReference*>(e))
+		{
+			emit(BF::LoadPointer, dst, 0, 0, addPointer(cp->data));
+		}
+		else if (auto lr = dynamic_cast<const LocalReference*>(e))
+		{
+			emit(BF::LoadPointer, dst, 0, 0, addPointer(lr->getSlotPointer()));
+		}
+		else if (auto cl = dynamic_cast<const CallbackLocalReference*>(e))
+		{
+			emit(BF::LoadPointer, dst, 0, 0, addPointer(cl->getSlotPointer()));
+		}
+		else if (dynamic_cast<const ConstReference*>(e) != nullptr)
+		{
+			emit(BF::LoadConst, dst, 0, 0, addNode(e));
+		}
+		else if (dynamic_cast<const InlineFunction::ParameterReference*>(e) != nullptr)
+		{
+			emit(BF::LoadParameter, dst, 0, 0, addNode(e));
+		}
+		else if (auto ra = dynamic_cast<const RegisterAssignment*>(e))
+		{
+			compileExpression(ra->source, dst);
+
+			if (isPositiveAndBelow(ra->registerIndex, NUM_VAR_REGISTERS))
+				emit(BF::StorePointer, 0, dst, 0, addPointer(root->hiseSpecialData.varRegister.getVarPointer(ra->registerIndex)));
+		}
+		else if (auto pa = dynamic_cast<const PostAssignment*>(e))
+		{
+			const int newValue = allocateRegister();
+			compileExpression(pa->target, dst);
+			compileExpression(pa->newValue, newValue);
+			compileStore(pa->target, newValue);
+		}
+		else if (auto sa = dynamic_cast<const SelfAssignment*>(e))
+		{
+			compileExpression(sa->newValue, dst);
+			compileStore(sa->target, dst);
+		}
+		else if (auto as = dynamic_cast<const Assignment*>(e))
+		{
+			compileExpression(as->newValue, dst);
+			compileStore(as->target, dst);
+		}
+		else if (auto la = dynamic_cast<const LogicalAndOp*>(e))
+		{
+			compileExpression(la->lhs, dst);
+			const int jumpToFalse = emit(BF::JumpIfFalse, 0, dst, 0, -1);
+			compileExpression(la->rhs, dst);
+			emit(BF::ToBool, dst, 0, 0, 0);
+			const int jumpToEnd = emit(BF::Jump, 0, 0, 0, -1);
+			patchJump(jumpToFalse, getPosition());
+			emit(BF::LoadBool, dst, 0, 0, 0);
+			patchJump(jumpToEnd, getPosition());
+		}
+		else if (auto lo = dynamic_cast<const LogicalOrOp*>(e))
+		{
+			compileExpression(lo->lhs, dst);
+			const int jumpToRhs = emit(BF::JumpIfFalse, 0, dst, 0, -1);
+			emit(BF::LoadBool, dst, 0, 0, 1);
+			const int jumpToEnd = emit(BF::Jump, 0, 0, 0, -1);
+			patchJump(jumpToRhs, getPosition());
+			compileExpression(lo->rhs, dst);
+			emit(BF::ToBool, dst, 0, 0, 0);
+			patchJump(jumpToEnd, getPosition());
+		}
+		else if (auto co = dynamic_cast<const ConditionalOp*>(e))
+		{
+			compileExpression(co->condition, dst);
+			const int jumpToFalse = emit(BF::JumpIfFalse, 0, dst, 0, -1);
+			compileExpression(co->trueBranch, dst);
+			const int jumpToEnd = emit(BF::Jump, 0, 0, 0, -1);
+			patchJump(jumpToFalse, getPosition());
+			compileExpression(co->falseBranch, dst);
+			patchJump(jumpToEnd, getPosition());
+		}
+		else if (auto bo = dynamic_cast<const BinaryOperatorBase*>(e))
+		{
+			const int op = getBinaryOpCode(e);
+
+			if (op == -1)
+			{
+				emit(BF::EvalTree, dst, 0, 0, addNode(e));
+			}
+			else
+			{
+				const int b = allocateRegister();
+				compileExpression(bo->lhs, dst);
+				compileExpression(bo->rhs, b);
+				emit(op, dst, dst, b, addNode(e));
+			}
+		}
+		else if (auto call = dynamic_cast<const ApiCall*>(e))
+		{
+			const int first = compileArguments(call->argumentList, call->expectedNumArguments);
+			emit(BF::CallApi, dst, first, call->expectedNumArguments, addNode(e));
+		}
+		else if (auto cc = dynamic_cast<const ConstObjectApiCall*>(e))
+		{
+			int numArguments = 0;
+
+			while (numArguments < 4 && cc->argumentList[numArguments] != nullptr)
+				numArguments++;
+
+			const int first = compileArguments(cc->argumentList, numArguments);
+			emit(BF::CallConstObject, dst, first, numArguments, addNode(e));
+		}
+		else if (auto ic = dynamic_cast<const InlineFunction::FunctionCall*>(e))
+		{
+			const int first = numUsedRegisters;
+
+			for (int i = 0; i < ic->numArgs; i++)
+				allocateRegister();
+
+			for (int i = 0; i < ic->numArgs; i++)
+				compileExpression(ic->parameterExpressions.getUnchecked(i), first + i);
+
+			emit(BF::CallInline, dst, first, ic->numArgs, addNode(e));
+		}
+		else
+		{
+			emit(BF::EvalTree, dst, 0, 0, addNode(e));
+		}
+
+		releaseRegisters(mark);
+	}
+
+	RootObject* root;
+	BytecodeFunction* f;
+
+	Array<LoopTargets*> loops;
+
+	int numUsedRegisters = 0;
+	int maxRegisters = 0;
+	bool failed = false;
+};
+
+namespace BytecodeOps
+{
+	typedef HiseJavascriptEngine::RootObject RO;
+	typedef RO::BytecodeFunction::Register Reg;
+
+	struct Add			{ static void ints(Reg& r, int64 a, int64 b) { r.setInt64(a + b); } static void doubles(Reg& r, double a, double b) { r.setDouble(a + b); } };
+	struct Subtract		{ static void ints(Reg& r, int64 a, int64 b) { r.setInt64(a - b); } static void doubles(Reg& r, double a, double b) { r.setDouble(a - b); } };
+	struct Multiply		{ static void ints(Reg& r, int64 a, int64 b) { r.setInt64(a * b); } static void doubles(Reg& r, double a, double b) { r.setDouble(a * b); } };
+	struct Divide		{ static void ints(Reg& r, int64 a, int64 b) { r.setDouble(b != 0 ? a / (double)b : std::numeric_limits<double>::infinity()); }
+						  static void doubles(Reg& r, double a, double b) { r.setDouble(b != 0 ? a / b : std::numeric_limits<double>::infinity()); } };
+	struct Modulo		{ static void ints(Reg& r, int64 a, int64 b) { if (b != 0) r.setInt64(a % b); else r.setDouble(std::numeric_limits<double>::infinity()); } };
+	struct BitwiseOr	{ static void ints(Reg& r, int64 a, int64 b) { r.setInt64(a | b); } };
+	struct BitwiseAnd	{ static void ints(Reg& r, int64 a, int64 b) { r.setInt64(a & b); } };
+	struct BitwiseXor	{ static void ints(Reg& r, int64 a, int64 b) { r.setInt64(a ^ b); } };
+	struct LeftShift	{ static void ints(Reg& r, int64 a, int64 b) { r.setInt(((int)a) << (int)b); } };
+	struct RightShift	{ static void ints(Reg& r, int64 a, int64 b) { r.setInt(((int)a) >> (int)b); } };
+	struct RightShiftUnsigned { static void ints(Reg& r, int64 a, int64 b) { r.setInt((int)(((uint32)a) >> (int)b)); } };
+	struct Equals		{ static void ints(Reg& r, int64 a, int64 b) { r.setBool(a == b); } static void doubles(Reg& r, double a, double b) { r.setBool(a == b); } };
+	struct NotEquals	{ static void ints(Reg& r, int64 a, int64 b) { r.setBool(a != b); } static void doubles(Reg& r, double a, double b) { r.setBool(a != b); } };
+	struct LessThan		{ static void ints(Reg& r, int64 a, int64 b) { r.setBool(a < b); } static void doubles(Reg& r, double a, double b) { r.setBool(a < b); } };
+	struct LessThanOrEqual { static void ints(Reg& r, int64 a, int64 b) { r.setBool(a <= b); } static void doubles(Reg& r, double a, double b) { r.setBool(a <= b); } };
+	struct GreaterThan	{ static void ints(Reg& r, int64 a, int64 b) { r.setBool(a > b); } static void doubles(Reg& r, double a, double b) { r.setBool(a > b); } };
+	struct GreaterThanOrEqual { static void ints(Reg& r, int64 a, int64 b) { r.setBool(a >= b); } static void doubles(Reg& r, double a, double b) { r.setBool(a >= b); } };
+
+	/** The slow path for all other types (see BinaryOperator::getResult()). */
+	static void evaluate(Reg& dst, const Reg& a, const Reg& b, const RO::Statement* node, const RO::Scope& s)
+	{
+		auto op = static_cast<const RO::BinaryOperator*>(node);
+
+		dst.set(op->evaluate(a.get(), b.get()));
+
+		if (dst.type == Reg::Object && dst.value.isString())
+			s.root->allocationTracker.report(op->location, "String operation");
+	}
+
+	/** The numeric fast path of BinaryOperator::evaluate() for operators that support doubles. */
+	template <class Op> forcedinline void numeric(Reg& dst, const Reg& a, const Reg& b, const RO::Statement* node, const RO::Scope& s)
+	{
+		if (a.isNumeric() && b.isNumeric())
+		{
+			if (a.isDouble() || b.isDouble())
+				Op::doubles(dst, a.toDouble(), b.toDouble());
+			else
+				Op::ints(dst, a.toInt64(), b.toInt64());
+		}
+		else
+			evaluate(dst, a, b, node, s);
+	}
+
+	/** The numeric fast path for operators that only support integers. */
+	template <class Op> forcedinline void integer(Reg& dst, const Reg& a, const Reg& b, const RO::Statement* node, const RO::Scope& s)
+	{
+		if (a.isNumeric() && b.isNumeric() && !a.isDouble() && !b.isDouble())
+			Op::ints(dst, a.toInt64(), b.toInt64());
+		else
+			evaluate(dst, a, b, node, s);
+	}
+}
+
+HiseJavascriptEngine::RootObject::Statement::ResultCode HiseJavascriptEngine::RootObject::BytecodeFunction::run(const Scope& s, var* returnedValue) const
+{
+	bool wasRunning = false;
+
+	if (!running.compare_exchange_strong(wasRunning, true))
+		return source->perform(s, returnedValue);
+
+	struct ScopedRegisterCleaner
+	{
+		ScopedRegisterCleaner(const BytecodeFunction& f_) : f(f_) {}
+
+		~ScopedRegisterCleaner()
+		{
+			for (auto& r : f.registers)
+				r.clear();
+
+			f.running = false;
+		}
+
+		const BytecodeFunction& f;
+	};
+
+	ScopedRegisterCleaner src(*this);
+
+	Register* r = registers.getRawDataPointer();
+	const Instruction* code = instructions.begin();
+	const Statement* const* n = nodes.begin();
+
+	var args[5];
+	int pc = 0;
+
+	using namespace BytecodeOps;
+
+	for (;;)
+	{
+		const Instruction& i = code[pc++];
+
+		switch (i.op)
+		{
+		case LoadConstant:		r[i.dst].setFrom(constants.getReference(i.imm)); break;
+		case LoadPointer:		r[i.dst].set(*pointers.getUnchecked(i.imm)); break;
+		case StorePointer:		*pointers.getUnchecked(i.imm) = r[i.a].get(); break;
+		case LoadConst:
+		{
+			auto cr = static_cast<const ConstReference*>(n[i.imm]);
+			r[i.dst].set(cr->ns->constObjects.getValueAt(cr->index));
+			break;
+		}
+		case LoadParameter:
+		{
+			auto pr = static_cast<const InlineFunction::ParameterReference*>(n[i.imm]);
+
+			if (pr->f->e == nullptr)
+				pr->location.throwError("Accessing parameter reference outside the function call");
+
+			r[i.dst].set(pr->f->e->parameterResults.getReference(pr->index));
+			break;
+		}
+		case Add:					numeric<BytecodeOps::Add>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case Subtract:				numeric<BytecodeOps::Subtract>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case Multiply:				numeric<BytecodeOps::Multiply>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case Divide:				numeric<BytecodeOps::Divide>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case Modulo:				integer<BytecodeOps::Modulo>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case BitwiseOr:				integer<BytecodeOps::BitwiseOr>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case BitwiseAnd:			integer<BytecodeOps::BitwiseAnd>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case BitwiseXor:			integer<BytecodeOps::BitwiseXor>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case LeftShift:				integer<BytecodeOps::LeftShift>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case RightShift:			integer<BytecodeOps::RightShift>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case RightShiftUnsigned:	integer<BytecodeOps::RightShiftUnsigned>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case Equals:				numeric<BytecodeOps::Equals>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case NotEquals:				numeric<BytecodeOps::NotEquals>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case LessThan:				numeric<BytecodeOps::LessThan>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case LessThanOrEqual:		numeric<BytecodeOps::LessThanOrEqual>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case GreaterThan:			numeric<BytecodeOps::GreaterThan>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case GreaterThanOrEqual:	numeric<BytecodeOps::GreaterThanOrEqual>(r[i.dst], r[i.a], r[i.b], n[i.imm], s); break;
+		case TypeEquals:			r[i.dst].setBool(areTypeEqual(r[i.a].get(), r[i.b].get())); break;
+		case TypeNotEquals:			r[i.dst].setBool(!areTypeEqual(r[i.a].get(), r[i.b].get())); break;
+		case ToBool:				r[i.dst].setBool(r[i.dst].toBool()); break;
+		case LoadBool:				r[i.dst].setBool(i.imm != 0); break;
+		case Jump:					pc = i.imm; break;
+		case JumpIfFalse:			if (!r[i.a].toBool()) pc = i.imm; break;
+		case CallApi:
+		{
+			auto call = static_cast<const ApiCall*>(n[i.imm]);
+
+			for (int k = 0; k < i.b; k++)
+			{
+				args[k] = r[i.a + k].get();
+				HiseJavascriptEngine::checkValidParameter(k, args[k], call->location);
+			}
+
+			r[i.dst].set(call->callWithArguments(args));
+			break;
+		}
+		case CallConstObject:
+		{
+			auto call = static_cast<const ConstObjectApiCall*>(n[i.imm]);
+
+			call->initialise();
+
+			if (call->expectedNumArguments != i.b)
+				call->location.throwError("Call to " + call->functionName.toString() + "(): argument number mismatch : " + String(i.b) + " (Expected : " + String(call->expectedNumArguments) + ")");
+
+			for (int k = 0; k < i.b; k++)
+			{
+				args[k] = r[i.a + k].get();
+				HiseJavascriptEngine::checkValidParameter(k, args[k], call->location);
+			}
+
+			r[i.dst].set(call->callWithArguments(args));
+			break;
+		}
+		case CallInline:
+		{
+			auto call = static_cast<const InlineFunction::FunctionCall*>(n[i.imm]);
+
+			call->f->setFunctionCall(call);
+
+			for (int k = 0; k < i.b; k++)
+				call->parameterResults.setUnchecked(k, r[i.a + k].get());
+
+			r[i.dst].set(call->performCall(s));
+			break;
+		}
+		case EvalTree:		r[i.dst].set(static_cast<const Expression*>(n[i.imm])->getResult(s)); break;
+		case AssignTree:	static_cast<const Expression*>(n[i.imm])->assign(s, r[i.a].get()); break;
+		case PerformTree:
+		{
+			const auto& tc = treeCalls.getReference(i.imm);
+			const Statement::ResultCode rc = tc.statement->perform(s, returnedValue);
+
+			if (rc == Statement::ok)
+				break;
+
+			if (rc == Statement::breakWasHit && tc.breakTarget != -1)
+				pc = tc.breakTarget;
+			else if (rc == Statement::continueWasHit && tc.continueTarget != -1)
+				pc = tc.continueTarget;
+			else
+				return rc;
+
+			break;
+		}
+		case CheckTimeout:	s.checkTimeOut(n[i.imm]->location); break;
+		case Return:
+		{
+			if (returnedValue != nullptr)
+				*returnedValue = r[i.a].get();
+
+			return Statement::returnWasHit;
+		}
+		case ReturnCode:	return (Statement::ResultCode)i.imm;
+		default:			jassertfalse; return Statement::ok;
+		}
+	}
+}
+
+void HiseJavascriptEngine::RootObject::Callback::compileBytecode(RootObject* root)
+{
+#if HISE_USE_SCRIPT_BYTECODE
+	if (bytecode == nullptr && statements != nullptr && isCallbackDefined)
+		bytecode = BytecodeCompiler::compile(root, statements);
+#else
+	ignoreUnused(root);
+#endif
+}
+
+void HiseJavascriptEngine::RootObject::Callback::performStatements(const Scope& s, var* returnValue)
+{
+	if (bytecode != nullptr && s.root->isUsingBytecode())
+		bytecode->run(s, returnValue);
+	else
+		statements->perform(s, returnValue);
+}
+
+HiseJavascriptEngine::RootObject::Statement::ResultCode HiseJavascriptEngine::RootObject::InlineFunction::Object::performBody(const Scope& s, var* returnValue)
+{
+	if (bytecode != nullptr && s.root->isUsingBytecode())
+		return bytecode->run(s, returnValue);
+
+	return body->perform(s, returnValue);
+}
+
+void HiseJavascriptEngine::RootObject::compileBytecode()
+{
+#if HISE_USE_SCRIPT_BYTECODE
+	for (auto c : hiseSpecialData.callbackNEW)
+		c->compileBytecode(this);
+
+	auto compileInlineFunctions = [this](JavascriptNamespace* ns)
+	{
+		for (auto o : ns->inlineFunctions)
+		{
+			auto f = dynamic_cast<InlineFunction::Object*>(o);
+
+			if (f != nullptr && f->bytecode == nullptr && f->body != nullptr)
+				f->bytecode = BytecodeCompiler::compile(this, f->body);
+		}
+	};
+
+	compileInlineFunctions(&hiseSpecialData);
+
+	for (auto ns : hiseSpecialData.namespaces)
+		compileInlineFunctions(ns);
+#endif
+}
+
+} // namespace hise
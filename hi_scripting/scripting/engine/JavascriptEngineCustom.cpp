@@ -95,6 +95,12 @@ struct HiseJavascriptEngine::RootObject::ApiCall : public Expression
 			HiseJavascriptEngine::checkValidParameter(i, results[i], location);
 		}
 
+		return callWithArguments(results);
+	}
+
+	/** Calls the API function with the already evaluated arguments. */
+	var callWithArguments(var* results) const
+	{
 		CHECK_CONDITION_WITH_LOCATION(apiClass != nullptr, "API class does not exist");
 
 		try
@@ -134,6 +140,22 @@ struct HiseJavascriptEngine::RootObject::ConstObjectApiCall : public Expression
 	};
 
 	var getResult(const Scope& s) const override
+	{
+		initialise();
+
+		var results[5];
+
+		for (int i = 0; i < expectedNumArguments; i++)
+		{
+			results[i] = argumentList[i]->getResult(s);
+
+			HiseJavascriptEngine::checkValidParameter(i, results[i], location);
+		}
+
+		return callWithArguments(results);
+	}
+
+	void initialise() const
 	{
 		if (!initialised)
 		{
@@ -149,16 +171,11 @@ struct HiseJavascriptEngine::RootObject::ConstObjectApiCall : public Expression
 
 			CHECK_CONDITION_WITH_LOCATION(functionIndex != -1, "function " + functionName.toString() + " not found.");
 		}
+	}
 
-		var results[5];
-
-		for (int i = 0; i < expectedNumArguments; i++)
-		{
-			results[i] = argumentList[i]->getResult(s);
-
-			HiseJavascriptEngine::checkValidParameter(i, results[i], location);
-		}
-
+	/** Calls the function with the already evaluated arguments. Call initialise() before this. */
+	var callWithArguments(var* results) const
+	{
 		CHECK_CONDITION_WITH_LOCATION(object != nullptr, "Object does not exist");
 
 		return object->callFunction(functionIndex, results, expectedNumArguments);
@@ -233,6 +250,7 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 		~Object()
 		{
 			parameterNames.clear();
+			bytecode = nullptr;
 			body = nullptr;
 			dynamicFunctionCall = nullptr;
 		}
@@ -315,7 +333,7 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 				dynamicFunctionCall->parameterResults.setUnchecked(i, args[i]);
 			}
 
-			Statement::ResultCode c = body->perform(s, &lastReturnValue);
+			Statement::ResultCode c = performBody(s, &lastReturnValue);
 
 			cleanUpAfterExecution();
 
@@ -323,6 +341,9 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 			else return var::undefined();
 		}
 
+		/** Runs the body as bytecode if it was compiled. */
+		Statement::ResultCode performBody(const Scope& s, var* returnValue);
+
 		void cleanLocalProperties()
 		{
 #if ENABLE_SCRIPTING_SAFE_CHECKS
@@ -343,6 +364,7 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 		Array<Identifier> parameterNames;
 		typedef ReferenceCountedObjectPtr<Object> Ptr;
 		ScopedPointer<BlockStatement> body;
+		ScopedPointer<BytecodeFunction> bytecode;
 
 		String functionDef;
 		String commentDoc;
@@ -396,18 +418,25 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 
 		var getResult(const Scope& s) const override
 		{
-			f->setFunctionCall(this);
-
 			for (int i = 0; i < numArgs; i++)
 			{
 				parameterResults.setUnchecked(i, parameterExpressions.getUnchecked(i)->getResult(s));
 			}
 
+			// Set this after the arguments, a call to the same function in the arguments resets it
+			f->setFunctionCall(this);
+
+			return performCall(s);
+		}
+
+		/** Runs the function with the parameter values that were set before. */
+		var performCall(const Scope& s) const
+		{
 			s.root->addToCallStack(f->name, &location);
 
 			try
 			{
-				ResultCode c = f->body->perform(s, &returnVar);
+				ResultCode c = f->performBody(s, &returnVar);
 
 				s.root->removeFromCallStack(f->name);
 
@@ -525,31 +554,41 @@ struct HiseJavascriptEngine::RootObject::LocalVarStatement : public Statement
 
 	ResultCode perform(const Scope& s, var*) const override
 	{
-		parentFunction->localProperties.set(name, initialiser->getResult(s));
+		*parentFunction->localProperties.getVarPointerAt(index) = initialiser->getResult(s);
 		return ok;
 	}
 
 	mutable InlineFunction::Object* parentFunction;
 	Identifier name;
 	ExpPtr initialiser;
+
+	int index = -1;
 };
 
 
 
 struct HiseJavascriptEngine::RootObject::LocalReference : public Expression
 {
-	LocalReference(const CodeLocation& l, InlineFunction::Object *parentFunction_, const Identifier &id_) noexcept : Expression(l), parentFunction(parentFunction_), id(id_) {}
+	LocalReference(const CodeLocation& l, InlineFunction::Object *parentFunction_, const Identifier &id_, int index_) noexcept : 
+	  Expression(l), 
+	  parentFunction(parentFunction_), 
+	  id(id_),
+	  index(index_)
+	{}
 
 	var getResult(const Scope& /*s*/) const override
 	{
-		return parentFunction->localProperties[id];
+		return *getSlotPointer();
 	}
 
 	void assign(const Scope& /*s*/, const var& newValue) const override
 	{
-		parentFunction->localProperties.set(id, newValue);
+		*getSlotPointer() = newValue;
 	}
 
+	/** The locals are added while parsing so the slot stays valid as long as the function exists. */
+	var* getSlotPointer() const noexcept { return parentFunction->localProperties.getVarPointerAt(index); }
+
 	InlineFunction::Object* parentFunction;
 	const Identifier id;
 
@@ -576,37 +615,42 @@ struct HiseJavascriptEngine::RootObject::CallbackLocalStatement : public Stateme
 
 	ResultCode perform(const Scope& s, var*) const override
 	{
-		parentCallback->localProperties.set(name, initialiser->getResult(s));
+		*parentCallback->localProperties.getVarPointerAt(index) = initialiser->getResult(s);
 		return ok;
 	}
 
 	mutable Callback* parentCallback;
 	Identifier name;
 	ExpPtr initialiser;
+
+	int index = -1;
 };
 
 struct HiseJavascriptEngine::RootObject::CallbackLocalReference : public Expression
 {
-	CallbackLocalReference(const CodeLocation& l, Callback* parent_, const Identifier& name_) noexcept : 
+	CallbackLocalReference(const CodeLocation& l, Callback* parent_, const Identifier& name_, int index_) noexcept : 
 	Expression(l), 
 	parentCallback(parent_),
-	name(name_)
+	name(name_),
+	index(index_)
 	{}
 
 	var getResult(const Scope& /*s*/) const override
 	{
-		return parentCallback->localProperties[name];
+		return *getSlotPointer();
 	}
 
 	void assign(const Scope& /*s*/, const var& newValue) const
 	{ 
-		parentCallback->localProperties.set(name, newValue);
+		*getSlotPointer() = newValue;
 	}
 
+	var* getSlotPointer() const noexcept { return parentCallback->localProperties.getVarPointerAt(index); }
+
 	Callback* parentCallback;
 	Identifier name;
 
-	CallbackLocalStatement* target;
+	int index;
 };
 
 #if INCLUDE_NATIVE_JIT
@@ -11,10 +11,22 @@ struct HiseJavascriptEngine::RootObject::UnqualifiedName : public Expression
 {
 	UnqualifiedName(const CodeLocation& l, const Identifier& n, bool isFunction) noexcept : Expression(l), name(n), allowUnqualifiedDefinition(isFunction) {}
 
-	var getResult(const Scope& s) const override  { return s.findSymbolInParentScopes(name); }
+	var getResult(const Scope& s) const override
+	{
+		if (auto v = getSlotPointer(s))
+			return *v;
+
+		return s.findSymbolInParentScopes(name);
+	}
 
 	void assign(const Scope& s, const var& newValue) const override
 	{
+		if (auto v = getSlotPointer(s))
+		{
+			*v = newValue;
+			return;
+		}
+
 		const Scope* currentScope = &s;
 		var* v = getPropertyPointer(currentScope->scope, name);
 
@@ -44,10 +56,27 @@ struct HiseJavascriptEngine::RootObject::UnqualifiedName : public Expression
 			
 	}
 
+	/** Returns the root property at the resolved slot if this is evaluated in the root scope (callbacks and inline functions). */
+	var* getSlotPointer(const Scope& s) const noexcept
+	{
+		if (s.parent != nullptr || s.scope.get() != s.root.get())
+			return nullptr;
+
+		const NamedValueSet& properties = s.root->getProperties();
+
+		// The variable was defined after the slots were resolved or a property was removed from the root
+		if (!isPositiveAndBelow(slotIndex, properties.size()) || properties.getName(slotIndex) != name)
+			slotIndex = properties.indexOf(name);
+
+		return slotIndex != -1 ? properties.getVarPointerAt(slotIndex) : nullptr;
+	}
+
 	bool allowUnqualifiedDefinition = false;
 
 	JavascriptNamespace* ns = nullptr;
 	Identifier name;
+
+	mutable int slotIndex = -1;
 };
 
 
@@ -101,6 +130,8 @@ struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
             
             if(name.isNotEmpty())
             {
+                s.root->allocationTracker.report(location, "Dynamic property access");
+
                 return obj->getProperty(Identifier(name));
             }
             
@@ -143,6 +174,8 @@ struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
         else if (DynamicObject* obj = result.getDynamicObject())
         {
             const String name = index->getResult(s).toString();
+
+            s.root->allocationTracker.report(location, "Dynamic property access");
                      
             return obj->setProperty(Identifier(name), newValue);
         }
@@ -303,17 +336,65 @@ struct HiseJavascriptEngine::RootObject::ObjectDeclaration : public Expression
 	ObjectDeclaration(const CodeLocation& l) noexcept : Expression(l) {}
 
 	var getResult(const Scope& s) const override
+	{
+		// The cache is only touched by the thread that runs the audio callback with the allocation check,
+		// a callback on another thread (eg. onControl) creates a new object.
+		if (s.root->isAudioThreadSafeMode() && s.root->allocationTracker.isActiveOnThisThread())
+		{
+			if (canReuseLastObject())
+			{
+				// Keeps the reference count up if the initialisers evaluate this declaration again
+				DynamicObject::Ptr reusedObject(lastObject);
+
+				for (int i = 0; i < names.size(); ++i)
+					*reusedObject->getProperties().getVarPointerAt(i) = initialisers.getUnchecked(i)->getResult(s);
+
+				return reusedObject.get();
+			}
+
+			s.root->allocationTracker.report(location, "Creating an object");
+
+			lastObject = createObject(s);
+			return lastObject.get();
+		}
+
+		return createObject(s).get();
+	}
+
+	DynamicObject::Ptr createObject(const Scope& s) const
 	{
 		DynamicObject::Ptr newObject(new DynamicObject());
 
 		for (int i = 0; i < names.size(); ++i)
 			newObject->setProperty(names.getUnchecked(i), initialisers.getUnchecked(i)->getResult(s));
 
-		return newObject.get();
+		return newObject;
+	}
+
+	/** The last object can be refilled if nothing else holds a reference and the script didn't change its properties. */
+	bool canReuseLastObject() const noexcept
+	{
+		if (lastObject == nullptr || lastObject->getReferenceCount() != 1)
+			return false;
+
+		const NamedValueSet& properties = lastObject->getProperties();
+
+		if (properties.size() != names.size())
+			return false;
+
+		for (int i = 0; i < names.size(); ++i)
+		{
+			if (properties.getName(i) != names.getUnchecked(i))
+				return false;
+		}
+
+		return true;
 	}
 
 	Array<Identifier> names;
 	OwnedArray<Expression> initialisers;
+
+	mutable DynamicObject::Ptr lastObject;
 };
 
 struct HiseJavascriptEngine::RootObject::ArrayDeclaration : public Expression
@@ -321,6 +402,34 @@ struct HiseJavascriptEngine::RootObject::ArrayDeclaration : public Expression
 	ArrayDeclaration(const CodeLocation& l) noexcept : Expression(l) {}
 
 	var getResult(const Scope& s) const override
+	{
+		// Same as ObjectDeclaration: only the thread that owns the allocation check may use the cache
+		if (s.root->isAudioThreadSafeMode() && s.root->allocationTracker.isActiveOnThisThread())
+		{
+			// The last array can be refilled without allocating if nothing else holds a reference
+			if (lastArray.getArrayReferenceCount() == 1)
+			{
+				var reusedArray(lastArray);
+				Array<var>* a = reusedArray.getArray();
+
+				a->clearQuick();
+
+				for (int i = 0; i < values.size(); ++i)
+					a->add(values.getUnchecked(i)->getResult(s));
+
+				return reusedArray;
+			}
+
+			s.root->allocationTracker.report(location, "Creating an array");
+
+			lastArray = createArray(s);
+			return lastArray;
+		}
+
+		return createArray(s);
+	}
+
+	var createArray(const Scope& s) const
 	{
 		Array<var> a;
 
@@ -331,6 +440,8 @@ struct HiseJavascriptEngine::RootObject::ArrayDeclaration : public Expression
 	}
 
 	OwnedArray<Expression> values;
+
+	mutable var lastArray;
 };
 
 //==============================================================================
@@ -355,6 +466,8 @@ struct HiseJavascriptEngine::RootObject::FunctionObject : public DynamicObject,
 
 	var invoke(const Scope& s, const var::NativeFunctionArgs& args) const
 	{
+		s.root->allocationTracker.report(body->location, "Creating the function scope");
+
 		DynamicObject::Ptr functionRoot(new DynamicObject());
 
 		static const Identifier thisIdent("this");
@@ -24,6 +24,17 @@ struct HiseJavascriptEngine::RootObject::BinaryOperator : public BinaryOperatorB
 	{
 		var a(lhs->getResult(s)), b(rhs->getResult(s));
 
+		var result = evaluate(a, b);
+
+		if (result.isString())
+			s.root->allocationTracker.report(location, "String operation");
+
+		return result;
+	}
+
+	/** Applies the operator to the already evaluated operands. */
+	var evaluate(const var& a, const var& b) const
+	{
 		if (isNumericOrUndefined(a) && isNumericOrUndefined(b))
 			return (a.isDouble() || b.isDouble()) ? getWithDoubles(a, b) : getWithInts(a, b);
 
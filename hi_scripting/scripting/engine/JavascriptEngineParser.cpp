@@ -942,6 +942,7 @@ private:
 			hiseSpecialData->checkIfExistsInOtherStorage(HiseSpecialData::VariableStorageType::LocalScope, s->name, location);
 
 			ifo->localProperties.set(s->name, var::undefined());
+			s->index = ifo->localProperties.indexOf(s->name);
 
 			s->initialiser = matchIf(TokenTypes::assign) ? parseExpression() : new Expression(location);
 
@@ -966,6 +967,7 @@ private:
 			hiseSpecialData->checkIfExistsInOtherStorage(HiseSpecialData::VariableStorageType::LocalScope, s->name, location);
 
 			callback->localProperties.set(s->name, var());
+			s->index = callback->localProperties.indexOf(s->name);
 
 			s->initialiser = matchIf(TokenTypes::assign) ? parseExpression() : new Expression(location);
 
@@ -1778,7 +1780,7 @@ private:
 				if (localParameterIndex >= 0)
 				{
 					parseIdentifier();
-					return parseSuffixes(new LocalReference(location, ob, id));
+					return parseSuffixes(new LocalReference(location, ob, id, localParameterIndex));
 				}
 			}
 
@@ -1856,13 +1858,13 @@ private:
 								return parseSuffixes(new CallbackParameterReference(location, callbackParameter));
 							}
 
-							var* localParameter = c->localProperties.getVarPointer(id);
+							const int localIndex = c->localProperties.indexOf(id);
 
-							if (localParameter != nullptr)
+							if (localIndex != -1)
 							{
 								auto name = parseIdentifier();
 
-								return parseSuffixes(new CallbackLocalReference(location, c, name));
+								return parseSuffixes(new CallbackLocalReference(location, c, name, localIndex));
 							}
 						}
 						else
@@ -1871,7 +1873,14 @@ private:
 						}
 					}
 
-					return parseSuffixes(new UnqualifiedName(location, parseIdentifier(), false));
+					ScopedPointer<UnqualifiedName> un = new UnqualifiedName(location, parseIdentifier(), false);
+
+					// The callbacks and inline functions are called with the root scope (the slot is
+					// checked when evaluated), so the name can be resolved once the onInit call defined it
+					if (currentInlineFunction != nullptr || !currentlyParsedCallback.isNull())
+						hiseSpecialData->unresolvedNames.add(un);
+
+					return parseSuffixes(un.release());
 				}
 			}
 		}
@@ -2366,12 +2375,28 @@ void HiseJavascriptEngine::RootObject::execute(const String& code, bool allowCon
 
 	tb.setupApiData(hiseSpecialData, allowConstDeclarations ? code : String());
 
+	// Names from a previous call that threw a parse error
+	hiseSpecialData.unresolvedNames.clear();
+
 	auto sl = ScopedPointer<BlockStatement>(tb.parseStatementList());
 	
 	if(shouldUseCycleCheck)
 		prepareCycleReferenceCheck();
 
 	sl->perform(Scope(nullptr, this, this), nullptr);
+
+	resolveSlots();
+	compileBytecode();
+}
+
+void HiseJavascriptEngine::RootObject::resolveSlots()
+{
+	const NamedValueSet& properties = getProperties();
+
+	for (auto un : hiseSpecialData.unresolvedNames)
+		un->slotIndex = properties.indexOf(un->name);
+
+	hiseSpecialData.unresolvedNames.clear();
 }
 
 HiseJavascriptEngine::RootObject::FunctionObject::FunctionObject(const FunctionObject& other) : DynamicObject(), functionCode(other.functionCode)
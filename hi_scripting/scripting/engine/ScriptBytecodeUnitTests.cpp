@@ -0,0 +1,317 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#include "AppConfig.h"
+
+#if HI_RUN_UNIT_TESTS
+
+#include  "JuceHeader.h"
+
+namespace hise { using namespace juce;
+
+class ScriptBytecodeUnitTest : public UnitTest
+{
+public:
+
+	ScriptBytecodeUnitTest() :
+		UnitTest("Testing the script bytecode VM")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testOperators();
+		testControlFlow();
+		testInlineFunctions();
+		testSlotResolution();
+		testTreeFallback();
+		testAllocationCheck();
+		testTimeout();
+	}
+
+private:
+
+	struct TestEngine
+	{
+		TestEngine(const String& code, bool useBytecode) :
+			engine(nullptr)
+		{
+			engine.registerGlobalStorge(new DynamicObject());
+			engine.setUseBytecode(useBytecode);
+			engine.registerCallbackName("onNoteOn", 0, 0.0);
+
+			r = engine.execute(code);
+		}
+
+		var call()
+		{
+			Result callResult = Result::ok();
+			var v = engine.executeCallback(0, &callResult);
+			r = callResult;
+			return v;
+		}
+
+		HiseJavascriptEngine engine;
+		Result r = Result::ok();
+	};
+
+	static String getTestCode(const String& callbackBody)
+	{
+		return "reg r = 0;\n"
+			   "reg s = \"\";\n"
+			   "const var arr = [1, 2, 3];\n"
+			   "var rootVar = 4;\n"
+			   "inline function add(a, b) { return a + b; };\n"
+			   "inline function early(a) { if (a > 2) return \"big\"; for (i = 0; i < 10; i++) { if (i == a) return i * 10; } return -1; };\n"
+			   "inline function withLocal(a) { local t = a * 2; t += 1; return t; };\n"
+			   "function onNoteOn()\n{\n" + callbackBody + "\n}\n";
+	}
+
+	/** Runs the callback with and without bytecode and compares the results including the var type. */
+	void expectSameResult(const String& callbackBody, int numCalls = 3)
+	{
+		const String code = getTestCode(callbackBody);
+
+		TestEngine tree(code, false);
+		TestEngine bytecode(code, true);
+
+		expect(tree.r.wasOk(), tree.r.getErrorMessage());
+		expect(bytecode.r.wasOk(), bytecode.r.getErrorMessage());
+
+		for (int i = 0; i < numCalls; i++)
+		{
+			var expected = tree.call();
+			var actual = bytecode.call();
+
+			expect(tree.r.wasOk(), tree.r.getErrorMessage());
+			expect(bytecode.r.wasOk(), bytecode.r.getErrorMessage());
+
+			expectEquals(actual.toString(), expected.toString(), callbackBody);
+			expect(actual.hasSameTypeAs(expected), "Type mismatch: " + callbackBody);
+		}
+	}
+
+	void testOperators()
+	{
+		beginTest("Testing operators");
+
+		expectSameResult("return 1 + 2;");
+		expectSameResult("return 1.5 + 2;");
+		expectSameResult("return 7 / 2;");
+		expectSameResult("return 7 % 3;");
+		expectSameResult("return 1 / 0;");
+		expectSameResult("return (5 >> 1) + (1 << 4) + (5 & 3) + (5 | 3) + (5 ^ 3);");
+		expectSameResult("return -8 >>> 28;");
+		expectSameResult("return 1 < 2;");
+		expectSameResult("return 1 == 1.0;");
+		expectSameResult("return 1 === 1.0;");
+		expectSameResult("return 1 !== \"1\";");
+		expectSameResult("return true && 5;");
+		expectSameResult("return 0 || \"x\";");
+		expectSameResult("return r > 0 ? \"pos\" : \"neg\";");
+		expectSameResult("return !r;");
+		expectSameResult("return -r;");
+		expectSameResult("return \"a\" + 1 + 2.5;");
+		expectSameResult("return undefined + 1;");
+		expectSameResult("r++; r += 2; return r;");
+		expectSameResult("return r++;");
+		expectSameResult("s += \"x\"; return s;");
+		expectSameResult("return arr[1] + rootVar + Math.max(1, 3.5) + Math.round(2.6);");
+	}
+
+	void testControlFlow()
+	{
+		beginTest("Testing control flow");
+
+		expectSameResult("var k = 0; for (j = 0; j < 10; j++) { if (j == 2) continue; if (j == 7) break; k += j; } return k;");
+		expectSameResult("var k = 0; do { k++; if (k == 3) continue; if (k > 6) break; } while (k < 10); return k;");
+		expectSameResult("var k = 0; while (k < 5) k += 2; return k;");
+		expectSameResult("for (a = 0; a < 3; a++) { for (b = 0; b < 3; b++) { if (b == 1) break; r += 1; } } return r;");
+		expectSameResult("if (r > 2) { return 1; } else if (r > 1) { return 2; } return 3;");
+		expectSameResult("r = 0; for (j = 0; j < 100; j++) { if (j % 2 == 0) continue; r += j; } return r;");
+	}
+
+	void testInlineFunctions()
+	{
+		beginTest("Testing inline functions");
+
+		expectSameResult("return add(1, 2);");
+		expectSameResult("return add(\"a\", 1);");
+		expectSameResult("return add(add(1, 1), add(2, 2));");
+		expectSameResult("return early(1) + \",\" + early(5) + \",\" + early(2);");
+		expectSameResult("return withLocal(4);");
+
+		TestEngine withoutInlineFunctions("var x = 1;\nfunction onNoteOn()\n{\n}\n", true);
+		TestEngine withNamespacedInlineFunction("namespace N { inline function f() { return 1; }; }\nfunction onNoteOn()\n{\n}\n", true);
+
+		expect(TestEngine(getTestCode(""), true).engine.hasInlineFunctions(), "Inline functions in the root namespace");
+		expect(withNamespacedInlineFunction.engine.hasInlineFunctions(), "Inline function in a namespace");
+		expect(!withoutInlineFunctions.engine.hasInlineFunctions(), "No inline functions");
+	}
+
+	void testSlotResolution()
+	{
+		beginTest("Testing variable slots");
+
+		expectSameResult("rootVar += 1; return rootVar;");
+		expectSameResult("local a = 1; local b = a + 2; a = b * 2; return a + b;");
+		expectSameResult("local a; for (j = 0; j < 4; j++) a = j; return a;");
+		expectSameResult("return withLocal(2) + withLocal(3);");
+		expectSameResult("var late = 2; late += rootVar; return late;");
+	}
+
+	void testTreeFallback()
+	{
+		beginTest("Testing statements that fall back to the tree");
+
+		expectSameResult("var k = 0; for (x in arr) { k += x; if (x == 2) break; } return k;");
+		expectSameResult("local l = 3; switch (l) { case 1: return \"one\"; case 3: return \"three\"; default: return \"def\"; }");
+		expectSameResult("var k = 0; for (j = 0; j < 5; j++) { for (x in arr) { if (x == 2) break; k += x; } if (j == 3) break; } return k;");
+		expectSameResult("var o = { a: 1 }; o.a += 2; return o.a;");
+		expectSameResult("return typeof(r);");
+	}
+
+	/** Runs the callback in the audio thread safe mode and checks the allocations of the third call. */
+	void expectAllocations(const String& callbackBody, int expectedAllocations, const String& expectedResult)
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			TestEngine te(getTestCode(callbackBody), i == 1);
+			te.engine.setAudioThreadSafeMode(true);
+
+			expect(te.r.wasOk(), te.r.getErrorMessage());
+
+			HiseJavascriptEngine::RootObject::Error e;
+
+			// The audio callbacks always run with the allocation check, so the literals are cached
+			for (int j = 0; j < 2; j++)
+			{
+				te.engine.startAllocationCheck();
+				te.call();
+				te.engine.stopAllocationCheck(e);
+			}
+
+			te.engine.startAllocationCheck();
+			var result = te.call();
+			const int numAllocations = te.engine.stopAllocationCheck(e);
+
+			expect(te.r.wasOk(), te.r.getErrorMessage());
+			expectEquals(numAllocations, expectedAllocations, callbackBody + ": " + e.errorMessage);
+			expectEquals(result.toString(), expectedResult, callbackBody);
+		}
+	}
+
+	void testAllocationCheck()
+	{
+		beginTest("Testing the allocation check");
+
+		expectAllocations("r = r + 1; return r * 2;", 0, "6");
+		expectAllocations("local a = [1, 2, r]; r++; return a[0] + a[2];", 0, "3");
+		expectAllocations("local o = { x: 2, y: r }; r++; return o.x * o.y;", 0, "4");
+		expectAllocations("s = \"a\" + r; return s;", 1, "a0");
+		expectAllocations("rootVar = [r, 1]; r++; return rootVar[0];", 1, "2");
+
+		testLiteralCacheOwnership("return [r, 1];");
+		testLiteralCacheOwnership("return { x: r };");
+	}
+
+	/** Checks that a callback without the allocation check (eg. onControl on another thread) doesn't use the cached literal. */
+	void testLiteralCacheOwnership(const String& callbackBody)
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			TestEngine te(getTestCode(callbackBody), i == 1);
+			te.engine.setAudioThreadSafeMode(true);
+
+			expect(te.r.wasOk(), te.r.getErrorMessage());
+
+			HiseJavascriptEngine::RootObject::Error e;
+
+			te.engine.startAllocationCheck();
+			te.call();
+			te.engine.stopAllocationCheck(e);
+
+			var withoutCheck = te.call();
+
+			te.engine.startAllocationCheck();
+			var withCheck = te.call();
+			const int numAllocations = te.engine.stopAllocationCheck(e);
+
+			expectEquals(numAllocations, 0, callbackBody + ": The cached literal wasn't reused");
+
+			const bool isSameObject = withCheck.isArray() ? withCheck.getArray() == withoutCheck.getArray() : 
+															withCheck.getDynamicObject() == withoutCheck.getDynamicObject();
+
+			expect(!isSameObject, callbackBody + ": The cached literal was used without the allocation check");
+		}
+	}
+
+	void testTimeout()
+	{
+		beginTest("Testing the timeout budget");
+
+		using Budget = HiseJavascriptEngine::RootObject::TimeoutBudget;
+
+		Budget budget;
+
+		budget.prepare(RelativeTime(-1.0));
+
+		int numEarlyClockChecks = 0;
+
+		for (int i = 1; i < Budget::NumTicksPerClockCheck; i++)
+			numEarlyClockChecks += budget.tick() ? 1 : 0;
+
+		expectEquals(numEarlyClockChecks, 0, "The clock was checked before the budget was used up");
+
+		expect(budget.tick(), "The budget wasn't used up");
+		expect(budget.hasTimedOut(), "No timeout");
+		expect(!budget.tick(), "The budget wasn't refilled");
+		expectEquals<int64>(budget.numTicks, (int64)Budget::NumTicksPerClockCheck + 1);
+
+		budget.prepare(RelativeTime(15.0));
+
+		expectEquals<int64>(budget.numTicks, 0);
+
+		while (!budget.tick())
+			;
+
+		expect(!budget.hasTimedOut(), "Timeout before the maximum execution time");
+	}
+};
+
+static ScriptBytecodeUnitTest scriptBytecodeUnitTest;
+
+} // namespace hise
+
+#endif
@@ -78,14 +78,49 @@ Set this to true if you add this module to your existing C++ project and don't e
 #define STANDALONE_STREAMING 1
 #endif
 
+//=============================================================================
+/** Config: HISE_NUM_STREAMING_THREADS
+
+The number of background threads that read the samples for the streaming voices. If set to zero,
+the streaming will be done by the sample loading thread.
+*/
+#ifndef HISE_NUM_STREAMING_THREADS
+#if JUCE_IOS
+#define HISE_NUM_STREAMING_THREADS 0
+#else
+#define HISE_NUM_STREAMING_THREADS 2
+#endif
+#endif
+
+
+//=============================================================================
+/** Config: HISE_NUM_PRELOAD_THREADS
+
+The number of threads that preload the samples in parallel when a sample map is loaded. These threads are
+separated from the streaming threads, so that the playing voices are not starving during a preset switch.
+If set to zero, the samples will be preloaded one after another by the sample loading thread.
+*/
+#ifndef HISE_NUM_PRELOAD_THREADS
+#if JUCE_IOS
+#define HISE_NUM_PRELOAD_THREADS 0
+#else
+#define HISE_NUM_PRELOAD_THREADS 3
+#endif
+#endif
+
 
 #include "hi_streaming/lockfree_fifo/readerwriterqueue.h"
 
+#if JUCE_USE_SSE_INTRINSICS
+#include <emmintrin.h>
+#endif
+
 
 
 #include "hi_streaming/SampleThreadPool.h"
 #include "hi_streaming/MonolithAudioFormat.h"
 #include "hi_streaming/StreamingSampler.h"
+#include "hi_streaming/SampleInterpolators.h"
 #include "hi_streaming/StreamingSamplerSound.h"
 #include "hi_streaming/StreamingSamplerVoice.h"
 
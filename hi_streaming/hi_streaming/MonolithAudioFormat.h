@@ -298,6 +298,14 @@ public:
 		return nullptr;
 	}
 
+	File getMonolithicFile(int channelIndex) const
+	{
+		if (isPositiveAndBelow(channelIndex, (int)monolithicFiles.size()))
+			return monolithicFiles[channelIndex];
+
+		return File();
+	}
+
 	String getFileName(int channelIndex, int sampleIndex) const
 	{
 		return multiChannelSampleInformation[channelIndex][sampleIndex].fileName;
@@ -387,6 +395,14 @@ public:
 
 	void fillMetadataInfo(const ValueTree& sampleMap);
 
+	File getMonolithicFile(int channelIndex) const
+	{
+		if (isPositiveAndBelow(channelIndex, (int)monolithicFiles.size()))
+			return monolithicFiles[channelIndex];
+
+		return File();
+	}
+
 	String getFileName(int channelIndex, int sampleIndex) const
 	{
 		return multiChannelSampleInformation[channelIndex][sampleIndex].fileName;
@@ -0,0 +1,308 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise { using namespace juce;
+
+/** A polyphase table for the windowed sinc interpolation.
+*
+*	There are multiple sets with a decreasing cutoff frequency for pitch ratios above 1.0 to reduce aliasing
+*	when the sample is transposed up.
+*/
+struct SampleInterpolators::SincTable
+{
+	static const int NumTaps = 16;
+	static const int NumPhases = 128;
+	static const int NumCutoffLevels = 3;
+
+	SincTable()
+	{
+		for (int level = 0; level < NumCutoffLevels; level++)
+		{
+			const double cutoff = 0.9 / (double)(1 << level);
+
+			for (int phase = 0; phase <= NumPhases; phase++)
+			{
+				const double alpha = (double)phase / (double)NumPhases;
+
+				float* c = coefficients[level][phase];
+				double sum = 0.0;
+
+				for (int tap = 0; tap < NumTaps; tap++)
+				{
+					// The distance from the read position to the sample at this tap (-8 ... 8)
+					const double x = (double)(tap - (NumHistorySamples - 1)) - alpha;
+					const double sincArg = double_Pi * cutoff * x;
+					const double sinc = x == 0.0 ? 1.0 : std::sin(sincArg) / sincArg;
+					const double w = (double)(NumTaps / 2);
+					const double window = 0.42 + 0.5 * std::cos(double_Pi * x / w) + 0.08 * std::cos(2.0 * double_Pi * x / w);
+
+					const double value = cutoff * sinc * window;
+
+					c[tap] = (float)value;
+					sum += value;
+				}
+
+				// Normalise every phase to unity gain at DC
+				for (int tap = 0; tap < NumTaps; tap++)
+					c[tap] = (float)((double)c[tap] / sum);
+			}
+		}
+	}
+
+	static int getLevelForPitchRatio(double ratio)
+	{
+		if (ratio <= 1.0)
+			return 0;
+		else if (ratio <= 2.0)
+			return 1;
+		else
+			return 2;
+	}
+
+	alignas(16) float coefficients[NumCutoffLevels][NumPhases + 1][NumTaps];
+};
+
+const SampleInterpolators::SincTable& SampleInterpolators::getSincTable()
+{
+	static SampleInterpolators::SincTable table;
+	return table;
+}
+
+void SampleInterpolators::initialiseTables()
+{
+	getSincTable();
+}
+
+#if JUCE_USE_SSE_INTRINSICS
+
+static forcedinline float addHorizontally(__m128 v)
+{
+	__m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+	s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+	return _mm_cvtss_f32(s);
+}
+
+static forcedinline __m128 interpolateHermite(__m128 ym1, __m128 y0, __m128 y1, __m128 y2, __m128 t)
+{
+	const __m128 half = _mm_set1_ps(0.5f);
+
+	const __m128 c1 = _mm_mul_ps(half, _mm_sub_ps(y1, ym1));
+	const __m128 c2 = _mm_sub_ps(_mm_add_ps(ym1, _mm_add_ps(y1, y1)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.5f), y0), _mm_mul_ps(half, y2)));
+	const __m128 c3 = _mm_add_ps(_mm_mul_ps(half, _mm_sub_ps(y2, ym1)), _mm_mul_ps(_mm_set1_ps(1.5f), _mm_sub_ps(y0, y1)));
+
+	return _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3, t), c2), t), c1), t), y0);
+}
+
+#endif
+
+static forcedinline float interpolateHermite(float ym1, float y0, float y1, float y2, float t)
+{
+	const float c1 = 0.5f * (y1 - ym1);
+	const float c2 = ym1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+	const float c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+
+	return ((c3 * t + c2) * t + c1) * t + y0;
+}
+
+void SampleInterpolators::convertToFloat(float* dst, const int16* src, int numSamples)
+{
+	const float gainFactor = 1.0f / (float)INT16_MAX;
+
+	int i = 0;
+
+#if JUCE_USE_SSE_INTRINSICS
+	const __m128 gain = _mm_set1_ps(gainFactor);
+
+	for (; i + 8 <= numSamples; i += 8)
+	{
+		const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+		// Sign extend the 16 bit values to 32 bit
+		const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+		const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), gain));
+		_mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), gain));
+	}
+#endif
+
+	for (; i < numSamples; i++)
+		dst[i] = (float)src[i] * gainFactor;
+}
+
+void SampleInterpolators::process(Mode m, const float* inL, const float* inR, const float* pitchData, float* outL, float* outR, double indexInBuffer, double uptimeDelta, int numSamples)
+{
+	switch (m)
+	{
+	case Hermite:	processHermite(inL, inR, pitchData, outL, outR, indexInBuffer, uptimeDelta, numSamples); break;
+	case Sinc:		processSinc(inL, inR, pitchData, outL, outR, indexInBuffer, uptimeDelta, numSamples); break;
+	case Linear:
+	default:
+	{
+		for (int i = 0; i < numSamples; i++)
+		{
+			const int pos = (int)indexInBuffer;
+			const float alpha = (float)(indexInBuffer - (double)pos);
+
+			outL[i] = inL[pos] + alpha * (inL[pos + 1] - inL[pos]);
+			outR[i] = inR[pos] + alpha * (inR[pos + 1] - inR[pos]);
+
+			indexInBuffer += pitchData != nullptr ? (double)pitchData[i] : uptimeDelta;
+		}
+
+		break;
+	}
+	}
+}
+
+void SampleInterpolators::processHermite(const float* inL, const float* inR, const float* pitchData, float* outL, float* outR, double indexInBuffer, double uptimeDelta, int numSamples)
+{
+	int i = 0;
+
+#if JUCE_USE_SSE_INTRINSICS
+
+	// Processes four samples at once: the four neighbours of each read position are 
+	// loaded as one vector and transposed so that every vector contains one neighbour
+	// for all four samples.
+	for (; i + 4 <= numSamples; i += 4)
+	{
+		int pos[4];
+		float alpha[4];
+
+		for (int k = 0; k < 4; k++)
+		{
+			pos[k] = (int)indexInBuffer - 1;
+			alpha[k] = (float)(indexInBuffer - (double)(pos[k] + 1));
+			indexInBuffer += pitchData != nullptr ? (double)pitchData[i + k] : uptimeDelta;
+		}
+
+		const __m128 t = _mm_loadu_ps(alpha);
+
+		__m128 l0 = _mm_loadu_ps(inL + pos[0]);
+		__m128 l1 = _mm_loadu_ps(inL + pos[1]);
+		__m128 l2 = _mm_loadu_ps(inL + pos[2]);
+		__m128 l3 = _mm_loadu_ps(inL + pos[3]);
+
+		_MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+
+		_mm_storeu_ps(outL + i, interpolateHermite(l0, l1, l2, l3, t));
+
+		__m128 r0 = _mm_loadu_ps(inR + pos[0]);
+		__m128 r1 = _mm_loadu_ps(inR + pos[1]);
+		__m128 r2 = _mm_loadu_ps(inR + pos[2]);
+		__m128 r3 = _mm_loadu_ps(inR + pos[3]);
+
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+		_mm_storeu_ps(outR + i, interpolateHermite(r0, r1, r2, r3, t));
+	}
+
+#endif
+
+	for (; i < numSamples; i++)
+	{
+		const int pos = (int)indexInBuffer;
+		const float t = (float)(indexInBuffer - (double)pos);
+
+		outL[i] = interpolateHermite(inL[pos - 1], inL[pos], inL[pos + 1], inL[pos + 2], t);
+		outR[i] = interpolateHermite(inR[pos - 1], inR[pos], inR[pos + 1], inR[pos + 2], t);
+
+		indexInBuffer += pitchData != nullptr ? (double)pitchData[i] : uptimeDelta;
+	}
+}
+
+void SampleInterpolators::processSinc(const float* inL, const float* inR, const float* pitchData, float* outL, float* outR, double indexInBuffer, double uptimeDelta, int numSamples)
+{
+	typedef SincTable T;
+
+	double ratio = uptimeDelta;
+
+	if (pitchData != nullptr && numSamples > 0)
+	{
+		// Approximate the pitch of this block with the first and last pitch value
+		ratio = (double)(pitchData[0] + pitchData[numSamples - 1]) * 0.5;
+	}
+
+	const auto& coefficients = getSincTable().coefficients[T::getLevelForPitchRatio(ratio)];
+
+	for (int i = 0; i < numSamples; i++)
+	{
+		const int pos = (int)indexInBuffer;
+		const float phase = (float)(indexInBuffer - (double)pos) * (float)T::NumPhases;
+		const int phaseIndex = jmin<int>(T::NumPhases - 1, (int)phase);
+		const float phaseAlpha = phase - (float)phaseIndex;
+
+		const float* c0 = coefficients[phaseIndex];
+		const float* c1 = coefficients[phaseIndex + 1];
+
+		const float* l = inL + pos - (NumHistorySamples - 1);
+		const float* r = inR + pos - (NumHistorySamples - 1);
+
+#if JUCE_USE_SSE_INTRINSICS
+		const __m128 pa = _mm_set1_ps(phaseAlpha);
+
+		__m128 accL = _mm_setzero_ps();
+		__m128 accR = _mm_setzero_ps();
+
+		for (int k = 0; k < T::NumTaps; k += 4)
+		{
+			const __m128 a = _mm_load_ps(c0 + k);
+			const __m128 c = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(c1 + k), a), pa));
+
+			accL = _mm_add_ps(accL, _mm_mul_ps(c, _mm_loadu_ps(l + k)));
+			accR = _mm_add_ps(accR, _mm_mul_ps(c, _mm_loadu_ps(r + k)));
+		}
+
+		outL[i] = addHorizontally(accL);
+		outR[i] = addHorizontally(accR);
+#else
+		float sumL = 0.0f;
+		float sumR = 0.0f;
+
+		for (int k = 0; k < T::NumTaps; k++)
+		{
+			const float c = c0[k] + phaseAlpha * (c1[k] - c0[k]);
+
+			sumL += c * l[k];
+			sumR += c * r[k];
+		}
+
+		outL[i] = sumL;
+		outR[i] = sumR;
+#endif
+
+		indexInBuffer += pitchData != nullptr ? (double)pitchData[i] : uptimeDelta;
+	}
+}
+
+} // namespace hise
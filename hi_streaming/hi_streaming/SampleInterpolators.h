@@ -0,0 +1,89 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#ifndef SAMPLEINTERPOLATORS_H_INCLUDED
+#define SAMPLEINTERPOLATORS_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** The interpolation algorithms that can be used by the StreamingSamplerVoice.
+*
+*	The linear interpolation reads directly from the streaming buffers. The other modes need
+*	some samples before and after the read position, so the voice copies the data (converted to
+*	float) into a staging buffer that is prepended with the last samples of the previous block.
+*/
+struct SampleInterpolators
+{
+	enum Mode
+	{
+		Linear = 0, ///< the fastest mode, which is used by default
+		Hermite, ///< a 4-point, 3rd order hermite interpolation
+		Sinc, ///< a 16-point windowed sinc interpolation with a cutoff frequency that follows the pitch ratio
+		numModes
+	};
+
+	/** The amount of samples that the interpolators need before the read position. */
+	static const int NumHistorySamples = 8;
+
+	/** The amount of samples that the interpolators need after the read position. */
+	static const int NumLookaheadSamples = 9;
+
+	/** The amount of samples that must be allocated in addition to the samples for one block. */
+	static const int NumPaddingSamples = NumHistorySamples + NumLookaheadSamples;
+
+	/** Converts the 16 bit integer samples to float. */
+	static void convertToFloat(float* dst, const int16* src, int numSamples);
+
+	/** Interpolates the stereo signal using the given mode.
+	*
+	*	@param inL, inR the staging buffers. The index 0 must point to the first history sample.
+	*	@param pitchData an array with the delta for each sample or nullptr for a constant uptimeDelta.
+	*	@param indexInBuffer the start position (including the history offset).
+	*/
+	static void process(Mode m, const float* inL, const float* inR, const float* pitchData, float* outL, float* outR, double indexInBuffer, double uptimeDelta, int numSamples);
+
+	/** Makes sure that the lookup tables are created. Call this on a non-realtime thread before using the Sinc mode. */
+	static void initialiseTables();
+
+private:
+
+	static void processHermite(const float* inL, const float* inR, const float* pitchData, float* outL, float* outR, double indexInBuffer, double uptimeDelta, int numSamples);
+	static void processSinc(const float* inL, const float* inR, const float* pitchData, float* outL, float* outR, double indexInBuffer, double uptimeDelta, int numSamples);
+
+	struct SincTable;
+
+	static const SincTable& getSincTable();
+};
+
+} // namespace hise
+#endif  // SAMPLEINTERPOLATORS_H_INCLUDED
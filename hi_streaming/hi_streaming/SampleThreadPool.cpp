@@ -33,138 +33,491 @@
 namespace hise { using namespace juce;
 
 
+/** A bounded lock free queue that can be used by multiple producers and consumers.
+*
+*	The streaming jobs are added from all audio threads (and the message thread), so the single producer
+*	queue can't be used here. The size must be a power of two.
+*/
+class MultiProducerJobQueue
+{
+public:
+
+	MultiProducerJobQueue(size_t size) :
+		cells(size),
+		mask(size - 1)
+	{
+		jassert(isPowerOfTwo((int)size));
+
+		for (size_t i = 0; i < size; i++)
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+
+		enqueuePosition.store(0, std::memory_order_relaxed);
+		dequeuePosition.store(0, std::memory_order_relaxed);
+	}
+
+	bool push(const WeakReference<SampleThreadPool::Job>& newJob)
+	{
+		Cell* cell;
+		size_t pos = enqueuePosition.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			cell = &cells[pos & mask];
+			const size_t seq = cell->sequence.load(std::memory_order_acquire);
+			const intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+			if (dif == 0)
+			{
+				if (enqueuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (dif < 0)
+				return false;
+			else
+				pos = enqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		cell->job = newJob;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(WeakReference<SampleThreadPool::Job>& nextJob)
+	{
+		Cell* cell;
+		size_t pos = dequeuePosition.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			cell = &cells[pos & mask];
+			const size_t seq = cell->sequence.load(std::memory_order_acquire);
+			const intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+
+			if (dif == 0)
+			{
+				if (dequeuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (dif < 0)
+				return false;
+			else
+				pos = dequeuePosition.load(std::memory_order_relaxed);
+		}
+
+		nextJob = cell->job;
+		cell->job = nullptr;
+		cell->sequence.store(pos + mask + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		WeakReference<SampleThreadPool::Job> job;
+	};
+
+	std::vector<Cell> cells;
+	const size_t mask;
+
+	std::atomic<size_t> enqueuePosition;
+	std::atomic<size_t> dequeuePosition;
+
+	JUCE_DECLARE_NON_COPYABLE(MultiProducerJobQueue);
+};
+
+
 struct SampleThreadPool::Pimpl
 {
-	Pimpl() :
-		jobQueue(2048),
-		currentlyExecutedJob(nullptr),
-		diskUsage(0.0),
-		counter(0)
-	{};
+	/** The state of a single thread that executes jobs. */
+	struct Worker
+	{
+		Worker(Thread* thread_) :
+			thread(thread_),
+			jobQueue(2048),
+			currentlyExecutedJob(nullptr),
+			diskUsage(0.0),
+			minimumSlack(std::numeric_limits<int64>::max())
+		{
+			pendingJobs.ensureStorageAllocated(2048);
+		};
+
+		~Worker()
+		{
+			if (Job* currentJob = currentlyExecutedJob.load())
+			{
+				currentJob->signalJobShouldExit();
+			}
+		}
+
+		/** Moves the new jobs from the queue into the pending list and returns the index of the most urgent job. */
+		int getIndexOfNextJob();
+
+		void run();
+
+		/** Updates the deadline statistics after a job has finished. */
+		void checkDeadline(const Job* j);
+
+		Thread* thread;
 
-	~Pimpl()
+		MultiProducerJobQueue jobQueue;
+
+		/** Only accessed by the worker thread. */
+		Array<WeakReference<Job>> pendingJobs;
+
+		std::atomic<Job*> currentlyExecutedJob;
+
+		std::atomic<double> diskUsage;
+
+		int64 startTime = 0, endTime = 0;
+
+		Atomic<int> counter;
+
+		Atomic<int> numJobsWithDeadline;
+		Atomic<int> numNearMisses;
+		Atomic<int> numMissedDeadlines;
+		std::atomic<int64> minimumSlack;
+	};
+
+	/** A thread that runs a Worker for streaming jobs. */
+	class StreamingThread : public Thread
 	{
-		if (Job* currentJob = currentlyExecutedJob.load())
+	public:
+
+		StreamingThread(int index) :
+			Thread("Sample Streaming Thread " + String(index)),
+			worker(this)
+		{};
+
+		void run() override
 		{
-			currentJob->signalJobShouldExit();
+			worker.run();
+		}
+
+		Worker worker;
+	};
+
+	Pimpl(SampleThreadPool* parent, int numStreamingThreads) :
+		loadingThreadWorker(new Worker(parent))
+	{
+		workers.add(loadingThreadWorker);
+
+		for (int i = 0; i < numStreamingThreads; i++)
+		{
+			streamingThreads.add(new StreamingThread(i + 1));
+			workers.add(&streamingThreads.getLast()->worker);
 		}
+	};
+
+	int getWorkerIndexForJob(const Job* j) const noexcept
+	{
+		const int64 affinity = j->getWorkerAffinity();
+
+		if (affinity < 0 || streamingThreads.isEmpty())
+			return 0;
+
+		return 1 + (int)(affinity % (int64)streamingThreads.size());
 	}
 
-	Atomic<int> counter;
+	/** Adds a queue entry to the job and returns the index of the worker it must be added to.
+	*
+	*	The affinity of a job can change while it is queued (eg. if a SampleLoader starts streaming another sound),
+	*	so the worker of the first pending entry is used until all entries are processed.
+	*/
+	static int acquireQueueEntry(Job* j, int indexIfNotQueued) noexcept
+	{
+		int64 state = j->queueState.load();
 
-	std::atomic<double> diskUsage;
+		for (;;)
+		{
+			const int64 numEntries = state >> 32;
+			const int index = numEntries == 0 ? indexIfNotQueued : (int)(state & 0xFFFFFFFF);
+			const int64 newState = ((numEntries + 1) << 32) | (int64)index;
 
-	int64 startTime, endTime;
+			if (j->queueState.compare_exchange_weak(state, newState))
+				return index;
+		}
+	}
 
-	moodycamel::ReaderWriterQueue<WeakReference<Job>> jobQueue;
+	static void releaseQueueEntry(Job* j) noexcept
+	{
+		j->queueState.fetch_sub((int64)1 << 32);
+	}
+
+	ScopedPointer<Worker> loadingThreadWorker;
 
-	std::atomic<Job*> currentlyExecutedJob;
+	OwnedArray<StreamingThread> streamingThreads;
+
+	/** The sample loading thread has the index 0. */
+	Array<Worker*> workers;
 
 	static const String errorMessage;
 };
 
-SampleThreadPool::SampleThreadPool() :
-	Thread("Sample Loading Thread"),
-	pimpl(new Pimpl())
+int SampleThreadPool::Pimpl::Worker::getIndexOfNextJob()
 {
+	WeakReference<Job> newJob;
 
-	startThread(9);
-}
+	while (jobQueue.pop(newJob))
+		pendingJobs.add(newJob);
 
-SampleThreadPool::~SampleThreadPool()
-{
-	pimpl = nullptr;
+	int indexOfNextJob = -1;
+	int64 earliestDeadline = std::numeric_limits<int64>::max();
 
-	stopThread(300);
-}
+	for (int i = 0; i < pendingJobs.size(); i++)
+	{
+		Job* j = pendingJobs.getReference(i).get();
 
-double SampleThreadPool::getDiskUsage() const noexcept
-{
-	return pimpl->diskUsage.load();
+		if (j == nullptr)
+		{
+			pendingJobs.remove(i--);
+			--counter;
+			continue;
+		}
+
+		const int64 d = j->getDeadline();
+
+		if (d < earliestDeadline)
+		{
+			earliestDeadline = d;
+			indexOfNextJob = i;
+		}
+	}
+
+	return indexOfNextJob;
 }
 
-void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
+void SampleThreadPool::Pimpl::Worker::checkDeadline(const Job* j)
 {
-	++pimpl->counter;
+	// Jobs without an explicit deadline use the time they were added
+	if (!j->hasDeadline.load())
+		return;
 
-	ignoreUnused(unused);
+	const int64 timeAdded = j->timeAdded.load();
+	const int64 deadline = j->getDeadline();
 
-#if ENABLE_CONSOLE_OUTPUT
-	if (jobToAdd->isQueued())
-	{
-		Logger::writeToLog(pimpl->errorMessage);
-		Logger::writeToLog(String(pimpl->counter.get()));
-	}
-#endif
+	// A deadline before the time the job was added means the job was due immediately
+	const int64 availableTime = jmax<int64>(0, deadline - timeAdded);
+
+	const int64 now = Time::getHighResolutionTicks();
+	const int64 slack = deadline - now;
 
+	++numJobsWithDeadline;
 
-	jobToAdd->queued.store(true);
-	pimpl->jobQueue.enqueue(jobToAdd);
+	if (slack < 0)
+		++numMissedDeadlines;
+	else if (slack < availableTime / 4)
+		++numNearMisses;
 
+	int64 currentMinimum = minimumSlack.load();
 
-	notify();
+	while (slack < currentMinimum && !minimumSlack.compare_exchange_weak(currentMinimum, slack))
+		;
 }
 
-void SampleThreadPool::run()
+void SampleThreadPool::Pimpl::Worker::run()
 {
-	while (!threadShouldExit())
+	while (!thread->threadShouldExit())
 	{
-		if (WeakReference<Job>* next = pimpl->jobQueue.peek())
+		const int index = getIndexOfNextJob();
+
+		if (index != -1)
 		{
-			Job* j = next->get();
+			Job* j = pendingJobs.getReference(index).get();
+
+			if (j == nullptr)
+			{
+				// The job was deleted after it was picked
+				pendingJobs.remove(index);
+				--counter;
+				continue;
+			}
 
 #if ENABLE_CPU_MEASUREMENT
 
-			const int64 lastEndTime = pimpl->endTime;
-			pimpl->startTime = Time::getHighResolutionTicks();
+			const int64 lastEndTime = endTime;
+			startTime = Time::getHighResolutionTicks();
 #endif
 
-			if (j != nullptr)
-			{
-				pimpl->currentlyExecutedJob.store(j);
+			currentlyExecutedJob.store(j);
 
-				j->currentThread.store(this);
+			j->currentThread.store(thread);
 
-				j->running.store(true);
+			j->running.store(true);
 				
-				Job::JobStatus status = j->runJob();
+			Job::JobStatus status = j->runJob();
 
-				j->running.store(false);
+			j->running.store(false);
 
-				if (status == Job::jobHasFinished)
-				{
-					pimpl->jobQueue.pop();
-					j->queued.store(false);
-					--pimpl->counter;
-				}
+			if (status == Job::jobHasFinished)
+			{
+				checkDeadline(j);
 
-				pimpl->currentlyExecutedJob.store(nullptr);
+				pendingJobs.remove(index);
+				j->deadline.store(0);
+				Pimpl::releaseQueueEntry(j);
+				--counter;
 			}
 
+			currentlyExecutedJob.store(nullptr);
 
 #if ENABLE_CPU_MEASUREMENT
-			pimpl->endTime = Time::getHighResolutionTicks();
+			endTime = Time::getHighResolutionTicks();
 
-			const int64 idleTime = pimpl->startTime - lastEndTime;
-			const int64 busyTime = pimpl->endTime - pimpl->startTime;
+			const int64 idleTime = startTime - lastEndTime;
+			const int64 busyTime = endTime - startTime;
 
-			pimpl->diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
+			diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
 #endif
 		}
 
 #if 0 // Set this to true to enable defective threading (for debugging purposes)
-		wait(500);
+		thread->wait(500);
 #else
 		else
 		{
-			wait(500);
+			thread->wait(500);
 		}
 #endif
+	}
+}
+
+SampleThreadPool::SampleThreadPool(int numStreamingThreads) :
+	Thread("Sample Loading Thread"),
+	pimpl(new Pimpl(this, numStreamingThreads))
+{
+	startThread(9);
+
+	for (auto t : pimpl->streamingThreads)
+		t->startThread(9);
+}
+
+SampleThreadPool::~SampleThreadPool()
+{
+	for (auto t : pimpl->streamingThreads)
+		t->signalThreadShouldExit();
+
+	signalThreadShouldExit();
+
+	for (auto w : pimpl->workers)
+	{
+		if (Job* currentJob = w->currentlyExecutedJob.load())
+			currentJob->signalJobShouldExit();
+
+		w->thread->notify();
+	}
+
+	for (auto t : pimpl->streamingThreads)
+		t->stopThread(300);
+
+	stopThread(300);
+
+	pimpl = nullptr;
+}
+
+double SampleThreadPool::getDiskUsage() const noexcept
+{
+	double usage = 0.0;
+
+	for (auto w : pimpl->workers)
+		usage = jmax<double>(usage, w->diskUsage.load());
+
+	return usage;
+}
+
+double SampleThreadPool::getDiskUsage(int workerIndex) const noexcept
+{
+	if (auto w = pimpl->workers[workerIndex])
+		return w->diskUsage.load();
+
+	return 0.0;
+}
+
+int SampleThreadPool::getNumWorkers() const noexcept
+{
+	return pimpl->workers.size();
+}
+
+SampleThreadPool::DeadlineStatistics SampleThreadPool::getDeadlineStatistics() const noexcept
+{
+	DeadlineStatistics stats;
+
+	int64 minimumSlack = std::numeric_limits<int64>::max();
+
+	for (auto w : pimpl->workers)
+	{
+		stats.numJobs += w->numJobsWithDeadline.get();
+		stats.numNearMisses += w->numNearMisses.get();
+		stats.numMissedDeadlines += w->numMissedDeadlines.get();
+		minimumSlack = jmin<int64>(minimumSlack, w->minimumSlack.load());
+	}
+
+	if (stats.numJobs > 0)
+		stats.minimumSlack = Time::highResolutionTicksToSeconds(minimumSlack);
+
+	return stats;
+}
+
+void SampleThreadPool::resetDeadlineStatistics() noexcept
+{
+	for (auto w : pimpl->workers)
+	{
+		w->numJobsWithDeadline.set(0);
+		w->numNearMisses.set(0);
+		w->numMissedDeadlines.set(0);
+		w->minimumSlack.store(std::numeric_limits<int64>::max());
+	}
+}
+
+void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
+{
+	ignoreUnused(unused);
+
+#if ENABLE_CONSOLE_OUTPUT
+	if (jobToAdd->isQueued())
+	{
+		Logger::writeToLog(pimpl->errorMessage);
+	}
+#endif
+
+	auto w = pimpl->workers.getUnchecked(Pimpl::acquireQueueEntry(jobToAdd, pimpl->getWorkerIndexForJob(jobToAdd)));
+
+	++w->counter;
+
+	const int64 now = Time::getHighResolutionTicks();
+
+	jobToAdd->timeAdded.store(now);
+
+	const bool hasDeadline = jobToAdd->getDeadline() != 0;
+
+	jobToAdd->hasDeadline.store(hasDeadline);
 
+	if (!hasDeadline)
+		jobToAdd->setDeadline(now);
 
+	if (!w->jobQueue.push(jobToAdd))
+	{
+		// The queue is full, so undo the bookkeeping or the job would look queued forever
+		Pimpl::releaseQueueEntry(jobToAdd);
+		--w->counter;
+
+#if ENABLE_CONSOLE_OUTPUT
+		Logger::writeToLog(pimpl->errorMessage);
+#endif
+
+		jassertfalse;
+		return;
 	}
+
+	w->thread->notify();
+}
+
+void SampleThreadPool::run()
+{
+	pimpl->loadingThreadWorker->run();
 }
 
 const String SampleThreadPool::Pimpl::errorMessage("HDD overflow");
 
-} // namespace hise
\ No newline at end of file
+} // namespace hise
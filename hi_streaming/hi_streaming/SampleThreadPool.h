@@ -35,11 +35,27 @@
 
 namespace hise { using namespace juce;
 
+/** The thread pool that handles all background reading operations of the streaming engine.
+*
+*	It consists of the sample loading thread (which also executes all jobs that are not related to disk streaming,
+*	like preloading or closing file handles) and a configurable amount of streaming workers.
+*
+*	Every worker has its own lock free job queue, and a streaming job is always dispatched to the same worker
+*	for the storage device it reads from (see Job::getWorkerAffinity()), so a slow drive can't block the
+*	streaming of samples that are located on another drive.
+*
+*	Within one worker, the jobs are not executed in the order they were added, but the job with the earliest
+*	deadline (the time when the voice will run out of samples) will be processed first.
+*/
 class SampleThreadPool : public Thread
 {
 public:
 
-	SampleThreadPool();
+	/** Creates a thread pool with the given amount of streaming workers.
+	*
+	*	If you pass zero, every job will be executed by the sample loading thread.
+	*/
+	SampleThreadPool(int numStreamingThreads=HISE_NUM_STREAMING_THREADS);
 
 	~SampleThreadPool();
 	
@@ -50,9 +66,12 @@ public:
 
 		Job(const String &name_) : 
 			name(name_),
-			queued(false),
+			queueState(0),
 			running(false),
-			shouldStop(false)
+			shouldStop(false),
+			deadline(0),
+			timeAdded(0),
+			hasDeadline(false)
 		{};
         
         virtual ~Job() { masterReference.clear(); }
@@ -65,13 +84,29 @@ public:
 
 		virtual JobStatus runJob() = 0;
 
+		/** Override this and return a hash code for the storage device that this job is reading from.
+		*
+		*	Jobs with the same affinity will always be executed by the same streaming worker. If it
+		*	returns -1 (the default), the job will be executed by the sample loading thread.
+		*/
+		virtual int64 getWorkerAffinity() const { return -1; }
+
 		bool shouldExit() const noexcept{ return shouldStop.load(); }
 
 		void signalJobShouldExit() { shouldStop.store(true); }
 
 		bool isRunning() const noexcept{ return running.load(); };
 
-		bool isQueued() const noexcept{ return queued.load(); };
+		bool isQueued() const noexcept{ return (queueState.load() >> 32) > 0; };
+
+		/** Sets the time (in high resolution ticks) until the job must be finished.
+		*
+		*	If you don't set a deadline before adding the job, the time when it was added will be used so that
+		*	those jobs are executed in the order they were added.
+		*/
+		void setDeadline(int64 newDeadline) noexcept { deadline.store(newDeadline); }
+
+		int64 getDeadline() const noexcept { return deadline.load(); }
 
 	protected:
 
@@ -84,19 +119,64 @@ public:
         friend class WeakReference<Job>;
         WeakReference<Job>::Master masterReference;
 
-		std::atomic<bool> queued;
+		/** The number of queue entries (upper 32 bits) and the index of the worker that they were dispatched to (lower 32 bits).
+		*
+		*	A job that is already queued is always added to the same worker, so it can't be executed by two threads at the same time.
+		*/
+		std::atomic<int64> queueState;
 
 		std::atomic<bool> running;
 
 		std::atomic<bool> shouldStop;
 
+		std::atomic<int64> deadline;
+
+		std::atomic<int64> timeAdded;
+
+		/** true if the deadline was set before the job was added. */
+		std::atomic<bool> hasDeadline;
+
 		std::atomic<Thread*> currentThread;
 
 		const String name;
 	};
 
+	/** Returns the highest disk usage of all workers. */
 	double getDiskUsage() const noexcept;
 
+	/** Returns the disk usage of the given worker. The sample loading thread has the index 0. */
+	double getDiskUsage(int workerIndex) const noexcept;
+
+	/** Returns the number of workers including the sample loading thread. */
+	int getNumWorkers() const noexcept;
+
+	/** Statistics about how close the jobs with a deadline were finished to their deadline. 
+	*
+	*	You can use this information to find the smallest preload / streaming buffer size that doesn't cause dropouts.
+	*/
+	struct DeadlineStatistics
+	{
+		/** The number of jobs that had a deadline. */
+		int numJobs = 0;
+
+		/** The number of jobs that finished in the last quarter of the available time. */
+		int numNearMisses = 0;
+
+		/** The number of jobs that finished after their deadline (this results in a dropout). */
+		int numMissedDeadlines = 0;
+
+		/** The shortest time in seconds between the end of a job and its deadline. */
+		double minimumSlack = 0.0;
+	};
+
+	/** Returns the deadline statistics of all workers since the last call to resetDeadlineStatistics(). */
+	DeadlineStatistics getDeadlineStatistics() const noexcept;
+
+	/** Clears the deadline statistics. This is called in MainController::prepareToPlay() and when the
+	*	streaming buffer sizes of a sampler are changed in its settings panel.
+	*/
+	void resetDeadlineStatistics() noexcept;
+
 	void addJob(Job* jobToAdd, bool unused);
 
 	void run() override;
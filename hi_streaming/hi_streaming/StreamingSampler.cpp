@@ -62,6 +62,160 @@ bool StreamingHelpers::preloadSample(StreamingSamplerSound * s, const int preloa
 	}
 }
 
+/** A job that preloads the sounds of a shared list until every sound was loaded. */
+class ParallelPreloadJob : public ThreadPoolJob
+{
+public:
+
+	struct SharedData
+	{
+		SharedData(const Array<StreamingSamplerSound*>& sounds_, int preloadSize_) :
+			sounds(sounds_),
+			preloadSize(preloadSize_)
+		{
+			// The sounds of a monolith file share one HLAC reader, so they are sorted into a group that is loaded by a single thread.
+			auto getGroupKey = [](const StreamingSamplerSound* s)
+			{
+				return s->isMonolithic() ? s->getStorageAffinity() : (int64)-1;
+			};
+
+			std::stable_sort(sounds.begin(), sounds.end(), [getGroupKey](const StreamingSamplerSound* a, const StreamingSamplerSound* b)
+			{
+				return getGroupKey(a) < getGroupKey(b);
+			});
+
+			for (int i = 0; i < sounds.size(); i++)
+			{
+				const int64 key = getGroupKey(sounds.getUnchecked(i));
+
+				if (key != -1 && i > 0 && getGroupKey(sounds.getUnchecked(i - 1)) == key)
+					groups.getReference(groups.size() - 1).setEnd(i + 1);
+				else
+					groups.add(Range<int>(i, i + 1));
+			}
+		};
+
+		/** Preloads the sounds of the next group. Returns false if there are no more groups or the preloading failed. */
+		bool preloadNextGroup()
+		{
+			if (failed.load())
+				return false;
+
+			const int index = nextIndex++;
+
+			if (index >= groups.size())
+				return false;
+
+			const auto group = groups.getUnchecked(index);
+
+			for (int i = group.getStart(); i < group.getEnd() && !failed.load(); i++)
+			{
+				String error;
+
+				if (!StreamingHelpers::preloadSample(sounds.getUnchecked(i), preloadSize, error))
+				{
+					ScopedLock sl(errorLock);
+
+					if (!failed.load())
+						errorMessage = error;
+
+					failed.store(true);
+					break;
+				}
+
+				numLoaded++;
+			}
+
+			return true;
+		}
+
+		Array<StreamingSamplerSound*> sounds;
+
+		/** The ranges of the sounds that must be loaded by the same thread. */
+		Array<Range<int>> groups;
+
+		const int preloadSize;
+
+		std::atomic<int> nextIndex { 0 };
+		std::atomic<int> numLoaded { 0 };
+		std::atomic<bool> failed { false };
+
+		CriticalSection errorLock;
+		String errorMessage;
+	};
+
+	ParallelPreloadJob(SharedData& data_) :
+		ThreadPoolJob("Parallel Preloading"),
+		data(data_)
+	{};
+
+	JobStatus runJob() override
+	{
+		while (!shouldExit() && data.preloadNextGroup())
+			;
+
+		return jobHasFinished;
+	}
+
+private:
+
+	SharedData& data;
+};
+
+bool StreamingHelpers::preloadSamplesInParallel(ThreadPool* pool, const Array<StreamingSamplerSound*>& sounds, const int preloadSize, double& progress, Thread* threadToCheck, String& errorMessage)
+{
+	jassert(pool != nullptr);
+
+	ParallelPreloadJob::SharedData data(sounds, preloadSize);
+
+	OwnedArray<ParallelPreloadJob> jobs;
+
+	const int numJobs = jmin<int>(pool->getNumThreads(), data.groups.size() - 1);
+
+	for (int i = 0; i < numJobs; i++)
+	{
+		pool->addJob(jobs.add(new ParallelPreloadJob(data)), false);
+	}
+
+	const double numToLoad = (double)jmax<int>(1, sounds.size());
+
+	while (data.preloadNextGroup())
+	{
+		progress = (double)data.numLoaded.load() / numToLoad;
+
+		if (threadToCheck != nullptr && threadToCheck->threadShouldExit())
+		{
+			data.failed.store(true);
+			break;
+		}
+	}
+
+	// A whole monolith might still be loaded by another thread, so keep the progress updated until all jobs are done
+	for (auto j : jobs)
+	{
+		while (pool->contains(j))
+		{
+			progress = (double)data.numLoaded.load() / numToLoad;
+
+			if (threadToCheck != nullptr && threadToCheck->threadShouldExit())
+				data.failed.store(true);
+
+			Thread::sleep(20);
+		}
+	}
+
+	for (auto j : jobs)
+		pool->removeJob(j, false, -1);
+
+	if (data.failed.load())
+	{
+		errorMessage = data.errorMessage;
+		return false;
+	}
+
+	return true;
+}
+
 hise::StreamingHelpers::BasicMappingData StreamingHelpers::getBasicMappingDataFromSample(const ValueTree& sampleData)
 {
 	BasicMappingData data;
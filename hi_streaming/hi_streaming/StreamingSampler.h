@@ -55,6 +55,17 @@ struct StreamingHelpers
 
 	static bool preloadSample(StreamingSamplerSound * s, const int preloadSize, String& errorMessage);
 
+	/** Preloads the given sounds using the threads of the given pool.
+	*
+	*	The calling thread will also preload samples and updates the progress until all sounds are loaded. 
+	*	If threadToCheck is not nullptr, it will abort the preloading as soon as this thread should exit.
+	*	If a sound can't be loaded, it will stop the other threads and return false.
+	*
+	*	The sounds of one monolith file share a reader, so they are always loaded by the same thread.
+	*/
+	static bool preloadSamplesInParallel(ThreadPool* pool, const Array<StreamingSamplerSound*>& sounds, const int preloadSize, 
+										 double& progress, Thread* threadToCheck, String& errorMessage);
+
 	/** Creates a BasicMappingData object from the given samplemap entry. */
 	static BasicMappingData getBasicMappingDataFromSample(const ValueTree& sampleData);
 };
@@ -85,17 +96,17 @@ public:
 
 	virtual void decreaseNumOpenFileHandles()
 	{
-		--numOpenFileHandles;
-		if (numOpenFileHandles < 0) numOpenFileHandles = 0;
+		if (--numOpenFileHandles < 0) numOpenFileHandles = 0;
 	}
 
 	AudioFormatManager afm;
 
-	int getNumOpenFileHandles() const { return numOpenFileHandles; }
+	int getNumOpenFileHandles() const { return numOpenFileHandles.load(); }
 
 private:
 
-	int numOpenFileHandles = 0;
+	// The files might be opened by multiple preload threads.
+	std::atomic<int> numOpenFileHandles { 0 };
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamingSamplerSoundPool);
 };
@@ -673,6 +673,7 @@ StreamingSamplerSound::FileReader::FileReader(StreamingSamplerSound *soundForRea
 	sound(soundForReader),
 	missing(true),
 	hashCode(0),
+	storageAffinity(0),
 	voiceCount(0),
 	fileHandlesOpen(false)
 {}
@@ -698,6 +699,7 @@ void StreamingSamplerSound::FileReader::setFile(const String &fileName)
 		fileFormatSupportsMemoryReading = fileExtension.contains("wav") || fileExtension.contains("aif");// || fileExtension.contains("hlac");
 
 		hashCode = loadedFile.hashCode64();
+		storageAffinity = getStorageAffinityForFile(loadedFile);
 	}
 	else
 	{
@@ -751,6 +753,7 @@ void StreamingSamplerSound::FileReader::refreshFileInformation()
 		fileFormatSupportsMemoryReading = fileExtension.compareIgnoreCase(".wav") || fileExtension.startsWithIgnoreCase(".aif");// || fileExtension.startsWithIgnoreCase("hlac");
 
 		hashCode = loadedFile.hashCode64();
+		storageAffinity = getStorageAffinityForFile(loadedFile);
 	}
 }
 
@@ -972,6 +975,26 @@ void StreamingSamplerSound::FileReader::setMonolithicInfo(MonolithInfoToUse* inf
 	hashCode = monolithicName.hashCode64();
 
 	monolithicChannelIndex = channelIndex;
+
+	// Every monolith file gets its own affinity so that multi mic channels can be streamed in parallel
+	storageAffinity = info->getMonolithicFile(channelIndex).getFullPathName().hashCode64() & 0x7FFFFFFFFFFFFFFFLL;
+}
+
+int64 StreamingSamplerSound::FileReader::getStorageAffinityForFile(const File& f)
+{
+	// Use the root directory of the volume (the drive letter on Windows, 
+	// the mount point below /Volumes, /media or /mnt on the other platforms).
+	StringArray pathElements = StringArray::fromTokens(f.getFullPathName(), File::getSeparatorString(), "");
+	pathElements.removeEmptyStrings();
+
+	String volume = pathElements[0];
+
+#if !JUCE_WINDOWS
+	if (volume == "Volumes" || volume == "media" || volume == "mnt")
+		volume << File::getSeparatorString() << pathElements[1];
+#endif
+
+	return volume.toLowerCase().hashCode64() & 0x7FFFFFFFFFFFFFFFLL;
 }
 
 } // namespace hise
\ No newline at end of file
@@ -213,6 +213,12 @@ public:
 
 	int64 getHashCode();
 
+	/** Returns a hash code for the storage device (or monolith file) that this sound is streamed from.
+	*
+	*	This is used to dispatch the streaming jobs to the worker threads of the SampleThreadPool.
+	*/
+	int64 getStorageAffinity() const noexcept { return fileReader.getStorageAffinity(); }
+
 
 	void refreshFileInformation();
 	void checkFileReference();
@@ -295,6 +301,7 @@ private:
 		String getFileName(bool getFullPath);
 		void checkFileReference();
 		int64 getHashCode() { return hashCode; };
+		int64 getStorageAffinity() const noexcept { return storageAffinity; }
 
 		/** Refreshes the information about the file (if it is missing, if it supports memory-mapping). */
 		void refreshFileInformation();
@@ -376,6 +383,8 @@ private:
 
 	private:
 
+		static int64 getStorageAffinityForFile(const File& f);
+
 		StreamingSamplerSoundPool *pool;
 
 		ReferenceCountedObjectPtr<MonolithInfoToUse> monolithicInfo = nullptr;
@@ -399,6 +408,8 @@ private:
 
 		int64 hashCode;
 
+		int64 storageAffinity;
+
 		StreamingSamplerSound *sound;
 
 		ScopedPointer<MemoryMappedAudioFormatReader> memoryReader;
@@ -300,8 +300,37 @@ int SampleLoader::getNumSamplesForStreamingBuffers() const
 	return b1.getNumSamples();
 }
 
+void SampleLoader::updateDeadline()
+{
+	const StreamingSamplerSound *localSound = sound.get();
+
+	if (localSound == nullptr || localSound->getSampleRate() <= 0.0)
+	{
+		setDeadline(Time::getHighResolutionTicks());
+		return;
+	}
+
+	// The voice consumes the samples with the sample rate of the file multiplied by the pitch ratio.
+	const double samplesPerSecond = playbackSpeed > 0.0 ? playbackSpeed : localSound->getSampleRate();
+
+	const double numSamplesLeft = jmax<double>(0.0, (double)readBuffer.get()->getNumSamples() - readIndexDouble);
+	const double secondsLeft = numSamplesLeft / samplesPerSecond;
+
+	setDeadline(Time::getHighResolutionTicks() + Time::secondsToHighResolutionTicks(secondsLeft));
+}
+
+int64 SampleLoader::getWorkerAffinity() const
+{
+	if (const StreamingSamplerSound *localSound = sound.get())
+		return localSound->getStorageAffinity();
+
+	return -1;
+}
+
 bool SampleLoader::requestNewData()
 {
+	updateDeadline();
+
 #if KILL_VOICES_WHEN_STREAMING_IS_BLOCKED
 	if (this->isQueued())
 	{
@@ -333,13 +362,11 @@ SampleThreadPoolJob::JobStatus SampleLoader::runJob()
 
 	const double readStart = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks());
 
-	if (writeBufferIsBeingFilled)
+	if (writeBufferIsBeingFilled.exchange(true))
 	{
 		return SampleThreadPoolJob::jobNeedsRunningAgain;
 	}
 
-	writeBufferIsBeingFilled = true; // A poor man's mutex but gets the job done.
-
 	const StreamingSamplerSound *localSound = sound.get();
 
 	if (!voiceCounterWasIncreased && localSound != nullptr)
@@ -467,6 +494,8 @@ StreamingSamplerVoice::StreamingSamplerVoice(SampleThreadPool *pool) :
 	sampleStartModValue(0)
 {
 	pitchData = nullptr;
+
+	zeromem(history, sizeof(history));
 };
 
 void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
@@ -478,13 +507,6 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 
 	if (sound != nullptr && sound->getSampleLength() > 0)
 	{
-		loader.startNote(sound, sampleStartModValue);
-
-		jassert(sound != nullptr);
-		sound->wakeSound();
-
-		voiceUptime = (double)sampleStartModValue;
-
 		// You have to call setPitchFactor() before startNote().
 		jassert(uptimeDelta != 0.0);
 
@@ -494,6 +516,17 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 
 		constUptimeDelta = uptimeDelta;
 
+		// The loader needs the playback speed to calculate the deadline of the first request
+		loader.setPlaybackSpeed(uptimeDelta * getSampleRate());
+		loader.startNote(sound, sampleStartModValue);
+
+		jassert(sound != nullptr);
+		sound->wakeSound();
+
+		voiceUptime = (double)sampleStartModValue;
+
+		zeromem(history, sizeof(history));
+
 		isActive = true;
 
 	}
@@ -599,8 +632,13 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 
 		tempVoiceBuffer->clear();
 
+		const bool useStagingBuffer = interpolationMode != SampleInterpolators::Linear && interpolationBuffer != nullptr;
+
+		// The higher order interpolators need some samples after the last read position
+		const double numLookaheadSamples = useStagingBuffer ? (double)SampleInterpolators::NumLookaheadSamples : 0.0;
+
 		// Copy the not resampled values into the voice buffer.
-		StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, pitchCounter + startAlpha);
+		StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, pitchCounter + startAlpha + numLookaheadSamples);
 
 		float* outL = outputBuffer.getWritePointer(0, startSample);
 		float* outR = outputBuffer.getWritePointer(1, startSample);
@@ -615,7 +653,11 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 
 		double indexInBuffer = startAlpha;
 
-		if (data.isFloatingPoint)
+		if (useStagingBuffer)
+		{
+			interpolateFromStagingBuffer(data, outL, outR, startSample, startAlpha, numSamples);
+		}
+		else if (data.isFloatingPoint)
 		{
 			const float* const inL = static_cast<const float*>(data.leftChannel);
 			const float* const inR = static_cast<const float*>(data.rightChannel);
@@ -650,6 +692,9 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 		voiceUptime += pitchCounter;
 #endif
 
+		if (numSamples > 0)
+			loader.setPlaybackSpeed(pitchCounter / (double)numSamples * getSampleRate());
+
 		if (!loader.advanceReadIndex(voiceUptime))
 		{
 #if LOG_SAMPLE_RENDERING
@@ -677,6 +722,40 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 	}
 };
 
+void StreamingSamplerVoice::interpolateFromStagingBuffer(const StereoChannelData& data, float* outL, float* outR, int startSample, double startAlpha, int numSamples)
+{
+	typedef SampleInterpolators SI;
+
+	const int numInputSamples = (int)(pitchCounter + startAlpha) + SI::NumLookaheadSamples;
+
+	jassert(interpolationBuffer->getNumSamples() >= numInputSamples + SI::NumHistorySamples);
+
+	const void* channels[2] = { data.leftChannel, data.rightChannel };
+
+	for (int c = 0; c < 2; c++)
+	{
+		float* staging = interpolationBuffer->getWritePointer(c);
+
+		FloatVectorOperations::copy(staging, history[c], SI::NumHistorySamples);
+
+		if (data.isFloatingPoint)
+			FloatVectorOperations::copy(staging + SI::NumHistorySamples, static_cast<const float*>(channels[c]), numInputSamples);
+		else
+			SI::convertToFloat(staging + SI::NumHistorySamples, static_cast<const int16*>(channels[c]), numInputSamples);
+	}
+
+	const float* stagingL = interpolationBuffer->getReadPointer(0);
+	const float* stagingR = interpolationBuffer->getReadPointer(1);
+
+	SI::process(interpolationMode, stagingL, stagingR, pitchData != nullptr ? pitchData + startSample : nullptr, outL, outR, (double)SI::NumHistorySamples + startAlpha, uptimeDelta, numSamples);
+
+	// Keep the samples before the read position of the next block
+	const int nextReadPosition = (int)(startAlpha + pitchCounter);
+
+	FloatVectorOperations::copy(history[0], stagingL + nextReadPosition, SI::NumHistorySamples);
+	FloatVectorOperations::copy(history[1], stagingR + nextReadPosition, SI::NumHistorySamples);
+}
+
 void StreamingSamplerVoice::setPitchFactor(int midiNote, int rootNote, StreamingSamplerSound *sound, double globalPitchFactor)
 {
 	if (midiNote == rootNote)
@@ -693,7 +772,7 @@ void StreamingSamplerVoice::prepareToPlay(double sampleRate, int samplesPerBlock
 {
 	if (sampleRate != -1.0)
 	{
-		loader.assertBufferSize(samplesPerBlock * MAX_SAMPLER_PITCH);
+		loader.assertBufferSize(samplesPerBlock * MAX_SAMPLER_PITCH + SampleInterpolators::NumPaddingSamples);
 
 		setCurrentPlaybackSampleRate(sampleRate);
 	}
@@ -732,13 +811,34 @@ void StreamingSamplerVoice::initTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buf
 	// The channel amount must be set correctly in the constructor
 	jassert(bufferToUse->getNumChannels() > 0);
 
-	if (bufferToUse->getNumSamples() < samplesPerBlock*MAX_SAMPLER_PITCH)
+	const int numSamplesNeeded = samplesPerBlock * MAX_SAMPLER_PITCH + SampleInterpolators::NumPaddingSamples;
+
+	if (bufferToUse->getNumSamples() < numSamplesNeeded)
+	{
+		bufferToUse->setSize(bufferToUse->getNumChannels(), numSamplesNeeded);
+		bufferToUse->clear();
+	}
+}
+
+void StreamingSamplerVoice::initInterpolationBuffer(AudioSampleBuffer* bufferToUse, int samplesPerBlock)
+{
+	const int numSamplesNeeded = samplesPerBlock * MAX_SAMPLER_PITCH + SampleInterpolators::NumPaddingSamples;
+
+	if (bufferToUse->getNumSamples() < numSamplesNeeded)
 	{
-		bufferToUse->setSize(bufferToUse->getNumChannels(), samplesPerBlock*MAX_SAMPLER_PITCH);
+		bufferToUse->setSize(2, numSamplesNeeded);
 		bufferToUse->clear();
 	}
 }
 
+void StreamingSamplerVoice::setInterpolationMode(SampleInterpolators::Mode newMode)
+{
+	if (newMode == SampleInterpolators::Sinc)
+		SampleInterpolators::initialiseTables();
+
+	interpolationMode = newMode;
+}
+
 void StreamingSamplerVoice::setStreamingBufferDataType(bool shouldBeFloat)
 {
 	loader.setStreamingBufferDataType(shouldBeFloat);
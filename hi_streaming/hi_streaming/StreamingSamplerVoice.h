@@ -69,6 +69,12 @@ public:
 	*/
 	JobStatus runJob() override;
 
+	/** Returns the storage affinity of the currently loaded sound, so that the job is executed by the streaming worker for its drive.
+	*
+	*	The sound can change while the loader is queued, so the SampleThreadPool keeps a queued job on its first worker.
+	*/
+	int64 getWorkerAffinity() const override;
+
 	size_t getActualStreamingBufferSize() const;
 
 	void setStreamingBufferDataType(bool shouldBeFloat);
@@ -87,6 +93,12 @@ public:
 	/** Returns the loaded sound. */
 	inline const StreamingSamplerSound *getLoadedSound() const { return sound.get(); };
 
+	/** Sets the amount of samples per second that the voice reads from the buffers (the file sample rate multiplied with the pitch ratio).
+	*
+	*	This is used to calculate the deadline until the next buffer must be filled.
+	*/
+	void setPlaybackSpeed(double samplesPerSecond) noexcept { playbackSpeed = samplesPerSecond; }
+
 	class Unmapper : public SampleThreadPoolJob
 	{
 	public:
@@ -136,6 +148,9 @@ private:
 
 	bool requestNewData();
 
+	/** Calculates the time when the read buffer will run out of samples and sets it as deadline for the next job. */
+	void updateDeadline();
+
 	bool swapBuffers();
 
 	void fillInactiveBuffer();
@@ -151,7 +166,7 @@ private:
 	CriticalSection lock;
 
 	/** A mutex for the buffer that is being used for loading. */
-	bool writeBufferIsBeingFilled;
+	std::atomic<bool> writeBufferIsBeingFilled;
 
 	// variables for handling of the internal buffers
 
@@ -159,6 +174,8 @@ private:
 
 	double lastSwapPosition = 0.0;
 
+	double playbackSpeed = 0.0;
+
 	Atomic<StreamingSamplerSound const *> sound;
 
 	int readIndex;
@@ -285,8 +302,27 @@ public:
 	/** Set this to false if you're using HLAC compressed monoliths. */
 	void setStreamingBufferDataType(bool shouldBeFloat);
 
+	/** Sets the interpolation algorithm. Every mode except Linear needs the interpolation buffer. */
+	void setInterpolationMode(SampleInterpolators::Mode newMode);
+
+	/** Gives the voice a reference to the sampler's buffer for the higher order interpolation modes. */
+	void setInterpolationBuffer(AudioSampleBuffer* buffer) { interpolationBuffer = buffer; }
+
+	/** Call this once for every sampler. */
+	static void initInterpolationBuffer(AudioSampleBuffer* bufferToUse, int samplesPerBlock);
+
 private:
 
+	/** Copies the samples into the interpolation buffer (with the history of the last block) and interpolates them. */
+	void interpolateFromStagingBuffer(const StereoChannelData& data, float* outL, float* outR, int startSample, double startAlpha, int numSamples);
+
+	SampleInterpolators::Mode interpolationMode = SampleInterpolators::Linear;
+
+	AudioSampleBuffer* interpolationBuffer = nullptr;
+
+	/** The last samples before the current read position. */
+	float history[2][SampleInterpolators::NumHistorySamples];
+
 	double pitchCounter = 0.0;
 
 	hlac::HiseSampleBuffer* tvb = nullptr;
@@ -34,7 +34,7 @@
 #if HLAC_INCLUDE_TEST_SUITE
 
 
-//static BitCompressors::UnitTests bitTests;
+static BitCompressors::UnitTests bitTests;
 
 void BitCompressors::UnitTests::runTest()
 {
@@ -253,6 +253,27 @@ void BitCompressors::UnitTests::testCompressor(Base* compressor)
 		expectEquals<int16>(decompressedData[i], uncompressedData[i], "Sample mismatch at position " + String(i));
 	}
 
+	const auto previousInstructionSet = SIMDDecoding::getInstructionSet();
+
+	for (int s = 0; s <= (int)SIMDDecoding::getBestAvailableInstructionSet(); s++)
+	{
+		const auto instructionSet = (SIMDDecoding::InstructionSet)s;
+		const String name = SIMDDecoding::getInstructionSetName(instructionSet);
+
+		SIMDDecoding::setInstructionSet(instructionSet);
+
+		memset(decompressedData, 0, sizeof(int16)*numToCompress);
+
+		compressor->decompress(decompressedData, compressedData, numToCompress);
+
+		for (int i = 0; i < numToCompress; i++)
+		{
+			expectEquals<int16>(decompressedData[i], uncompressedData[i], name + " sample mismatch at position " + String(i));
+		}
+	}
+
+	SIMDDecoding::setInstructionSet(previousInstructionSet);
+
 	free(uncompressedData);
 	free(compressedData);
 	free(decompressedData);
@@ -37,7 +37,7 @@ void printHelp()
 	Logger::writeToLog("Usage: hlac_tool [MODE] [INPUT] [OUTPUT]");
 	Logger::writeToLog("");
 	Logger::writeToLog("modes: 'encode' / 'decode'");
-	Logger::writeToLog("test-modes: 'unit_test' / 'test_directory', 'memory_map_directory'");
+	Logger::writeToLog("test-modes: 'unit_test' / 'test_directory', 'memory_map_directory', 'decode_benchmark'");
 	Logger::writeToLog("(put '_' before filename to skip samples)");
 	Logger::setCurrentLogger(nullptr);
 }
@@ -97,6 +97,78 @@ void testMemoryMapPerformance(Array<File>& files)
 	}
 }
 
+/** Measures the decoding speed of the bit compressors for every available SIMD instruction set. */
+int runDecodeBenchmark()
+{
+	const int numValues = COMPRESSION_BLOCK_SIZE;
+	const int numIterations = 2000;
+	const int bitRates[] = { 1, 2, 4, 6, 8, 10, 12, 14 };
+
+	BitCompressors::Collection collection;
+	Random r;
+
+	HeapBlock<int16> original(numValues);
+	HeapBlock<int16> decoded(numValues);
+	HeapBlock<uint8> compressed(numValues * sizeof(int16));
+
+	const auto previousInstructionSet = SIMDDecoding::getInstructionSet();
+	const int numInstructionSets = (int)SIMDDecoding::getBestAvailableInstructionSet() + 1;
+
+	bool ok = true;
+
+	for (auto bitRate : bitRates)
+	{
+		auto compressor = collection.getSuitableCompressorForBitRate((uint8)bitRate);
+
+		const int maxValue = bitRate == 1 ? 2 : (1 << (bitRate - 1));
+		const int minValue = bitRate == 1 ? 0 : (-maxValue + 1);
+
+		for (int i = 0; i < numValues; i++)
+			original[i] = (int16)r.nextInt(Range<int>(minValue, maxValue));
+
+		compressor->compress(compressed, original, numValues);
+
+		String line = "Bit rate " + String(bitRate) + ":";
+		double scalarTime = 0.0;
+
+		for (int s = 0; s < numInstructionSets; s++)
+		{
+			SIMDDecoding::setInstructionSet((SIMDDecoding::InstructionSet)s);
+
+			const double start = Time::getMillisecondCounterHiRes();
+
+			for (int i = 0; i < numIterations; i++)
+				compressor->decompress(decoded, compressed, numValues);
+
+			const double delta = Time::getMillisecondCounterHiRes() - start;
+
+			if (s == 0)
+				scalarTime = delta;
+
+			ok &= memcmp(decoded, original, sizeof(int16) * numValues) == 0;
+
+			const double samplesPerMs = (double)(numValues * numIterations) / delta;
+
+			line << "\t" << SIMDDecoding::getInstructionSetName((SIMDDecoding::InstructionSet)s) << ": " << String(samplesPerMs / 1000.0, 1) << "M samples/s";
+
+			if (s != 0)
+				line << " (" << String(scalarTime / delta, 2) << "x)";
+		}
+
+		Logger::writeToLog(line);
+	}
+
+	SIMDDecoding::setInstructionSet(previousInstructionSet);
+
+	if (!ok)
+	{
+		ABORT_WITH_MESSAGE("Decoded data mismatch");
+	}
+
+	Logger::setCurrentLogger(nullptr);
+	return 0;
+}
+
 int decode(File input, File output)
 {
 
@@ -246,6 +318,11 @@ int main(int argc, char **argv)
 	}
 
 
+	if (mode == "decode_benchmark")
+	{
+		return runDecodeBenchmark();
+	}
+
 	if (mode == "memory_map_directory")
 	{
 		File root(argv[2]);